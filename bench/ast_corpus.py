@@ -0,0 +1,52 @@
+#!/usr/bin/python3
+#
+# This software is licensed under BSD0 (public domain).
+# Therefore, this software belongs to humanity.
+# See COPYING for more info.
+#
+
+#
+# Test corpus front-end benchmark
+# Runs the compiler over every source file in the test tree (plus an optional
+# generated stress file), and reports the total time and the largest peak
+# memory of any one run. Used to compare changes to the AST representation.
+#
+# Usage: ast_corpus.py <compiler> <test dir> <extension> [option] [runs]
+#
+import glob
+import os
+import resource
+import subprocess
+import sys
+import time
+
+def main():
+    if len(sys.argv) < 4:
+        print("Usage: ast_corpus.py <compiler> <test dir> <extension> [option] [runs]")
+        return 1
+
+    compiler = os.path.abspath(sys.argv[1])
+    sources = sorted(glob.glob(os.path.join(os.path.abspath(sys.argv[2]), "**", "*." + sys.argv[3]), recursive=True))
+    option = sys.argv[4] if len(sys.argv) > 4 else "--ast"
+    runs = int(sys.argv[5]) if len(sys.argv) > 5 else 5
+
+    best = None
+    for run in range(runs):
+        start = time.time()
+        for src in sources:
+            subprocess.run([compiler, src, option], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL,
+                           cwd=os.path.dirname(src))
+        elapsed = time.time() - start
+        if best is None or elapsed < best:
+            best = elapsed
+
+    # ru_maxrss is in kilobytes on Linux
+    rss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+
+    print("files: " + str(len(sources)) + " (" + option + ", best of " + str(runs) + ")")
+    print("time: %.3f s" % best)
+    print("peak memory: %.1f MB" % (rss / 1024.0))
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
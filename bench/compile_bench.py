@@ -0,0 +1,240 @@
+#!/usr/bin/python3
+#
+# This software is licensed under BSD0 (public domain).
+# Therefore, this software belongs to humanity.
+# See COPYING for more info.
+#
+
+#
+# Compiler throughput benchmark
+# Generates large Orka and Riya programs that each lean on one part of the
+# compiler, and runs every one of them through the lexer only (--test-lex),
+# the parser and midend (--ast), LLVM IR generation (--llvm), and a full
+# compile and link. The first three print what they make, which goes to
+# /dev/null but is still part of the time. Each is reported as source lines per second, along with
+# the peak memory of the compiler. With a csv file, the results are also
+# written there, so runs from before and after a change can be compared.
+#
+# Usage: compile_bench.py <okcc> <riyac> [scale] [runs] [csv file]
+#
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+MODES = [
+    ("lex", ["--test-lex"]),
+    ("parse", ["--ast"]),
+    ("llvm", ["--llvm"]),
+    ("compile", ["-o", "bench.exe"]),
+]
+
+#
+# Generators
+# Each takes the scale, and the name of the integer type and whether classes
+# and imports are there, which is where the two languages differ.
+#
+
+# Lots of small functions, all called from main
+def gen_functions(lang, scale):
+    out = []
+    count = 2000 * scale
+    for i in range(count):
+        out.append("func fn%d(a:%s, b:%s) -> %s is" % (i, lang["int"], lang["int"], lang["int"]))
+        out.append("    var c : %s := a * b + %d;" % (lang["int"], i % 100))
+        out.append("    return c - a;")
+        out.append("end")
+        out.append("")
+
+    out.append("func main -> %s is" % lang["int"])
+    out.append("    var x : %s := 0;" % lang["int"])
+    for i in range(0, count, 10):
+        out.append("    x := fn%d(x, %d) %% 1000;" % (i, i % 7))
+    out.append("    return 0;")
+    out.append("end")
+    return out
+
+# Blocks nested deep inside each other
+def gen_nesting(lang, scale):
+    out = []
+    depth = 60
+    for f in range(20 * scale):
+        out.append("func nest%d(x:%s) -> %s is" % (f, lang["int"], lang["int"]))
+        for level in range(depth):
+            indent = "    " * (level + 1)
+            out.append(indent + "x := x + %d;" % level)
+            if level % 2 == 0:
+                out.append(indent + "if x > %d then" % level)
+            else:
+                out.append(indent + "while x < %d do" % (level * 3))
+        for level in reversed(range(depth)):
+            indent = "    " * (level + 1)
+            if level % 2 == 1:
+                out.append(indent + "    x := x + 1;")
+            out.append(indent + "end")
+        out.append("    return x;")
+        out.append("end")
+        out.append("")
+
+    out.append("func main -> %s is" % lang["int"])
+    out.append("    return 0;")
+    out.append("end")
+    return out
+
+# Long arithmetic expressions
+def gen_expressions(lang, scale):
+    ops = ["+", "-", "*", "&", "|", "^"]
+    out = []
+    for f in range(20 * scale):
+        out.append("func expr%d(a:%s, b:%s) -> %s is" % (f, lang["int"], lang["int"], lang["int"]))
+        out.append("    var x : %s := 0;" % lang["int"])
+        for s in range(10):
+            terms = ["x"]
+            for t in range(100):
+                terms.append(ops[(t + s) % len(ops)])
+                terms.append(["a", "b", str(t + 1)][t % 3])
+            out.append("    x := " + " ".join(terms) + ";")
+        out.append("    return x;")
+        out.append("end")
+        out.append("")
+
+    out.append("func main -> %s is" % lang["int"])
+    out.append("    return 0;")
+    out.append("end")
+    return out
+
+# Big structures, and in Orka, big classes
+def gen_structs(lang, scale):
+    out = []
+    count = 50 * scale
+    fields = 40
+    for s in range(count):
+        out.append("struct S%d is" % s)
+        for f in range(fields):
+            out.append("    field%d : %s := %d;" % (f, lang["int"], f))
+        out.append("end")
+        out.append("")
+
+    if lang["classes"]:
+        for c in range(count):
+            out.append("class C%d is" % c)
+            out.append("    func C%d is" % c)
+            out.append("        this.y := %d;" % c)
+            out.append("    end")
+            out.append("")
+            for m in range(fields // 2):
+                out.append("    func m%d(x:int) -> int is" % m)
+                out.append("        return x + %d;" % m)
+                out.append("    end")
+                out.append("")
+            out.append("    var y : int := 0;")
+            out.append("end")
+            out.append("")
+
+    out.append("func main -> %s is" % lang["int"])
+    out.append("    var x : %s := 0;" % lang["int"])
+    for s in range(count):
+        out.append("    struct s%d : S%d;" % (s, s))
+        out.append("    x := x + s%d.field%d;" % (s, s % fields))
+        if lang["classes"]:
+            out.append("    class c%d : C%d;" % (s, s))
+            out.append("    x := c%d.m%d(x);" % (s, s % (fields // 2)))
+    out.append("    return 0;")
+    out.append("end")
+    return out
+
+# The same header imported over and over
+def gen_imports(lang, scale):
+    out = []
+    for i in range(500 * scale):
+        out.append("import std.io;")
+    out.append("")
+    out.append("func main -> int is")
+    out.append("    return 0;")
+    out.append("end")
+    return out
+
+GENERATORS = [
+    ("functions", gen_functions, False),
+    ("nesting", gen_nesting, False),
+    ("expressions", gen_expressions, False),
+    ("structs", gen_structs, False),
+    ("imports", gen_imports, True),
+]
+
+LANGUAGES = [
+    ("orka", ".ok", { "int": "int", "classes": True }),
+    ("riya", ".ry", { "int": "i32", "classes": False }),
+]
+
+#
+# Runs the compiler once, and returns the time and the peak memory
+#
+def run(command, cwd):
+    start = time.time()
+    proc = subprocess.Popen(command, cwd=cwd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    _, status, usage = os.wait4(proc.pid, 0)
+    elapsed = time.time() - start
+    proc.returncode = os.waitstatus_to_exitcode(status)
+
+    # ru_maxrss is in kilobytes on Linux
+    return proc.returncode, elapsed, usage.ru_maxrss
+
+def main():
+    if len(sys.argv) < 3:
+        print("Usage: compile_bench.py <okcc> <riyac> [scale] [runs] [csv file]")
+        return 1
+
+    compilers = { "orka": os.path.abspath(sys.argv[1]), "riya": os.path.abspath(sys.argv[2]) }
+    scale = int(sys.argv[3]) if len(sys.argv) > 3 else 1
+    runs = int(sys.argv[4]) if len(sys.argv) > 4 else 3
+    csv = open(sys.argv[5], "w") if len(sys.argv) > 5 else None
+    failed = False
+
+    if csv:
+        csv.write("language,program,lines,mode,seconds,lines_per_second,peak_mb\n")
+
+    print("%-6s %-12s %8s %-8s %9s %12s %10s" % ("lang", "program", "lines", "mode", "time (s)", "lines/s", "peak (MB)"))
+
+    with tempfile.TemporaryDirectory() as tmp:
+        for lang_name, ext, lang in LANGUAGES:
+            for name, generator, orka_only in GENERATORS:
+                if orka_only and lang_name != "orka":
+                    continue
+
+                lines = generator(lang, scale)
+                path = os.path.join(tmp, name + ext)
+                with open(path, "w") as out:
+                    out.write("\n".join(lines) + "\n")
+
+                for mode, options in MODES:
+                    best = None
+                    peak = 0
+                    for i in range(runs):
+                        code, elapsed, rss = run([compilers[lang_name], path] + options, tmp)
+                        if code != 0:
+                            best = None
+                            break
+                        if best is None or elapsed < best:
+                            best = elapsed
+                        peak = max(peak, rss)
+
+                    if best is None:
+                        print("%-6s %-12s %8d %-8s failed" % (lang_name, name, len(lines), mode))
+                        failed = True
+                        continue
+
+                    rate = len(lines) / best
+                    print("%-6s %-12s %8d %-8s %9.3f %12.0f %10.1f" % (lang_name, name, len(lines), mode, best, rate, peak / 1024.0))
+                    if csv:
+                        csv.write("%s,%s,%d,%s,%.4f,%.0f,%.1f\n" % (lang_name, name, len(lines), mode, best, rate, peak / 1024.0))
+                    sys.stdout.flush()
+
+    if csv:
+        csv.close()
+
+    return 1 if failed else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
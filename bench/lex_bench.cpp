@@ -0,0 +1,119 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+
+//
+// Lexer throughput benchmark
+// Runs the Orka lexer over a file until it hits the end, and reports how fast
+// it got through it. Without a file, a large synthetic program is generated.
+//
+// Usage: lex_bench [file] [--size MB] [--runs N]
+//
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+
+#include <unistd.h>
+
+#include <lex/lex.hpp>
+
+//
+// Writes a program of roughly the given size, using most of the token types
+//
+void generate(std::string path, size_t size) {
+    std::ofstream writer(path);
+    size_t written = 0;
+    
+    writer << "import std.io;\n\n";
+    
+    for (int i = 0; written < size; i++) {
+        std::string n = std::to_string(i);
+        std::string func = "";
+        
+        func += "# Generated function " + n + "\n";
+        func += "func calc" + n + "(x:int, y:int) -> int is\n";
+        func += "    var total" + n + " : int := x * " + n + " + y;\n";
+        func += "    var name : str := \"function\\t" + n + "\\n\";\n";
+        func += "    var letter : char := 'a';\n";
+        func += "    array values : int[16];\n";
+        func += "    \n";
+        func += "    for i in 0 .. 16 step 1 do\n";
+        func += "        values[i] := (total" + n + " << 2) % 0x1F;\n";
+        func += "        if values[i] >= 10 and values[i] != 12 then\n";
+        func += "            total" + n + " := total" + n + " - values[i];\n";
+        func += "        elif values[i] <= 3 or x = y then\n";
+        func += "            printf(\"%d\\n\", values[i]);\n";
+        func += "        end\n";
+        func += "    end\n";
+        func += "    \n";
+        func += "    return total" + n + " + sizeof(int) + 3.14159;\n";
+        func += "end\n\n";
+        
+        writer << func;
+        written += func.length();
+    }
+}
+
+int main(int argc, char **argv) {
+    std::string path = "";
+    size_t size = 32;
+    int runs = 5;
+    
+    for (int i = 1; i<argc; i++) {
+        std::string arg = argv[i];
+        
+        if (arg == "--size" && i + 1 < argc) {
+            size = atoi(argv[i+1]);
+            i += 1;
+        } else if (arg == "--runs" && i + 1 < argc) {
+            runs = atoi(argv[i+1]);
+            i += 1;
+        } else if (arg[0] == '-') {
+            std::cerr << "Usage: lex_bench [file] [--size MB] [--runs N]" << std::endl;
+            return 1;
+        } else {
+            path = arg;
+        }
+    }
+    
+    bool generated = false;
+    if (path == "") {
+        path = "/tmp/lex_bench_" + std::to_string(getpid()) + ".ok";
+        generate(path, size * 1024 * 1024);
+        generated = true;
+    }
+    
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    double megabytes = (double)file.tellg() / (1024 * 1024);
+    file.close();
+    
+    double best = -1;
+    size_t tokens = 0;
+    
+    for (int run = 0; run<runs; run++) {
+        auto start = std::chrono::steady_clock::now();
+        
+        Lex lex(path);
+        tokens = 0;
+        while (lex.get_next() != t_eof) ++tokens;
+        
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (best < 0 || elapsed.count() < best) best = elapsed.count();
+    }
+    
+    if (generated) remove(path.c_str());
+    
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "input: " << megabytes << " MB, " << tokens << " tokens" << std::endl;
+    std::cout << "time: " << std::setprecision(3) << best << " s (best of " << runs << ")" << std::endl;
+    std::cout << "throughput: " << std::setprecision(1) << (megabytes / best) << " MB/s" << std::endl;
+    
+    return 0;
+}
+
@@ -0,0 +1,98 @@
+#!/usr/bin/python3
+#
+# This software is licensed under BSD0 (public domain).
+# Therefore, this software belongs to humanity.
+# See COPYING for more info.
+#
+
+#
+# Array passing benchmark
+# Passes arrays of growing sizes to a small function in a loop, on both
+# interpreters. Arrays are passed by handle, so the cost of a call should stay
+# the same no matter how big the array is.
+#
+# The program is run once with no calls to measure the setup, and that time is
+# taken out of the per-call numbers.
+#
+# Usage: riyai_array_bench.py <riyai> [calls] [runs]
+#
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+SIZES = [1000, 10000, 100000, 1000000]
+
+PROGRAM = """
+func pick(a:i32[], i:i32) -> i32 is
+    return a[i % 1000];
+end
+
+func main -> i32 is
+    array x : i32[{SIZE}];
+    var i : i32 := 0;
+    var total : i32 := 0;
+    while i < {CALLS} do
+        total := total + pick(x, i);
+        i := i + 1;
+    end
+    print(total);
+    return 0;
+end
+"""
+
+def run(riyai, path, options, runs):
+    best = -1
+    for i in range(runs):
+        start = time.time()
+        result = subprocess.run([riyai, path] + options, stdout=subprocess.DEVNULL)
+        elapsed = time.time() - start
+        if result.returncode != 0:
+            return None
+        if best < 0 or elapsed < best:
+            best = elapsed
+    return best
+
+def per_call(riyai, tmp, size, calls, options, runs):
+    times = []
+    for count in [0, calls]:
+        path = os.path.join(tmp, "array_%d_%d.ry" % (size, count))
+        with open(path, "w") as out:
+            out.write(PROGRAM.replace("{SIZE}", str(size)).replace("{CALLS}", str(count)))
+
+        elapsed = run(riyai, path, options, runs)
+        if elapsed is None:
+            return None
+        times.append(elapsed)
+
+    return max(times[1] - times[0], 0) / calls * 1000000
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: riyai_array_bench.py <riyai> [calls] [runs]")
+        return 1
+
+    riyai = sys.argv[1]
+    calls = int(sys.argv[2]) if len(sys.argv) > 2 else 20000
+    runs = int(sys.argv[3]) if len(sys.argv) > 3 else 3
+    failed = False
+
+    print("%-10s %14s %14s" % ("size", "tree (us/call)", "vm (us/call)"))
+
+    with tempfile.TemporaryDirectory() as tmp:
+        for size in SIZES:
+            tree = per_call(riyai, tmp, size, calls, ["--tree"], runs)
+            vm = per_call(riyai, tmp, size, calls, [], runs)
+
+            if tree is None or vm is None:
+                print("%-10d failed to run" % size)
+                failed = True
+            else:
+                print("%-10d %14.3f %14.3f" % (size, tree, vm))
+
+    return 1 if failed else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
+
@@ -0,0 +1,177 @@
+#!/usr/bin/python3
+#
+# This software is licensed under BSD0 (public domain).
+# Therefore, this software belongs to humanity.
+# See COPYING for more info.
+#
+
+#
+# Interpreter benchmark
+# Runs a few loop-heavy Riya programs on the bytecode VM, the tree-walking
+# interpreter on its own, and the tree walker with hot functions sent to the
+# JIT, and checks that they all agree.
+#
+# Usage: riyai_bench.py <riyai> [scale] [runs]
+#
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+PROGRAMS = {
+    # Plain integer arithmetic in nested loops
+    "loops": """
+func main -> i32 is
+    var i : i32 := 0;
+    var total : i32 := 0;
+    while i < {N} do
+        var j : i32 := 0;
+        while j < 100 do
+            total := (total + i * j + (j % 7)) % 1000000;
+            j := j + 1;
+        end
+        i := i + 1;
+    end
+    print(total);
+    return 0;
+end
+""",
+
+    # Filling and summing an array
+    "arrays": """
+func main -> i32 is
+    array x : i32[1000];
+    var pass : i32 := 0;
+    var total : i32 := 0;
+    while pass < {N} / 10 do
+        var i : i32 := 0;
+        while i < 1000 do
+            x[i] := i * pass % 97;
+            i := i + 1;
+        end
+        i := 0;
+        while i < 1000 do
+            total := (total + x[i]) % 1000000;
+            i := i + 1;
+        end
+        pass := pass + 1;
+    end
+    print(total);
+    return 0;
+end
+""",
+
+    # Calling a small function in a loop
+    "calls": """
+func mix(a:i32, b:i32) -> i32 is
+    return (a * 31 + b) % 65536;
+end
+
+func main -> i32 is
+    var i : i32 := 0;
+    var total : i32 := 0;
+    while i < {N} * 20 do
+        total := mix(total, i);
+        i := i + 1;
+    end
+    print(total);
+    return 0;
+end
+""",
+
+    # Deep recursion, which is mostly frame setup and teardown
+    "fib": """
+func fib(n:i32) -> i32 is
+    var r : i32 := n;
+    if n >= 2 then
+        r := fib(n - 1) + fib(n - 2);
+    end
+    return r;
+end
+
+func main -> i32 is
+    var i : i32 := 0;
+    var total : i32 := 0;
+    while i < {N} / 1000 do
+        total := total + fib(18);
+        i := i + 1;
+    end
+    print(total);
+    return 0;
+end
+""",
+
+    # Walking the characters of a string
+    "strings": """
+func main -> i32 is
+    var s : string := "the quick brown fox jumps over the lazy dog";
+    array letters : string[64];
+    var i : i32 := 0;
+    var count : i32 := 0;
+    while i < {N} * 2 do
+        var j : i32 := 0;
+        while j < length(s) do
+            var c : char := s[j];
+            letters[j] := c;
+            count := count + 1;
+            j := j + 1;
+        end
+        i := i + 1;
+    end
+    print(count);
+    print(letters[4], letters[10]);
+    return 0;
+end
+""",
+}
+
+def run(riyai, path, options, runs):
+    best = -1
+    output = ""
+    for i in range(runs):
+        start = time.time()
+        result = subprocess.run([riyai, path] + options, stdout=subprocess.PIPE)
+        elapsed = time.time() - start
+        if result.returncode != 0:
+            return None, None
+        output = result.stdout
+        if best < 0 or elapsed < best:
+            best = elapsed
+    return best, output
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: riyai_bench.py <riyai> [scale] [runs]")
+        return 1
+
+    riyai = sys.argv[1]
+    scale = int(sys.argv[2]) if len(sys.argv) > 2 else 5000
+    runs = int(sys.argv[3]) if len(sys.argv) > 3 else 3
+    failed = False
+
+    print("%-10s %10s %10s %10s %9s" % ("program", "tree (s)", "tiered (s)", "vm (s)", "speedup"))
+
+    with tempfile.TemporaryDirectory() as tmp:
+        for name, source in PROGRAMS.items():
+            path = os.path.join(tmp, name + ".ry")
+            with open(path, "w") as out:
+                out.write(source.replace("{N}", str(scale)))
+
+            tree_time, tree_out = run(riyai, path, ["--tree", "--no-jit"], runs)
+            tier_time, tier_out = run(riyai, path, ["--tree"], runs)
+            vm_time, vm_out = run(riyai, path, [], runs)
+
+            if tree_time is None or tier_time is None or vm_time is None:
+                print("%-10s failed to run" % name)
+                failed = True
+            elif tree_out != vm_out or tier_out != vm_out:
+                print("%-10s output differs between the interpreters" % name)
+                failed = True
+            else:
+                print("%-10s %10.3f %10.3f %10.3f %8.1fx" % (name, tree_time, tier_time, vm_time, tree_time / vm_time))
+
+    return 1 if failed else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
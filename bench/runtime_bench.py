@@ -0,0 +1,174 @@
+#!/usr/bin/python3
+#
+# This software is licensed under BSD0 (public domain).
+# Therefore, this software belongs to humanity.
+# See COPYING for more info.
+#
+
+#
+# Runtime benchmark
+# Runs the programs in bench/programs through every way we have of running
+# them: the Orka ones are compiled with okcc at each optimization level and
+# with the Java backend, and the Riya ones are compiled with riyac at each
+# level and run under both of riyai's interpreters. Each is timed as the best
+# of several runs, and its output is checked against the -O0 build so a fast
+# but wrong result doesn't go unnoticed. With a json file, the results are
+# also written there, so runs from before and after a change can be compared.
+#
+# Usage: runtime_bench.py <build dir> [runs] [json file]
+#
+import datetime
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+PROGRAMS = os.path.join(ROOT, "programs")
+
+LEVELS = ["0", "1", "2", "3"]
+
+# Combinations that can't run yet, because the runner is missing a feature
+UNSUPPORTED = [
+    ("alloc.ry", "riyai-tree"),
+    ("strings.ry", "riyai-tree"),
+]
+
+#
+# Returns the runners for a program as (name, compile command, run command)
+# The commands are run in a scratch directory, and the compile can be None.
+#
+def get_runners(build, path, name, ext):
+    okcc = os.path.join(build, "orka-lang", "okcc")
+    okjc = os.path.join(build, "orka-lang", "okjc")
+    riyac = os.path.join(build, "riya-lang", "riyac")
+    riyai = os.path.join(build, "riya-lang", "riyai")
+    runners = []
+
+    if ext == ".ok":
+        for level in LEVELS:
+            runners.append(("okcc-O" + level, [okcc, path, "-O" + level, "-o", name], ["./" + name]))
+        runners.append(("java", [okjc, path], ["java", "-cp", ".", name]))
+    else:
+        for level in LEVELS:
+            runners.append(("riyac-O" + level, [riyac, path, "-O" + level, "-o", name], ["./" + name]))
+        runners.append(("riyai", None, [riyai, path]))
+        runners.append(("riyai-tree", None, [riyai, path, "--tree"]))
+
+    return runners
+
+#
+# Runs a command and returns the time it took and what it printed
+#
+def run(command, cwd):
+    start = time.perf_counter()
+    result = subprocess.run(command, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+    elapsed = time.perf_counter() - start
+    return result.returncode, elapsed, result.stdout.decode(errors="replace")
+
+# @parallel blocks print in whatever order the threads finish
+def normalize(output):
+    return sorted(output.splitlines())
+
+def get_commit():
+    try:
+        result = subprocess.run(["git", "rev-parse", "--short", "HEAD"], cwd=ROOT, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+        return result.stdout.decode().strip()
+    except OSError:
+        return ""
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: runtime_bench.py <build dir> [runs] [json file]")
+        return 1
+
+    build = os.path.abspath(sys.argv[1])
+    runs = int(sys.argv[2]) if len(sys.argv) > 2 else 3
+    json_path = sys.argv[3] if len(sys.argv) > 3 else None
+    has_java = shutil.which("java") is not None
+    results = []
+    failed = False
+
+    print("%-14s %-12s %11s %9s  %s" % ("program", "runner", "compile (s)", "run (s)", "result"))
+
+    for program in sorted(os.listdir(PROGRAMS)):
+        name, ext = os.path.splitext(program)
+        if ext not in [".ok", ".ry"]:
+            continue
+
+        path = os.path.join(PROGRAMS, program)
+        language = "orka" if ext == ".ok" else "riya"
+        expected = None
+
+        for runner, compile, command in get_runners(build, path, name, ext):
+            entry = {
+                "program": program, "language": language, "runner": runner,
+                "compile_seconds": None, "seconds": None, "ok": False, "status": "",
+            }
+            results.append(entry)
+
+            if (program, runner) in UNSUPPORTED:
+                entry["status"] = "unsupported"
+            elif runner == "java" and not has_java:
+                entry["status"] = "skipped (no java)"
+
+            if entry["status"] != "":
+                print("%-14s %-12s %11s %9s  %s" % (program, runner, "-", "-", entry["status"]))
+                continue
+
+            with tempfile.TemporaryDirectory() as tmp:
+                try:
+                    if compile:
+                        code, entry["compile_seconds"], _ = run(compile, tmp)
+                        if code != 0:
+                            entry["status"] = "compile failed"
+
+                    best = None
+                    output = ""
+                    for i in range(runs):
+                        if entry["status"] != "":
+                            break
+                        code, elapsed, output = run(command, tmp)
+                        if code != 0:
+                            entry["status"] = "exited with %d" % code
+                        elif best is None or elapsed < best:
+                            best = elapsed
+                except OSError as error:
+                    entry["status"] = str(error)
+
+            if entry["status"] == "":
+                entry["seconds"] = best
+                if expected is None:
+                    expected = normalize(output)
+                if normalize(output) == expected:
+                    entry["ok"] = True
+                    entry["status"] = "ok"
+                else:
+                    entry["status"] = "output differs"
+
+            if not entry["ok"]:
+                failed = True
+
+            compile_time = "-" if entry["compile_seconds"] is None else "%.3f" % entry["compile_seconds"]
+            run_time = "-" if entry["seconds"] is None else "%.3f" % entry["seconds"]
+            print("%-14s %-12s %11s %9s  %s" % (program, runner, compile_time, run_time, entry["status"]))
+            sys.stdout.flush()
+
+    if json_path:
+        report = {
+            "date": datetime.datetime.now().isoformat(timespec="seconds"),
+            "commit": get_commit(),
+            "runs": runs,
+            "results": results,
+        }
+        with open(json_path, "w") as out:
+            json.dump(report, out, indent=4)
+            out.write("\n")
+
+    return 1 if failed else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
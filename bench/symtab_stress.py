@@ -0,0 +1,85 @@
+#!/usr/bin/python3
+#
+# This software is licensed under BSD0 (public domain).
+# Therefore, this software belongs to humanity.
+# See COPYING for more info.
+#
+
+#
+# Symbol table stress test
+# Generates functions with thousands of statements spread over deeply nested
+# blocks, and times how long the compiler takes to get through them.
+#
+# Usage: symtab_stress.py <okcc> [statements] [depth] [functions]
+#
+import os
+import resource
+import subprocess
+import sys
+import tempfile
+import time
+
+def gen_function(out, name, statements, depth):
+    per_level = max(1, statements // depth)
+    out.write("func " + name + "(x:int) -> int is\n")
+
+    count = 0
+    for level in range(depth):
+        indent = "    " * (level + 1)
+
+        # Each level declares its own variables, and reads the ones above it
+        for i in range(per_level // 2):
+            out.write(indent + "var v" + str(level) + "_" + str(i) + " : int := x + " + str(i) + ";\n")
+            if level > 0:
+                out.write(indent + "v" + str(level) + "_" + str(i) + " := v" + str(level - 1) + "_0 + 1;\n")
+            else:
+                out.write(indent + "x := x + 1;\n")
+            count += 2
+
+        if level + 1 < depth:
+            out.write(indent + "if x > " + str(level) + " then\n")
+
+    for level in reversed(range(depth - 1)):
+        out.write("    " * (level + 1) + "end\n")
+
+    out.write("    return x;\n")
+    out.write("end\n\n")
+    return count
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: symtab_stress.py <okcc> [statements] [depth] [functions]")
+        return 1
+
+    compiler = sys.argv[1]
+    statements = int(sys.argv[2]) if len(sys.argv) > 2 else 10000
+    depth = int(sys.argv[3]) if len(sys.argv) > 3 else 100
+    functions = int(sys.argv[4]) if len(sys.argv) > 4 else 4
+
+    with tempfile.TemporaryDirectory() as tmp:
+        src = os.path.join(tmp, "stress.ok")
+        total = 0
+        with open(src, "w") as out:
+            for f in range(functions):
+                total += gen_function(out, "stress" + str(f), statements, depth)
+            out.write("func main -> int is\n    return 0;\nend\n")
+
+        start = time.time()
+        result = subprocess.run([compiler, src, "-c", "-o", os.path.join(tmp, "stress.o")])
+        elapsed = time.time() - start
+
+        if result.returncode != 0:
+            print("Error: compilation failed.")
+            return 1
+
+        # ru_maxrss is in kilobytes on Linux
+        rss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+
+        print("statements: " + str(total) + " (" + str(functions) + " functions, depth " + str(depth) + ")")
+        print("time: %.3f s" % elapsed)
+        print("peak memory: %.1f MB" % (rss / 1024.0))
+
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -97,7 +97,11 @@ void AstBlock::print(int indent) {
     for (int i = 0; i<indent; i++) std::cout << " ";
     std::cout << "[" << std::endl;
     
-    for (auto const &x : symbolTable) {
+    // Only the symbols declared in this block; the rest belong to the parents
+    std::map<std::string, AstDataType *> symbols;
+    for (auto const &x : scope->symbolTable) symbols[Symbol::getName(x.first)] = x.second;
+    
+    for (auto const &x : symbols) {
         for (int i = 0; i<indent+2; i++) std::cout << " ";
         std::cout << "SYM: " << x.first << " : ";
         if (x.second) x.second->print();
@@ -116,19 +120,19 @@ void AstBlock::print(int indent) {
         for (int i = 0; i<indent; i++) std::cout << " ";
         switch (stmt->type) {
             case V_AstType::If: {
-                std::static_pointer_cast<AstIfStmt>(stmt)->print(indent);
+                static_cast<AstIfStmt *>(stmt)->print(indent);
             } break;
             case V_AstType::While: {
-                std::static_pointer_cast<AstWhileStmt>(stmt)->print(indent);
+                static_cast<AstWhileStmt *>(stmt)->print(indent);
             } break;
             case V_AstType::For: {
-                std::static_pointer_cast<AstForStmt>(stmt)->print(indent);
+                static_cast<AstForStmt *>(stmt)->print(indent);
             } break;
             case V_AstType::ForAll: {
-                std::static_pointer_cast<AstForAllStmt>(stmt)->print(indent);
+                static_cast<AstForAllStmt *>(stmt)->print(indent);
             } break;
             case V_AstType::BlockStmt: {
-                std::static_pointer_cast<AstBlockStmt>(stmt)->print(indent);
+                static_cast<AstBlockStmt *>(stmt)->print(indent);
             } break;
             
             default: stmt->print();
@@ -201,6 +205,7 @@ void AstVarDec::print() {
 void AstStructDec::print() {
     std::cout << "STRUCT " << var_name << " : " << struct_name;
     if (no_init) std::cout << " NOINIT";
+    if (on_stack) std::cout << " STACK";
     std::cout << std::endl;
 }
 
@@ -0,0 +1,77 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#include <cstdint>
+#include <cstdlib>
+
+#include <ast/arena.hpp>
+
+static thread_local std::shared_ptr<AstArena> currentArena;
+
+AstArena::AstArena(size_t chunkSize) {
+    this->chunkSize = chunkSize;
+}
+
+//
+// Destroys the objects in the reverse order they were created, and then
+// hands back the chunks
+//
+AstArena::~AstArena() {
+    for (auto it = destructors.rbegin(); it != destructors.rend(); it++) {
+        it->destroy(it->object);
+    }
+    
+    for (auto const &chunk : chunks) {
+        free(chunk.data);
+    }
+}
+
+//
+// Returns aligned memory from the current chunk, starting a new one if needed
+// Anything larger than a chunk gets a chunk of its own.
+//
+void *AstArena::allocate(size_t size, size_t align) {
+    uintptr_t ptr = ((uintptr_t)next + align - 1) & ~(uintptr_t)(align - 1);
+    
+    if (next == nullptr || ptr + size > (uintptr_t)end) {
+        size_t newSize = chunkSize;
+        if (size + align > newSize) newSize = size + align;
+        
+        char *data = (char *)malloc(newSize);
+        if (data == nullptr) throw std::bad_alloc();
+        
+        chunks.push_back({ data, newSize });
+        bytesReserved += newSize;
+        
+        next = data;
+        end = data + newSize;
+        ptr = ((uintptr_t)next + align - 1) & ~(uintptr_t)(align - 1);
+    }
+    
+    bytesUsed += size;
+    next = (char *)(ptr + size);
+    return (void *)ptr;
+}
+
+//
+// If nothing has set an arena for this thread, nodes go into one that lives
+// as long as the thread does.
+//
+AstArena *AstArena::current() {
+    if (currentArena == nullptr) {
+        static thread_local AstArena fallback;
+        return &fallback;
+    }
+    return currentArena.get();
+}
+
+AstArena::Scope::Scope(std::shared_ptr<AstArena> arena) {
+    previous = currentArena;
+    currentArena = arena;
+}
+
+AstArena::Scope::~Scope() {
+    currentArena = previous;
+}
@@ -0,0 +1,102 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//
+// Owns the memory for all the nodes of an AST
+// Nodes are bump-allocated out of large chunks, and everything is released
+// at once when the arena is destroyed. The nodes themselves only hold plain
+// pointers to each other.
+//
+class AstArena {
+public:
+    explicit AstArena(size_t chunkSize = 64 * 1024);
+    ~AstArena();
+    
+    AstArena(const AstArena &) = delete;
+    AstArena &operator=(const AstArena &) = delete;
+    
+    //
+    // Constructs a new object in this arena
+    //
+    template <typename T, typename... Args>
+    T *create(Args&&... args) {
+        void *memory = allocate(sizeof(T), alignof(T));
+        T *object = new (memory) T(std::forward<Args>(args)...);
+        
+        // Strings and vectors in the nodes still own heap memory of their own
+        if (!std::is_trivially_destructible<T>::value) {
+            destructors.push_back({ object, [](void *ptr) { static_cast<T *>(ptr)->~T(); } });
+        }
+        
+        ++objectCount;
+        return object;
+    }
+    
+    //
+    // Constructs a new object in the arena that is current for this thread
+    //
+    template <typename T, typename... Args>
+    static T *make(Args&&... args) {
+        return current()->create<T>(std::forward<Args>(args)...);
+    }
+    
+    void *allocate(size_t size, size_t align);
+    
+    size_t getObjectCount() { return objectCount; }
+    size_t getBytesUsed() { return bytesUsed; }
+    size_t getBytesReserved() { return bytesReserved; }
+    
+    //
+    // The arena new nodes go into
+    // Each thread has its own, so separate trees can be built in parallel.
+    //
+    static AstArena *current();
+    
+    //
+    // Makes an arena the current one for as long as the scope lives, and
+    // then puts back whichever one was current before
+    //
+    class Scope {
+    public:
+        explicit Scope(std::shared_ptr<AstArena> arena);
+        ~Scope();
+        
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    private:
+        std::shared_ptr<AstArena> previous;
+    };
+    
+private:
+    struct Chunk {
+        char *data;
+        size_t size;
+    };
+    
+    struct Destructor {
+        void *object;
+        void (*destroy)(void *);
+    };
+    
+    size_t chunkSize;
+    std::vector<Chunk> chunks;
+    std::vector<Destructor> destructors;
+    char *next = nullptr;
+    char *end = nullptr;
+    
+    size_t objectCount = 0;
+    size_t bytesUsed = 0;
+    size_t bytesReserved = 0;
+};
+
@@ -27,7 +27,7 @@ AstDataType::AstDataType(V_AstType type, bool _isUnsigned) : AstNode(type) {
 //
 // AstPointerType
 //
-AstPointerType::AstPointerType(std::shared_ptr<AstDataType> base_type) : AstDataType(V_AstType::Ptr) {
+AstPointerType::AstPointerType(AstDataType *base_type) : AstDataType(V_AstType::Ptr) {
     this->base_type = base_type;
 }
 
@@ -49,9 +49,10 @@ AstObjectType::AstObjectType(std::string name) : AstDataType(V_AstType::Object)
 // Var
 //
 Var::Var() {}
-Var::Var(std::shared_ptr<AstDataType> type, std::string name) {
+Var::Var(AstDataType *type, std::string name) {
     this->type = type;
     this->name = name;
+    this->id = Symbol::intern(name);
 }
 
 //
@@ -61,7 +62,7 @@ AstStruct::AstStruct(std::string name) : AstNode(V_AstType::StructDef) {
     this->name = name;
 }
 
-void AstStruct::addItem(Var var, std::shared_ptr<AstExpression> default_expression) {
+void AstStruct::addItem(Var var, AstExpression *default_expression) {
     items.push_back(var);
     default_expressions[var.name] = default_expression;
     
@@ -83,13 +84,16 @@ void AstStruct::addItem(Var var, std::shared_ptr<AstExpression> default_expressi
 //
 // AstTree
 //
-AstTree::AstTree(std::string file) {
+AstTree::AstTree(std::string file, std::shared_ptr<AstArena> arena) {
     this-> file = file;
-    this->block = std::make_shared<AstBlock>();
+    
+    // Every tree has an arena of its own, unless it's given one to share
+    this->arena = arena ? arena : std::make_shared<AstArena>();
+    
+    AstArena::Scope scope(this->arena);
+    this->block = AstArena::make<AstBlock>();
 }
 
-AstTree::~AstTree() {}
-
 bool AstTree::hasStruct(std::string name) {
     for (auto const &s : structs) {
         if (s->name == name) return true;
@@ -100,15 +104,15 @@ bool AstTree::hasStruct(std::string name) {
 //
 // AstBlock
 //
-void AstBlock::addStatement(std::shared_ptr<AstStatement> stmt) {
+void AstBlock::addStatement(AstStatement *stmt) {
     block.push_back(stmt);
 }
 
-void AstBlock::addStatements(std::vector<std::shared_ptr<AstStatement>> block) {
+void AstBlock::addStatements(std::vector<AstStatement *> block) {
     this->block = block;
 }
 
-std::vector<std::shared_ptr<AstStatement>> AstBlock::getBlock() {
+std::vector<AstStatement *> AstBlock::getBlock() {
     return block;
 }
 
@@ -116,7 +120,7 @@ size_t AstBlock::getBlockSize() {
     return block.size();
 }
 
-std::shared_ptr<AstStatement> AstBlock::getStatementAt(size_t i) {
+AstStatement *AstBlock::getStatementAt(size_t i) {
     return block.at(i);
 }
 
@@ -124,70 +128,148 @@ void AstBlock::removeAt(size_t pos) {
     block.erase(block.begin() + pos);
 }
 
-void AstBlock::insertAt(std::shared_ptr<AstStatement> stmt, size_t pos) {
+void AstBlock::insertAt(AstStatement *stmt, size_t pos) {
     block.insert(block.begin() + pos, stmt);
 }
 
-void AstBlock::addSymbol(std::string name, std::shared_ptr<AstDataType> dataType) {
-    symbolTable[name] = dataType;
-    vars.push_back(name);
+void AstBlock::addSymbol(std::string name, AstDataType *dataType) {
+    scope->symbolTable[Symbol::intern(name)] = dataType;
+}
+
+void AstBlock::addConstant(std::string name, AstDataType *dataType, AstExpression *expr, bool isGlobal) {
+    auto value = std::pair<AstDataType *, AstExpression *>(dataType, expr);
+    if (isGlobal) scope->globalConsts[Symbol::intern(name)] = value;
+    else scope->localConsts[Symbol::intern(name)] = value;
+}
+
+void AstBlock::addFunc(std::string name) {
+    scope->funcs.insert(Symbol::intern(name));
+}
+
+//
+// Makes the symbols of the parent block visible in this one
+// Nothing is copied; lookups that miss in this block just continue upwards.
+//
+void AstBlock::setParent(AstBlock *parent) {
+    scope->parent = parent->scope;
 }
 
-void AstBlock::mergeSymbols(std::shared_ptr<AstBlock> parent) {
-    // Scoped variables
-    auto map = parent->getSymbolTable();
-    for (auto const &element : map) {
-        symbolTable[element.first] = element.second;
-        vars.push_back(element.first);
+//
+// Copies the symbols declared directly in another block into this one
+// This is used for imports, where the other tree is not a parent.
+//
+void AstBlock::mergeSymbols(AstBlock *other) {
+    for (auto const &element : other->scope->symbolTable) {
+        scope->symbolTable[element.first] = element.second;
     }
     
-    // Global constants
-    for (auto const &element : parent->globalConsts) {
-        globalConsts[element.first] = element.second;
+    for (auto const &element : other->scope->globalConsts) {
+        scope->globalConsts[element.first] = element.second;
     }
     
-    // Scoped constants
-    for (auto const &element : parent->localConsts) {
-        localConsts[element.first] = element.second;
+    for (auto const &element : other->scope->localConsts) {
+        scope->localConsts[element.first] = element.second;
     }
     
-    // Functions
-    auto parent_funcs = parent->funcs;
-    for (auto func : parent_funcs) {
-        this->funcs.push_back(func);
+    for (auto const &func : other->scope->funcs) {
+        scope->funcs.insert(func);
     }
 }
 
-std::map<std::string, std::shared_ptr<AstDataType>> AstBlock::getSymbolTable() {
-    return symbolTable;
+//
+// The lookups can be done either by name or by interned id
+// The id versions skip hashing the string, so use them when the id is on hand.
+// A name that was never interned can't be in any scope, so the string
+// versions only look it up rather than adding it to the symbol table.
+//
+AstDataType *AstBlock::getDataType(std::string name) {
+    SymbolId id;
+    if (!Symbol::find(name, id)) return nullptr;
+    return scope->getDataType(id);
+}
+
+AstDataType *AstBlock::getDataType(SymbolId name) {
+    return scope->getDataType(name);
+}
+
+AstExpression *AstBlock::getConstant(std::string name) {
+    SymbolId id;
+    if (!Symbol::find(name, id)) return nullptr;
+    return scope->getConstant(id);
 }
 
-std::shared_ptr<AstDataType> AstBlock::getDataType(std::string name) {
-    return symbolTable[name];
+AstExpression *AstBlock::getConstant(SymbolId name) {
+    return scope->getConstant(name);
 }
 
 bool AstBlock::isVar(std::string name) {
-    if (std::find(vars.begin(), vars.end(), name) != vars.end()) {
-        return true;
-    }
-    return false;
+    SymbolId id;
+    return Symbol::find(name, id) && scope->isVar(id);
+}
+
+bool AstBlock::isVar(SymbolId name) {
+    return scope->isVar(name);
 }
 
 int AstBlock::isConstant(std::string name) {
-    if (globalConsts.find(name) != globalConsts.end()) {
-        return 1;
+    SymbolId id;
+    if (!Symbol::find(name, id)) return 0;
+    return scope->isConstant(id);
+}
+
+int AstBlock::isConstant(SymbolId name) {
+    return scope->isConstant(name);
+}
+
+bool AstBlock::isFunc(std::string name) {
+    SymbolId id;
+    return Symbol::find(name, id) && scope->isFunc(id);
+}
+
+bool AstBlock::isFunc(SymbolId name) {
+    return scope->isFunc(name);
+}
+
+//
+// AstScope
+//
+AstDataType *AstScope::getDataType(SymbolId name) {
+    for (AstScope *current = this; current; current = current->parent) {
+        auto entry = current->symbolTable.find(name);
+        if (entry != current->symbolTable.end()) return entry->second;
     }
-    
-    if (localConsts.find(name) != localConsts.end()) {
-        return 2;
+    return nullptr;
+}
+
+AstExpression *AstScope::getConstant(SymbolId name) {
+    for (AstScope *current = this; current; current = current->parent) {
+        auto entry = current->globalConsts.find(name);
+        if (entry != current->globalConsts.end()) return entry->second.second;
+        
+        entry = current->localConsts.find(name);
+        if (entry != current->localConsts.end()) return entry->second.second;
+    }
+    return nullptr;
+}
+
+bool AstScope::isVar(SymbolId name) {
+    for (AstScope *current = this; current; current = current->parent) {
+        if (current->symbolTable.find(name) != current->symbolTable.end()) return true;
+    }
+    return false;
+}
+
+int AstScope::isConstant(SymbolId name) {
+    for (AstScope *current = this; current; current = current->parent) {
+        if (current->globalConsts.find(name) != current->globalConsts.end()) return 1;
+        if (current->localConsts.find(name) != current->localConsts.end()) return 2;
     }
-    
     return 0;
 }
 
-bool AstBlock::isFunc(std::string name) {
-    if (std::find(funcs.begin(), funcs.end(), name) != funcs.end()) {
-        return true;
+bool AstScope::isFunc(SymbolId name) {
+    for (AstScope *current = this; current; current = current->parent) {
+        if (current->funcs.find(name) != current->funcs.end()) return true;
     }
     return false;
 }
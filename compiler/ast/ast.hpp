@@ -9,6 +9,11 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <ast/symbol.hpp>
+#include <ast/arena.hpp>
 
 //
 // Contains the variants for all AST nodes
@@ -106,6 +111,9 @@ enum class V_AstType {
     Object
 };
 
+// The name of a node type, for debugging and reports
+std::string getAstTypeName(V_AstType type);
+
 //
 // Attributes needed by some languages
 //
@@ -147,10 +155,10 @@ struct AstDataType : AstNode {
 
 // Represents a pointer type
 struct AstPointerType : AstDataType {
-    explicit AstPointerType(std::shared_ptr<AstDataType> base_type); 
+    explicit AstPointerType(AstDataType *base_type); 
     void print() override;
     
-    std::shared_ptr<AstDataType> base_type = nullptr;
+    AstDataType *base_type = nullptr;
 };
 
 // Represents a structure type
@@ -172,10 +180,11 @@ struct AstObjectType : AstDataType {
 // Var
 struct Var {
     explicit Var();
-    explicit Var(std::shared_ptr<AstDataType> type, std::string name = "");
+    explicit Var(AstDataType *type, std::string name = "");
     
     std::string name;
-    std::shared_ptr<AstDataType> type;
+    SymbolId id = 0;
+    AstDataType *type = nullptr;
 };
 
 //
@@ -185,7 +194,7 @@ struct Var {
 struct AstStruct : AstNode {
     explicit AstStruct(std::string name);
     
-    void addItem(Var var, std::shared_ptr<AstExpression> default_expression);
+    void addItem(Var var, AstExpression *default_expression);
     
     void print();
     std::string dot(std::string parent);
@@ -193,7 +202,7 @@ struct AstStruct : AstNode {
     // Member variables
     std::string name;
     std::vector<Var> items;
-    std::map<std::string, std::shared_ptr<AstExpression>> default_expressions;
+    std::map<std::string, AstExpression *> default_expressions;
     int size = 0;
 };
 
@@ -206,14 +215,14 @@ struct AstClass {
         this->name = name;
     }
     
-    void addFunction(std::shared_ptr<AstFunction> func) {
+    void addFunction(AstFunction *func) {
         functions.push_back(func);
     }
     
     void print();
     
     std::string name = "";
-    std::vector<std::shared_ptr<AstFunction>> functions;
+    std::vector<AstFunction *> functions;
 };
 
 //
@@ -222,47 +231,74 @@ struct AstClass {
 //
 struct AstEnum {
     std::string name;
-    std::shared_ptr<AstDataType> type;
-    std::map<std::string, std::shared_ptr<AstExpression>> values;
+    AstDataType *type = nullptr;
+    std::map<std::string, AstExpression *> values;
 };
 
 //
 // Represents an AstBlock
 // Blocks hold tables and symbol information
 //
+//
+// AstScope
+// Holds the symbols declared in a single block. Anything not found here is
+// looked up through the parent, so nested blocks never copy the tables above them.
+//
+struct AstScope {
+    explicit AstScope(AstScope *parent = nullptr) {
+        this->parent = parent;
+    }
+    
+    AstDataType *getDataType(SymbolId name);
+    AstExpression *getConstant(SymbolId name);
+    bool isVar(SymbolId name);
+    int isConstant(SymbolId name);
+    bool isFunc(SymbolId name);
+    
+    // Members
+    AstScope *parent = nullptr;
+    std::unordered_map<SymbolId, AstDataType *> symbolTable;
+    std::unordered_map<SymbolId, std::pair<AstDataType *, AstExpression *>> globalConsts;
+    std::unordered_map<SymbolId, std::pair<AstDataType *, AstExpression *>> localConsts;
+    std::unordered_set<SymbolId> funcs;
+};
+
 struct AstBlock : AstNode {
     AstBlock() : AstNode(V_AstType::Block) {}
 
-    void addStatement(std::shared_ptr<AstStatement> stmt);
-    void addStatements(std::vector<std::shared_ptr<AstStatement>> block);
-    std::vector<std::shared_ptr<AstStatement>> getBlock();
+    void addStatement(AstStatement *stmt);
+    void addStatements(std::vector<AstStatement *> block);
+    std::vector<AstStatement *> getBlock();
     
     size_t getBlockSize();
-    std::shared_ptr<AstStatement> getStatementAt(size_t i);
+    AstStatement *getStatementAt(size_t i);
     
     void removeAt(size_t pos);
-    void insertAt(std::shared_ptr<AstStatement> stmt, size_t pos);
-    
-    void addSymbol(std::string name, std::shared_ptr<AstDataType> dataType);
-    void mergeSymbols(std::shared_ptr<AstBlock> parent);
-    std::map<std::string, std::shared_ptr<AstDataType>> getSymbolTable();
-    std::shared_ptr<AstDataType> getDataType(std::string name);
+    void insertAt(AstStatement *stmt, size_t pos);
+    
+    void addSymbol(std::string name, AstDataType *dataType);
+    void addConstant(std::string name, AstDataType *dataType, AstExpression *expr, bool isGlobal);
+    void addFunc(std::string name);
+    void setParent(AstBlock *parent);
+    void mergeSymbols(AstBlock *other);
+    AstDataType *getDataType(std::string name);
+    AstDataType *getDataType(SymbolId name);
+    AstExpression *getConstant(std::string name);
+    AstExpression *getConstant(SymbolId name);
     
     bool isVar(std::string name);
+    bool isVar(SymbolId name);
     int isConstant(std::string name);
+    int isConstant(SymbolId name);
     bool isFunc(std::string name);
+    bool isFunc(SymbolId name);
     
     void print(int indent = 4);
     std::string dot(std::string parent);
     
     // Members
-    std::vector<std::shared_ptr<AstStatement>> block;
-    std::map<std::string, std::shared_ptr<AstDataType>> symbolTable;
-    std::vector<std::string> vars;
-    
-    std::map<std::string, std::pair<std::shared_ptr<AstDataType>, std::shared_ptr<AstExpression>>> globalConsts;
-    std::map<std::string, std::pair<std::shared_ptr<AstDataType>, std::shared_ptr<AstExpression>>> localConsts;
-    std::vector<std::string> funcs;
+    std::vector<AstStatement *> block;
+    AstScope *scope = AstArena::make<AstScope>();
 };
 
 //
@@ -283,12 +319,12 @@ struct AstExpression : AstNode {
 // Holds a list of expressions
 struct AstExprList : AstExpression {
     AstExprList() : AstExpression(V_AstType::ExprList) {}
-    void add_expression(std::shared_ptr<AstExpression> expr) { list.push_back(expr); }
+    void add_expression(AstExpression *expr) { list.push_back(expr); }
     
     void print();
     std::string dot(std::string parent) override;
     
-    std::vector<std::shared_ptr<AstExpression>> list;
+    std::vector<AstExpression *> list;
 };
 
 // Represents the base of operators
@@ -308,7 +344,7 @@ struct AstUnaryOp : AstOp {
     virtual void print() {}
     virtual std::string dot(std::string parent) { return ""; }
     
-    std::shared_ptr<AstExpression> value;
+    AstExpression *value = nullptr;
 };
 
 // Represents a negate expression
@@ -326,8 +362,8 @@ struct AstBinaryOp : AstOp {
     virtual void print() {}
     virtual std::string dot(std::string parent) { return ""; }
     
-    std::shared_ptr<AstExpression> lval;
-    std::shared_ptr<AstExpression> rval;
+    AstExpression *lval = nullptr;
+    AstExpression *rval = nullptr;
     int precedence = 0;
 };
 
@@ -338,7 +374,7 @@ struct AstAssignOp : AstBinaryOp {
         this->precedence = 16;
     }
     
-    explicit AstAssignOp(std::shared_ptr<AstExpression> lval, std::shared_ptr<AstExpression> rval) {
+    explicit AstAssignOp(AstExpression *lval, AstExpression *rval) {
         this->type = V_AstType::Assign;
         this->precedence = 16;
         this->lval = lval;
@@ -607,12 +643,22 @@ struct AstString : AstExpression {
 struct AstID: AstExpression {
     explicit AstID(std::string val) : AstExpression(V_AstType::ID) {
         this->value = val;
+        this->id = Symbol::intern(val);
+    }
+    
+    explicit AstID(std::string val, SymbolId id) : AstExpression(V_AstType::ID) {
+        this->value = val;
+        this->id = id;
     }
     
     void print();
     std::string dot(std::string parent) override;
     
     std::string value = "";
+    SymbolId id = 0;
+    
+    // The frame slot, filled in by the interpreter
+    int slot = -1;
 };
 
 
@@ -620,24 +666,28 @@ struct AstID: AstExpression {
 struct AstFuncRef : AstExpression {
     explicit AstFuncRef(std::string value) : AstExpression(V_AstType::FuncRef) {
         this->value = value;
+        this->id = Symbol::intern(value);
     }
     
     void print();
     std::string dot(std::string parent) override;
     
     std::string value = "";
+    SymbolId id = 0;
 };
 
 // Represents a pointer to something
 struct AstPtrTo : AstExpression {
     explicit AstPtrTo(std::string value) : AstExpression(V_AstType::PtrTo) {
         this->value = value;
+        this->id = Symbol::intern(value);
     }
     
     void print();
     std::string dot(std::string parent) override;
     
     std::string value = "";
+    SymbolId id = 0;
 };
 
 
@@ -645,18 +695,21 @@ struct AstPtrTo : AstExpression {
 struct AstRef : AstExpression {
     explicit AstRef(std::string value) : AstExpression(V_AstType::Ref) {
         this->value = value;
+        this->id = Symbol::intern(value);
     }
     
     void print();
     std::string dot(std::string parent) override;
     
     std::string value = "";
+    SymbolId id = 0;
 };
 
 // Represents an array access
 struct AstArrayAccess : AstExpression {
     explicit AstArrayAccess(std::string value) : AstExpression(V_AstType::ArrayAccess) {
         this->value = value;
+        this->id = Symbol::intern(value);
     }
     
     void print();
@@ -664,7 +717,11 @@ struct AstArrayAccess : AstExpression {
     
     // Member variables
     std::string value = "";
-    std::shared_ptr<AstExpression> index;
+    SymbolId id = 0;
+    AstExpression *index = nullptr;
+    
+    // The frame slot, filled in by the interpreter
+    int slot = -1;
 };
 
 // Represents a structure access
@@ -672,6 +729,7 @@ struct AstStructAccess : AstExpression {
     explicit AstStructAccess(std::string var, std::string member) : AstExpression(V_AstType::StructAccess) {
         this->var = var;
         this->member = member;
+        this->var_id = Symbol::intern(var);
     }
 
     void print();
@@ -680,36 +738,44 @@ struct AstStructAccess : AstExpression {
     // Member variables
     std::string var = "";
     std::string member = "";
+    SymbolId var_id = 0;
     
     // TODO: I don't love this
     // This is specific for members that are arrays
-    std::shared_ptr<AstExpression> access_expression = nullptr;
+    AstExpression *access_expression = nullptr;
 };
 
 // Represents a function call
 struct AstFuncCallExpr : AstExpression {
     explicit AstFuncCallExpr(std::string name) : AstExpression(V_AstType::FuncCallExpr) {
         this->name = name;
+        this->id = Symbol::intern(name);
+    }
+    
+    explicit AstFuncCallExpr(std::string name, SymbolId id) : AstExpression(V_AstType::FuncCallExpr) {
+        this->name = name;
+        this->id = id;
     }
     
     void print();
     std::string dot(std::string parent) override;
     
     // Member variables
-    std::shared_ptr<AstExpression> args;
+    AstExpression *args = nullptr;
     std::string name = "";
+    SymbolId id = 0;
     std::string object_name;
 };
 
 // Represents the sizeof operator
 struct AstSizeof : AstExpression {
-    explicit AstSizeof(std::shared_ptr<AstID> value) : AstExpression(V_AstType::Sizeof) {
+    explicit AstSizeof(AstID *value) : AstExpression(V_AstType::Sizeof) {
         this->value = value;
     }
     
     void print();
 
-    std::shared_ptr<AstID> value;
+    AstID *value = nullptr;
 };
 
 //
@@ -727,7 +793,7 @@ struct AstStatement : AstNode {
     virtual void print() {}
     virtual std::string dot(std::string parent) { return ""; }
     
-    std::shared_ptr<AstExpression> expression = nullptr;
+    AstExpression *expression = nullptr;
 };
 
 // Represents an extern function
@@ -744,7 +810,7 @@ struct AstExternFunction : AstStatement {
     // Member variables
     std::string name = "";
     std::vector<Var> args;
-    std::shared_ptr<AstDataType> data_type;
+    AstDataType *data_type = nullptr;
     bool varargs = false;
 };
 
@@ -752,16 +818,16 @@ struct AstExternFunction : AstStatement {
 struct AstFunction : AstStatement {
     explicit AstFunction(std::string name) : AstStatement(V_AstType::Func) {
         this->name = name;
-        block = std::make_shared<AstBlock>();
+        block = AstArena::make<AstBlock>();
     }
     
-    explicit AstFunction(std::string name, std::shared_ptr<AstDataType> data_type) : AstStatement(V_AstType::Func) {
+    explicit AstFunction(std::string name, AstDataType *data_type) : AstStatement(V_AstType::Func) {
         this->name = name;
         this->data_type = data_type;
-        block = std::make_shared<AstBlock>();
+        block = AstArena::make<AstBlock>();
     }
     
-    void addStatement(std::shared_ptr<AstStatement> statement) {
+    void addStatement(AstStatement *statement) {
         block->addStatement(statement);
     }
     
@@ -771,8 +837,8 @@ struct AstFunction : AstStatement {
     // Member variables
     std::string name = "";
     std::vector<Var> args;
-    std::shared_ptr<AstBlock> block;
-    std::shared_ptr<AstDataType> data_type;
+    AstBlock *block = nullptr;
+    AstDataType *data_type = nullptr;
     std::string dtName = "";
     
     // These attributes are language specific
@@ -785,7 +851,7 @@ struct AstFunction : AstStatement {
 struct AstBlockStmt : AstStatement {
     explicit AstBlockStmt(std::string name = "") : AstStatement(V_AstType::BlockStmt) {
         this->name = name;
-        block = std::make_shared<AstBlock>();
+        block = AstArena::make<AstBlock>();
     }
     
     void print(int indent = 0);
@@ -794,7 +860,7 @@ struct AstBlockStmt : AstStatement {
     // Member variables
     std::string name = "";
     std::vector<std::string> clauses;
-    std::shared_ptr<AstBlock> block;
+    AstBlock *block = nullptr;
 };
 
 // Represents an AST expression statement
@@ -802,16 +868,16 @@ struct AstBlockStmt : AstStatement {
 struct AstExprStatement : AstStatement {
     explicit AstExprStatement() : AstStatement(V_AstType::ExprStmt) {}
     
-    void setDataType(std::shared_ptr<AstDataType> dataType) {
+    void setDataType(AstDataType *dataType) {
         this->dataType = dataType;
     }
     
-    std::shared_ptr<AstDataType> getDataType() { return dataType; }
+    AstDataType *getDataType() { return dataType; }
     
     void print();
     std::string dot(std::string parent) override;
     
-    std::shared_ptr<AstDataType> dataType;
+    AstDataType *dataType = nullptr;
     
     // Language-specific attributes
     // TODO: I would like to eventually get rid of this
@@ -822,6 +888,7 @@ struct AstExprStatement : AstStatement {
 struct AstFuncCallStmt : AstStatement {
     explicit AstFuncCallStmt(std::string name) : AstStatement(V_AstType::FuncCallStmt) {
         this->name = name;
+        this->id = Symbol::intern(name);
     }
     
     std::string getName() { return name; }
@@ -829,6 +896,7 @@ struct AstFuncCallStmt : AstStatement {
     std::string dot(std::string parent) override;
     
     std::string name = "";
+    SymbolId id = 0;
     
     // Language-specific attributes
     std::string object_name = "";
@@ -844,8 +912,9 @@ struct AstReturnStmt : AstStatement {
 
 // Represents a variable declaration
 struct AstVarDec : AstStatement {
-    explicit AstVarDec(std::string name, std::shared_ptr<AstDataType> data_type) : AstStatement(V_AstType::VarDec) {
+    explicit AstVarDec(std::string name, AstDataType *data_type) : AstStatement(V_AstType::VarDec) {
         this->name = name;
+        this->id = Symbol::intern(name);
         this->data_type = data_type;
     }
     
@@ -853,7 +922,11 @@ struct AstVarDec : AstStatement {
     std::string dot(std::string parent) override;
     
     std::string name = "";
-    std::shared_ptr<AstDataType> data_type;
+    SymbolId id = 0;
+    AstDataType *data_type = nullptr;
+    
+    // The frame slot, filled in by the interpreter
+    int slot = -1;
     
     // Language-specific attributes
     std::string class_name = "";
@@ -864,6 +937,7 @@ struct AstStructDec : AstStatement {
     explicit AstStructDec(std::string var_name, std::string struct_name) : AstStatement(V_AstType::StructDec) {
         this->var_name = var_name;
         this->struct_name = struct_name;
+        this->var_id = Symbol::intern(var_name);
     }
     
     void print();
@@ -871,7 +945,11 @@ struct AstStructDec : AstStatement {
     
     std::string var_name = "";
     std::string struct_name = "";
+    SymbolId var_id = 0;
     bool no_init = false;
+    
+    // Set by the escape analysis when the structure never leaves its function
+    bool on_stack = false;
 };
 
 // Represents a conditional statement
@@ -881,8 +959,8 @@ struct AstIfStmt : AstStatement {
     void print(int indent);
     std::string dot(std::string parent) override;
     
-    std::shared_ptr<AstBlock> true_block = nullptr;
-    std::shared_ptr<AstBlock> false_block = nullptr;
+    AstBlock *true_block = nullptr;
+    AstBlock *false_block = nullptr;
 };
 
 // Represents a while statement
@@ -892,7 +970,7 @@ struct AstWhileStmt : AstStatement {
     void print(int indent = 0);
     std::string dot(std::string parent) override;
 
-    std::shared_ptr<AstBlock> block = nullptr;
+    AstBlock *block = nullptr;
 };
 
 // Represents an infinite loop statement
@@ -901,24 +979,24 @@ struct AstRepeatStmt : public AstStatement {
     
     void print(int indent = 0);
     
-    std::shared_ptr<AstBlock> block = nullptr;
+    AstBlock *block = nullptr;
 };
 
 // Represents a for loop
 struct AstForStmt : public AstStatement {
     explicit AstForStmt() : AstStatement(V_AstType::For) {
-        step = std::make_shared<AstInt>(1);
-        block = std::make_shared<AstBlock>();
+        step = AstArena::make<AstInt>(1);
+        block = AstArena::make<AstBlock>();
     }
     
     void print(int indent = 0);
     
-    std::shared_ptr<AstID> index;
-    std::shared_ptr<AstExpression> start;
-    std::shared_ptr<AstExpression> end;
-    std::shared_ptr<AstExpression> step;
-    std::shared_ptr<AstDataType> data_type;
-    std::shared_ptr<AstBlock> block = nullptr;
+    AstID *index = nullptr;
+    AstExpression *start = nullptr;
+    AstExpression *end = nullptr;
+    AstExpression *step = nullptr;
+    AstDataType *data_type = nullptr;
+    AstBlock *block = nullptr;
 };
 
 // Represents a for-all loop
@@ -927,10 +1005,10 @@ struct AstForAllStmt : public AstStatement {
     
     void print(int indent = 0);
     
-    std::shared_ptr<AstID> index;
-    std::shared_ptr<AstID> array;
-    std::shared_ptr<AstBlock> block = nullptr;
-    std::shared_ptr<AstDataType> data_type;
+    AstID *index = nullptr;
+    AstID *array = nullptr;
+    AstBlock *block = nullptr;
+    AstDataType *data_type = nullptr;
 };
 
 // Represents a break statement for a loop
@@ -951,28 +1029,36 @@ struct AstContinue : AstStatement {
 // Represents an AST tree
 //
 struct AstTree {
-    explicit AstTree(std::string file);
-    ~AstTree();
+    explicit AstTree(std::string file, std::shared_ptr<AstArena> arena = nullptr);
     bool hasStruct(std::string name);
     
-    void addGlobalStatement(std::shared_ptr<AstStatement> stmt) {
+    void addGlobalStatement(AstStatement *stmt) {
         block->addStatement(stmt);
     }
     
-    void addStruct(std::shared_ptr<AstStruct> s) {
+    void addStruct(AstStruct *s) {
         structs.push_back(s);
     }
     
-    void addClass(std::shared_ptr<AstClass> c) {
+    void addClass(AstClass *c) {
         classes.push_back(c);
     }
     
     void print();
     void dot();
     
+    // astcount.cpp
+    std::map<V_AstType, size_t> countNodes();
+    
     std::string file = "";
-    std::shared_ptr<AstBlock> block;
-    std::vector<std::shared_ptr<AstStruct>> structs;
-    std::vector<std::shared_ptr<AstClass>> classes;
+    AstBlock *block = nullptr;
+    std::vector<AstStruct *> structs;
+    std::vector<AstClass *> classes;
+    
+    // Owns every node in the tree
+    std::shared_ptr<AstArena> arena;
+    
+    // The arenas of other trees that this one still has nodes from
+    std::vector<std::shared_ptr<AstArena>> borrowed;
 };
 
@@ -13,61 +13,61 @@ namespace AstBuilder {
 //
 // The builders for data types
 //
-std::shared_ptr<AstDataType> buildVoidType() {
-    return std::make_shared<AstDataType>(V_AstType::Void);
+AstDataType *buildVoidType() {
+    return AstArena::make<AstDataType>(V_AstType::Void);
 }
 
-std::shared_ptr<AstDataType> buildBoolType() {
-    return std::make_shared<AstDataType>(V_AstType::Bool);
+AstDataType *buildBoolType() {
+    return AstArena::make<AstDataType>(V_AstType::Bool);
 }
 
-std::shared_ptr<AstDataType> buildCharType() {
-    return std::make_shared<AstDataType>(V_AstType::Char);
+AstDataType *buildCharType() {
+    return AstArena::make<AstDataType>(V_AstType::Char);
 }
 
-std::shared_ptr<AstDataType> buildInt8Type(bool isUnsigned) {
-    return std::make_shared<AstDataType>(V_AstType::Int8, isUnsigned);
+AstDataType *buildInt8Type(bool isUnsigned) {
+    return AstArena::make<AstDataType>(V_AstType::Int8, isUnsigned);
 }
 
-std::shared_ptr<AstDataType> buildInt16Type(bool isUnsigned) {
-    return std::make_shared<AstDataType>(V_AstType::Int16, isUnsigned);
+AstDataType *buildInt16Type(bool isUnsigned) {
+    return AstArena::make<AstDataType>(V_AstType::Int16, isUnsigned);
 }
 
-std::shared_ptr<AstDataType> buildInt32Type(bool isUnsigned) {
-    return std::make_shared<AstDataType>(V_AstType::Int32, isUnsigned);
+AstDataType *buildInt32Type(bool isUnsigned) {
+    return AstArena::make<AstDataType>(V_AstType::Int32, isUnsigned);
 }
 
-std::shared_ptr<AstDataType> buildInt64Type(bool isUnsigned) {
-    return std::make_shared<AstDataType>(V_AstType::Int64, isUnsigned);
+AstDataType *buildInt64Type(bool isUnsigned) {
+    return AstArena::make<AstDataType>(V_AstType::Int64, isUnsigned);
 }
 
-std::shared_ptr<AstDataType> buildFloat32Type() {
-    return std::make_shared<AstDataType>(V_AstType::Float32);
+AstDataType *buildFloat32Type() {
+    return AstArena::make<AstDataType>(V_AstType::Float32);
 }
 
-std::shared_ptr<AstDataType> buildFloat64Type() {
-    return std::make_shared<AstDataType>(V_AstType::Float64);
+AstDataType *buildFloat64Type() {
+    return AstArena::make<AstDataType>(V_AstType::Float64);
 }
 
-std::shared_ptr<AstDataType> buildStringType() {
-    return std::make_shared<AstDataType>(V_AstType::String);
+AstDataType *buildStringType() {
+    return AstArena::make<AstDataType>(V_AstType::String);
 }
 
-std::shared_ptr<AstPointerType> buildPointerType(std::shared_ptr<AstDataType> base) {
-    return std::make_shared<AstPointerType>(base);
+AstPointerType *buildPointerType(AstDataType *base) {
+    return AstArena::make<AstPointerType>(base);
 }
 
-std::shared_ptr<AstPointerType> buildInt32PointerType() {
+AstPointerType *buildInt32PointerType() {
     auto base = buildInt32Type();
     return buildPointerType(base);
 }
 
-std::shared_ptr<AstStructType> buildStructType(std::string name) {
-    return std::make_shared<AstStructType>(name);
+AstStructType *buildStructType(std::string name) {
+    return AstArena::make<AstStructType>(name);
 }
 
-std::shared_ptr<AstObjectType> buildObjectType(std::string name) {
-    return std::make_shared<AstObjectType>(name);
+AstObjectType *buildObjectType(std::string name) {
+    return AstArena::make<AstObjectType>(name);
 }
 
 } // End AstBuilder
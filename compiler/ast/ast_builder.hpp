@@ -15,20 +15,20 @@ namespace AstBuilder {
 //
 // The builders for data types
 //
-std::shared_ptr<AstDataType> buildVoidType();
-std::shared_ptr<AstDataType> buildBoolType();
-std::shared_ptr<AstDataType> buildCharType();
-std::shared_ptr<AstDataType> buildInt8Type(bool isUnsigned = false);
-std::shared_ptr<AstDataType> buildInt16Type(bool isUnsigned = false);
-std::shared_ptr<AstDataType> buildInt32Type(bool isUnsigned = false);
-std::shared_ptr<AstDataType> buildInt64Type(bool isUnsigned = false);
-std::shared_ptr<AstDataType> buildFloat32Type();
-std::shared_ptr<AstDataType> buildFloat64Type();
-std::shared_ptr<AstDataType> buildStringType();
-std::shared_ptr<AstPointerType> buildPointerType(std::shared_ptr<AstDataType> base);
-std::shared_ptr<AstPointerType> buildInt32PointerType();
-std::shared_ptr<AstStructType> buildStructType(std::string name);
-std::shared_ptr<AstObjectType> buildObjectType(std::string name);
+AstDataType *buildVoidType();
+AstDataType *buildBoolType();
+AstDataType *buildCharType();
+AstDataType *buildInt8Type(bool isUnsigned = false);
+AstDataType *buildInt16Type(bool isUnsigned = false);
+AstDataType *buildInt32Type(bool isUnsigned = false);
+AstDataType *buildInt64Type(bool isUnsigned = false);
+AstDataType *buildFloat32Type();
+AstDataType *buildFloat64Type();
+AstDataType *buildStringType();
+AstPointerType *buildPointerType(AstDataType *base);
+AstPointerType *buildInt32PointerType();
+AstStructType *buildStructType(std::string name);
+AstObjectType *buildObjectType(std::string name);
 
 }
 
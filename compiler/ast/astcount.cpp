@@ -0,0 +1,187 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#include <ast/ast.hpp>
+
+std::string getAstTypeName(V_AstType type) {
+    switch (type) {
+        case V_AstType::None: return "None";
+        
+        case V_AstType::ExternFunc: return "ExternFunc";
+        case V_AstType::Func: return "Func";
+        case V_AstType::StructDef: return "StructDef";
+        case V_AstType::Block: return "Block";
+        
+        case V_AstType::Return: return "Return";
+        case V_AstType::ExprStmt: return "ExprStmt";
+        case V_AstType::BlockStmt: return "BlockStmt";
+        case V_AstType::FuncCallStmt: return "FuncCallStmt";
+        case V_AstType::VarDec: return "VarDec";
+        case V_AstType::StructDec: return "StructDec";
+        case V_AstType::If: return "If";
+        case V_AstType::While: return "While";
+        case V_AstType::Repeat: return "Repeat";
+        case V_AstType::For: return "For";
+        case V_AstType::ForAll: return "ForAll";
+        case V_AstType::Break: return "Break";
+        case V_AstType::Continue: return "Continue";
+        
+        case V_AstType::Neg: return "Neg";
+        case V_AstType::Assign: return "Assign";
+        case V_AstType::Add: return "Add";
+        case V_AstType::Sub: return "Sub";
+        case V_AstType::Mul: return "Mul";
+        case V_AstType::Div: return "Div";
+        case V_AstType::Mod: return "Mod";
+        case V_AstType::And: return "And";
+        case V_AstType::Or: return "Or";
+        case V_AstType::Xor: return "Xor";
+        case V_AstType::Lsh: return "Lsh";
+        case V_AstType::Rsh: return "Rsh";
+        case V_AstType::EQ: return "EQ";
+        case V_AstType::NEQ: return "NEQ";
+        case V_AstType::GT: return "GT";
+        case V_AstType::LT: return "LT";
+        case V_AstType::GTE: return "GTE";
+        case V_AstType::LTE: return "LTE";
+        case V_AstType::LogicalAnd: return "LogicalAnd";
+        case V_AstType::LogicalOr: return "LogicalOr";
+        case V_AstType::Sizeof: return "Sizeof";
+        
+        case V_AstType::CharL: return "CharL";
+        case V_AstType::IntL: return "IntL";
+        case V_AstType::FloatL: return "FloatL";
+        case V_AstType::StringL: return "StringL";
+        case V_AstType::ID: return "ID";
+        case V_AstType::ArrayAccess: return "ArrayAccess";
+        case V_AstType::StructAccess: return "StructAccess";
+        case V_AstType::ExprList: return "ExprList";
+        case V_AstType::FuncCallExpr: return "FuncCallExpr";
+        case V_AstType::FuncRef: return "FuncRef";
+        case V_AstType::PtrTo: return "PtrTo";
+        case V_AstType::Ref: return "Ref";
+        
+        case V_AstType::Void: return "Void";
+        case V_AstType::Bool: return "Bool";
+        case V_AstType::Char: return "Char";
+        case V_AstType::Int8: return "Int8";
+        case V_AstType::Int16: return "Int16";
+        case V_AstType::Int32: return "Int32";
+        case V_AstType::Int64: return "Int64";
+        case V_AstType::Float32: return "Float32";
+        case V_AstType::Float64: return "Float64";
+        case V_AstType::String: return "String";
+        case V_AstType::Ptr: return "Ptr";
+        case V_AstType::Struct: return "Struct";
+        case V_AstType::Object: return "Object";
+    }
+    
+    return "Unknown";
+}
+
+//
+// Counts the statements and expressions in a tree by type
+// Data types aren't counted, since they hang off of other nodes.
+//
+static void countExpression(AstExpression *expr, std::map<V_AstType, size_t> &counts);
+static void countBlock(AstBlock *block, std::map<V_AstType, size_t> &counts);
+
+static void countExpression(AstExpression *expr, std::map<V_AstType, size_t> &counts) {
+    if (!expr) return;
+    ++counts[expr->type];
+    
+    switch (expr->type) {
+        case V_AstType::ExprList: {
+            for (auto item : static_cast<AstExprList *>(expr)->list) countExpression(item, counts);
+        } break;
+        
+        case V_AstType::Neg: countExpression(static_cast<AstUnaryOp *>(expr)->value, counts); break;
+        case V_AstType::ArrayAccess: countExpression(static_cast<AstArrayAccess *>(expr)->index, counts); break;
+        case V_AstType::StructAccess: countExpression(static_cast<AstStructAccess *>(expr)->access_expression, counts); break;
+        case V_AstType::FuncCallExpr: countExpression(static_cast<AstFuncCallExpr *>(expr)->args, counts); break;
+        case V_AstType::Sizeof: countExpression(static_cast<AstSizeof *>(expr)->value, counts); break;
+        
+        case V_AstType::Assign:
+        case V_AstType::Add:
+        case V_AstType::Sub:
+        case V_AstType::Mul:
+        case V_AstType::Div:
+        case V_AstType::Mod:
+        case V_AstType::And:
+        case V_AstType::Or:
+        case V_AstType::Xor:
+        case V_AstType::Lsh:
+        case V_AstType::Rsh:
+        case V_AstType::EQ:
+        case V_AstType::NEQ:
+        case V_AstType::GT:
+        case V_AstType::LT:
+        case V_AstType::GTE:
+        case V_AstType::LTE:
+        case V_AstType::LogicalAnd:
+        case V_AstType::LogicalOr: {
+            auto op = static_cast<AstBinaryOp *>(expr);
+            countExpression(op->lval, counts);
+            countExpression(op->rval, counts);
+        } break;
+        
+        default: {}
+    }
+}
+
+static void countStatement(AstStatement *stmt, std::map<V_AstType, size_t> &counts) {
+    ++counts[stmt->type];
+    countExpression(stmt->expression, counts);
+    
+    switch (stmt->type) {
+        case V_AstType::Func: countBlock(static_cast<AstFunction *>(stmt)->block, counts); break;
+        case V_AstType::BlockStmt: countBlock(static_cast<AstBlockStmt *>(stmt)->block, counts); break;
+        case V_AstType::While: countBlock(static_cast<AstWhileStmt *>(stmt)->block, counts); break;
+        case V_AstType::Repeat: countBlock(static_cast<AstRepeatStmt *>(stmt)->block, counts); break;
+        
+        case V_AstType::If: {
+            auto cond = static_cast<AstIfStmt *>(stmt);
+            countBlock(cond->true_block, counts);
+            countBlock(cond->false_block, counts);
+        } break;
+        
+        case V_AstType::For: {
+            auto loop = static_cast<AstForStmt *>(stmt);
+            countExpression(loop->index, counts);
+            countExpression(loop->start, counts);
+            countExpression(loop->end, counts);
+            countExpression(loop->step, counts);
+            countBlock(loop->block, counts);
+        } break;
+        
+        case V_AstType::ForAll: {
+            auto loop = static_cast<AstForAllStmt *>(stmt);
+            countExpression(loop->index, counts);
+            countExpression(loop->array, counts);
+            countBlock(loop->block, counts);
+        } break;
+        
+        default: {}
+    }
+}
+
+static void countBlock(AstBlock *block, std::map<V_AstType, size_t> &counts) {
+    if (!block) return;
+    ++counts[V_AstType::Block];
+    
+    for (auto stmt : block->block) countStatement(stmt, counts);
+}
+
+std::map<V_AstType, size_t> AstTree::countNodes() {
+    std::map<V_AstType, size_t> counts;
+    
+    for (auto str : structs) {
+        ++counts[V_AstType::StructDef];
+        for (auto const &item : str->default_expressions) countExpression(item.second, counts);
+    }
+    
+    countBlock(block, counts);
+    return counts;
+}
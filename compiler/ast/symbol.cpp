@@ -0,0 +1,57 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include <ast/symbol.hpp>
+
+namespace Symbol {
+
+//
+// The names are stored in a deque so references to them are never invalidated,
+// and the lookup table keys are views into those strings.
+// Id 0 is always the empty string.
+//
+static std::shared_mutex lock;
+static std::deque<std::string> names = { "" };
+static std::unordered_map<std::string_view, SymbolId> ids = { { names[0], 0 } };
+
+SymbolId intern(std::string_view name) {
+    {
+        std::shared_lock<std::shared_mutex> reader(lock);
+        auto entry = ids.find(name);
+        if (entry != ids.end()) return entry->second;
+    }
+    
+    // Another thread may have added it between the two locks
+    std::unique_lock<std::shared_mutex> writer(lock);
+    auto entry = ids.find(name);
+    if (entry != ids.end()) return entry->second;
+    
+    SymbolId id = names.size();
+    names.push_back(std::string(name));
+    ids[names.back()] = id;
+    return id;
+}
+
+bool find(std::string_view name, SymbolId &id) {
+    std::shared_lock<std::shared_mutex> reader(lock);
+    auto entry = ids.find(name);
+    if (entry == ids.end()) return false;
+    
+    id = entry->second;
+    return true;
+}
+
+const std::string &getName(SymbolId id) {
+    std::shared_lock<std::shared_mutex> reader(lock);
+    return names.at(id);
+}
+
+} // End Symbol
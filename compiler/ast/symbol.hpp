@@ -0,0 +1,40 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+//
+// An interned identifier
+// Every spelling of a name maps to exactly one id, so tables can hash and
+// compare integers instead of strings.
+//
+typedef uint32_t SymbolId;
+
+namespace Symbol {
+
+//
+// Returns the id for a name, adding it to the table the first time it is seen
+// This is safe to call from multiple threads.
+//
+SymbolId intern(std::string_view name);
+
+//
+// Looks up the id for a name without adding it
+// Returns false if the name has never been interned. Lookups only take the
+// shared lock, so they don't hold up other threads.
+//
+bool find(std::string_view name, SymbolId &id);
+
+//
+// Returns the name an id was interned from
+// The reference stays valid for the life of the program.
+//
+const std::string &getName(SymbolId id);
+
+} // End Symbol
@@ -0,0 +1,1025 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+
+#include <ast/ast.hpp>
+
+#include "bytecode.hpp"
+
+BcCompiler::BcCompiler(std::shared_ptr<AstTree> tree) {
+    this->tree = tree;
+    program = std::make_shared<BcProgram>();
+    program->tree = tree;
+}
+
+//
+// Compiles every function in the tree
+//
+// All the functions are cataloged first, so calls can be resolved no matter
+// what order the functions are in. The parameters always take the first
+// registers of their banks.
+//
+bool BcCompiler::compile() {
+    std::vector<AstFunction *> functions;
+    
+    for (auto const &stmt : tree->block->block) {
+        if (stmt->type != V_AstType::Func) continue;
+        auto func = static_cast<AstFunction *>(stmt);
+        
+        BcFunction bc;
+        bc.name = func->name;
+        bc.source = func;
+        bc.return_kind = kind_of(func->data_type);
+        
+        for (auto const &arg : func->args) {
+            BcOperand param;
+            param.kind = kind_of(arg.type);
+            param.reg = bc.regs[(int)param.kind]++;
+            bc.params.push_back(param);
+        }
+        
+        if (failed) return false;
+        
+        function_map[Symbol::intern(func->name)] = program->functions.size();
+        program->functions.push_back(bc);
+        functions.push_back(func);
+    }
+    
+    for (size_t i = 0; i<functions.size(); i++) {
+        if (!compile_function(functions[i], &program->functions[i])) return false;
+    }
+    
+    auto main = function_map.find(Symbol::intern("main"));
+    if (main != function_map.end()) program->main_func = main->second;
+    
+    return true;
+}
+
+//
+// Compiles the body of a function
+//
+bool BcCompiler::compile_function(AstFunction *func, BcFunction *bc) {
+    current = bc;
+    scopes.clear();
+    loops.clear();
+    
+    memcpy(next_reg, bc->regs, sizeof(next_reg));
+    scopes.emplace_back();
+    for (size_t i = 0; i<func->args.size(); i++) {
+        scopes.back()[func->args[i].id] = bc->params[i];
+    }
+    
+    if (!compile_block(func->block)) return false;
+    
+    // Falling off the end returns an empty value
+    emit(BcOp::RetV);
+    return !failed;
+}
+
+//
+// Compiles a block of statements
+// Registers for the variables declared in the block are handed back at the end,
+// so sibling blocks share them.
+//
+bool BcCompiler::compile_block(AstBlock *block) {
+    uint16_t saved[5];
+    memcpy(saved, next_reg, sizeof(saved));
+    scopes.emplace_back();
+    
+    for (auto const &stmt : block->block) {
+        if (!compile_statement(stmt)) return false;
+    }
+    
+    scopes.pop_back();
+    memcpy(next_reg, saved, sizeof(saved));
+    return true;
+}
+
+//
+// Compiles a single statement
+// Any temporary registers used by the statement are freed afterwards.
+//
+bool BcCompiler::compile_statement(AstStatement *stmt) {
+    if (stmt->type == V_AstType::VarDec) {
+        return compile_var_decl(static_cast<AstVarDec *>(stmt));
+    }
+    
+    uint16_t saved[5];
+    memcpy(saved, next_reg, sizeof(saved));
+    
+    switch (stmt->type) {
+        // Expression statements
+        case V_AstType::ExprStmt: {
+            auto expr = stmt->expression;
+            if (expr->type == V_AstType::Assign) {
+                compile_assign(static_cast<AstAssignOp *>(expr));
+            } else if (expr->type == V_AstType::FuncCallExpr) {
+                auto fc = static_cast<AstFuncCallExpr *>(expr);
+                compile_call(fc->id, fc->name, static_cast<AstExprList *>(fc->args), BcKind::Void);
+            } else {
+                switch (kind_of(expr)) {
+                    case BcKind::Int: compile_int(expr); break;
+                    case BcKind::String: compile_string(expr); break;
+                    default: error("Unsupported expression statement.");
+                }
+            }
+        } break;
+        
+        // Return statements
+        case V_AstType::Return: {
+            if (!stmt->hasExpression() || current->return_kind == BcKind::Void) {
+                emit(BcOp::RetV);
+                break;
+            }
+            
+            BcKind kind = current->return_kind;
+            switch (kind) {
+                case BcKind::Int: emit(BcOp::Ret, compile_int(stmt->expression)); break;
+                case BcKind::String: emit(BcOp::SRet, compile_string(stmt->expression)); break;
+                case BcKind::IntArray: emit(BcOp::ARet, compile_array(stmt->expression, kind)); break;
+                case BcKind::StringArray: emit(BcOp::SARet, compile_array(stmt->expression, kind)); break;
+                default: {}
+            }
+        } break;
+        
+        // Function calls
+        case V_AstType::FuncCallStmt: {
+            auto fc = static_cast<AstFuncCallStmt *>(stmt);
+            auto args = static_cast<AstExprList *>(fc->expression);
+            if (fc->name == "print") compile_print(args);
+            else compile_call(fc->id, fc->name, args, BcKind::Void);
+        } break;
+        
+        // Flow control statements
+        case V_AstType::If: compile_cond(static_cast<AstIfStmt *>(stmt)); break;
+        case V_AstType::While: compile_while(static_cast<AstWhileStmt *>(stmt)); break;
+        
+        case V_AstType::Break: {
+            if (loops.empty()) return error("Break statement outside of a loop.");
+            loops.back().breaks.push_back(emit(BcOp::Jmp));
+        } break;
+        
+        case V_AstType::Continue: {
+            if (loops.empty()) return error("Continue statement outside of a loop.");
+            loops.back().continues.push_back(emit(BcOp::Jmp));
+        } break;
+        
+        default: return error("Unsupported statement.");
+    }
+    
+    memcpy(next_reg, saved, sizeof(saved));
+    return !failed;
+}
+
+//
+// Variable and array declarations
+// The variable is reset every time the declaration runs, the same as a fresh
+// declaration would be in the tree walker.
+//
+bool BcCompiler::compile_var_decl(AstVarDec *vd) {
+    BcOperand var;
+    var.kind = kind_of(vd->data_type);
+    if (failed) return false;
+    
+    var.reg = alloc_reg(var.kind);
+    scopes.back()[vd->id] = var;
+    
+    switch (var.kind) {
+        case BcKind::Int: emit(BcOp::LoadI, var.reg, 0); break;
+        case BcKind::String: emit(BcOp::SLoadK, var.reg, string_const("")); break;
+        
+        case BcKind::IntArray:
+        case BcKind::StringArray: {
+            uint16_t zero = alloc_reg(BcKind::Int);
+            emit(BcOp::LoadI, zero, 0);
+            emit(var.kind == BcKind::IntArray ? BcOp::ANew : BcOp::SANew, var.reg, zero);
+            --next_reg[(int)BcKind::Int];
+        } break;
+        
+        default: return error("Invalid variable type: " + vd->name);
+    }
+    
+    return !failed;
+}
+
+//
+// Compiles a conditional statement
+// Elif clauses are nested conditionals in the false block.
+//
+bool BcCompiler::compile_cond(AstIfStmt *cond) {
+    std::vector<size_t> else_jumps;
+    if (!compile_jump_if(cond->expression, false, else_jumps)) return false;
+    if (!compile_block(cond->true_block)) return false;
+    
+    if (cond->false_block && !cond->false_block->block.empty()) {
+        std::vector<size_t> end_jumps;
+        end_jumps.push_back(emit(BcOp::Jmp));
+        
+        patch(else_jumps, current->code.size());
+        if (!compile_block(cond->false_block)) return false;
+        patch(end_jumps, current->code.size());
+    } else {
+        patch(else_jumps, current->code.size());
+    }
+    
+    return true;
+}
+
+//
+// Compiles a while loop
+// The condition is placed after the body, so each iteration only takes one
+// branch.
+//
+bool BcCompiler::compile_while(AstWhileStmt *loop) {
+    std::vector<size_t> entry;
+    entry.push_back(emit(BcOp::Jmp));
+    
+    size_t body = current->code.size();
+    loops.emplace_back();
+    if (!compile_block(loop->block)) return false;
+    
+    size_t test = current->code.size();
+    patch(entry, test);
+    patch(loops.back().continues, test);
+    
+    std::vector<size_t> back;
+    if (!compile_jump_if(loop->expression, true, back)) return false;
+    patch(back, body);
+    
+    patch(loops.back().breaks, current->code.size());
+    loops.pop_back();
+    return true;
+}
+
+//
+// Compiles the builtin print call
+//
+bool BcCompiler::compile_print(AstExprList *args) {
+    for (auto const &arg : args->list) {
+        BcKind kind = kind_of(arg);
+        switch (kind) {
+            case BcKind::Int: emit(BcOp::PrintI, compile_int(arg)); break;
+            case BcKind::String: emit(BcOp::PrintS, compile_string(arg)); break;
+            case BcKind::IntArray: emit(BcOp::PrintA, compile_array(arg, kind)); break;
+            case BcKind::StringArray: emit(BcOp::PrintSA, compile_array(arg, kind)); break;
+            default: return error("Unsupported expression in print.");
+        }
+    }
+    
+    emit(BcOp::PrintLn);
+    return !failed;
+}
+
+//
+// Emits the jumps for a condition
+// The jumps are taken when the condition equals "when", and are added to the
+// patch list so the caller can fill in the target. Comparisons are fused right
+// into the branch.
+//
+bool BcCompiler::compile_jump_if(AstExpression *expr, bool when, std::vector<size_t> &patches) {
+    switch (expr->type) {
+        case V_AstType::EQ:
+        case V_AstType::NEQ:
+        case V_AstType::GT:
+        case V_AstType::LT:
+        case V_AstType::GTE:
+        case V_AstType::LTE: {
+            auto op = static_cast<AstBinaryOp *>(expr);
+            if (kind_of(op->lval) == BcKind::String) break;
+            
+            int lval = compile_int(op->lval);
+            int rval = compile_int(op->rval);
+            if (failed) return false;
+            
+            BcOp jump = BcOp::JEq;
+            switch (expr->type) {
+                case V_AstType::EQ: jump = when ? BcOp::JEq : BcOp::JNe; break;
+                case V_AstType::NEQ: jump = when ? BcOp::JNe : BcOp::JEq; break;
+                case V_AstType::GT: jump = when ? BcOp::JGt : BcOp::JLe; break;
+                case V_AstType::LT: jump = when ? BcOp::JLt : BcOp::JGe; break;
+                case V_AstType::GTE: jump = when ? BcOp::JGe : BcOp::JLt; break;
+                case V_AstType::LTE: jump = when ? BcOp::JLe : BcOp::JGt; break;
+                default: {}
+            }
+            
+            patches.push_back(emit(jump, lval, rval));
+            return true;
+        }
+        
+        case V_AstType::LogicalAnd: {
+            auto op = static_cast<AstBinaryOp *>(expr);
+            if (when) {
+                std::vector<size_t> skip;
+                if (!compile_jump_if(op->lval, false, skip)) return false;
+                if (!compile_jump_if(op->rval, true, patches)) return false;
+                patch(skip, current->code.size());
+            } else {
+                if (!compile_jump_if(op->lval, false, patches)) return false;
+                if (!compile_jump_if(op->rval, false, patches)) return false;
+            }
+            return true;
+        }
+        
+        case V_AstType::LogicalOr: {
+            auto op = static_cast<AstBinaryOp *>(expr);
+            if (when) {
+                if (!compile_jump_if(op->lval, true, patches)) return false;
+                if (!compile_jump_if(op->rval, true, patches)) return false;
+            } else {
+                std::vector<size_t> skip;
+                if (!compile_jump_if(op->lval, true, skip)) return false;
+                if (!compile_jump_if(op->rval, false, patches)) return false;
+                patch(skip, current->code.size());
+            }
+            return true;
+        }
+        
+        default: {}
+    }
+    
+    int reg = compile_int(expr);
+    if (failed) return false;
+    patches.push_back(emit(when ? BcOp::Jnz : BcOp::Jz, reg));
+    return true;
+}
+
+//
+// Compiles an integer expression
+//
+int BcCompiler::compile_int(AstExpression *expr, int dest) {
+    switch (expr->type) {
+        // Constants
+        case V_AstType::IntL: return load_int(static_cast<AstInt *>(expr)->value, dest);
+        case V_AstType::CharL: return load_int(static_cast<AstChar *>(expr)->value, dest);
+        
+        // Variables
+        case V_AstType::ID: {
+            auto id = static_cast<AstID *>(expr);
+            auto var = lookup(id->id);
+            if (!var || var->kind != BcKind::Int) {
+                error("Expected an integer variable: " + id->value);
+                return -1;
+            }
+            
+            if (dest >= 0 && dest != var->reg) {
+                emit(BcOp::Move, dest, var->reg);
+                return dest;
+            }
+            return var->reg;
+        }
+        
+        case V_AstType::ArrayAccess: {
+            auto acc = static_cast<AstArrayAccess *>(expr);
+            auto var = lookup(acc->id);
+            if (!var) {
+                error("Unknown variable: " + acc->value);
+                return -1;
+            }
+            
+            BcOperand array = *var;
+            int index = compile_int(acc->index);
+            int reg = dest >= 0 ? dest : alloc_reg(BcKind::Int);
+            
+            if (array.kind == BcKind::IntArray) emit(BcOp::AGet, reg, array.reg, index);
+            else if (array.kind == BcKind::String) emit(BcOp::SCode, reg, array.reg, index);
+            else error("Expected an integer array: " + acc->value);
+            return reg;
+        }
+        
+        // Function call expression
+        case V_AstType::FuncCallExpr: {
+            auto fc = static_cast<AstFuncCallExpr *>(expr);
+            auto args = static_cast<AstExprList *>(fc->args);
+            return compile_call(fc->id, fc->name, args, BcKind::Int, dest).reg;
+        }
+        
+        // Assign operator
+        case V_AstType::Assign: {
+            BcOperand result = compile_assign(static_cast<AstAssignOp *>(expr));
+            if (result.kind != BcKind::Int) {
+                error("Expected an integer expression.");
+                return -1;
+            }
+            
+            if (dest >= 0 && dest != result.reg) {
+                emit(BcOp::Move, dest, result.reg);
+                return dest;
+            }
+            return result.reg;
+        }
+        
+        case V_AstType::Neg: {
+            auto op = static_cast<AstNegOp *>(expr);
+            int value = compile_int(op->value);
+            int reg = dest >= 0 ? dest : alloc_reg(BcKind::Int);
+            emit(BcOp::Neg, reg, value);
+            return reg;
+        }
+        
+        // Logical operators are only evaluated as far as needed
+        case V_AstType::LogicalAnd:
+        case V_AstType::LogicalOr: {
+            std::vector<size_t> false_jumps;
+            if (!compile_jump_if(expr, false, false_jumps)) return -1;
+            
+            int reg = dest >= 0 ? dest : alloc_reg(BcKind::Int);
+            emit(BcOp::LoadI, reg, 1);
+            std::vector<size_t> end_jump;
+            end_jump.push_back(emit(BcOp::Jmp));
+            
+            patch(false_jumps, current->code.size());
+            emit(BcOp::LoadI, reg, 0);
+            patch(end_jump, current->code.size());
+            return reg;
+        }
+        
+        // Operators
+        case V_AstType::Add:
+        case V_AstType::Sub:
+        case V_AstType::Mul:
+        case V_AstType::Div:
+        case V_AstType::Mod:
+        case V_AstType::And:
+        case V_AstType::Or:
+        case V_AstType::Xor:
+        case V_AstType::Lsh:
+        case V_AstType::Rsh:
+        case V_AstType::EQ:
+        case V_AstType::NEQ:
+        case V_AstType::GT:
+        case V_AstType::LT:
+        case V_AstType::GTE:
+        case V_AstType::LTE:
+        {
+            auto op = static_cast<AstBinaryOp *>(expr);
+            
+            // Strings can only be checked for equality
+            if (kind_of(op->lval) == BcKind::String) {
+                if (expr->type != V_AstType::EQ && expr->type != V_AstType::NEQ) {
+                    error("Invalid operator for strings.");
+                    return -1;
+                }
+                
+                int lval = compile_string(op->lval);
+                int rval = compile_string(op->rval);
+                int reg = dest >= 0 ? dest : alloc_reg(BcKind::Int);
+                emit(BcOp::SEq, reg, lval, rval);
+                
+                if (expr->type == V_AstType::NEQ) {
+                    uint16_t zero = alloc_reg(BcKind::Int);
+                    emit(BcOp::LoadI, zero, 0);
+                    emit(BcOp::Eq, reg, reg, zero);
+                }
+                return reg;
+            }
+            
+            // Adding or subtracting a small constant is a single instruction
+            if ((expr->type == V_AstType::Add || expr->type == V_AstType::Sub) && op->rval->type == V_AstType::IntL) {
+                int64_t value = static_cast<AstInt *>(op->rval)->value;
+                if (expr->type == V_AstType::Sub) value = -value;
+                
+                if (value >= INT32_MIN && value <= INT32_MAX) {
+                    int lval = compile_int(op->lval);
+                    int reg = dest >= 0 ? dest : alloc_reg(BcKind::Int);
+                    emit(BcOp::AddI, reg, lval, (uint32_t)(int32_t)value);
+                    return reg;
+                }
+            }
+            
+            int lval = compile_int(op->lval);
+            int rval = compile_int(op->rval);
+            int reg = dest >= 0 ? dest : alloc_reg(BcKind::Int);
+            
+            BcOp instr = BcOp::Add;
+            switch (expr->type) {
+                case V_AstType::Add: instr = BcOp::Add; break;
+                case V_AstType::Sub: instr = BcOp::Sub; break;
+                case V_AstType::Mul: instr = BcOp::Mul; break;
+                case V_AstType::Div: instr = BcOp::Div; break;
+                case V_AstType::Mod: instr = BcOp::Mod; break;
+                case V_AstType::And: instr = BcOp::And; break;
+                case V_AstType::Or: instr = BcOp::Or; break;
+                case V_AstType::Xor: instr = BcOp::Xor; break;
+                case V_AstType::Lsh: instr = BcOp::Lsh; break;
+                case V_AstType::Rsh: instr = BcOp::Rsh; break;
+                case V_AstType::EQ: instr = BcOp::Eq; break;
+                case V_AstType::NEQ: instr = BcOp::Ne; break;
+                case V_AstType::GT: instr = BcOp::Gt; break;
+                case V_AstType::LT: instr = BcOp::Lt; break;
+                case V_AstType::GTE: instr = BcOp::Ge; break;
+                case V_AstType::LTE: instr = BcOp::Le; break;
+                default: {}
+            }
+            
+            emit(instr, reg, lval, rval);
+            return reg;
+        }
+        
+        default: {}
+    }
+    
+    error("Unsupported integer expression.");
+    return -1;
+}
+
+//
+// Compiles a string expression
+// Characters are treated as one character strings.
+//
+int BcCompiler::compile_string(AstExpression *expr, int dest) {
+    switch (expr->type) {
+        // Constants
+        case V_AstType::StringL:
+        case V_AstType::CharL:
+        case V_AstType::IntL: {
+            std::string value = "";
+            if (expr->type == V_AstType::StringL) value = static_cast<AstString *>(expr)->value;
+            else if (expr->type == V_AstType::CharL) value = std::string(1, static_cast<AstChar *>(expr)->value);
+            else value = std::to_string(static_cast<AstInt *>(expr)->value);
+            
+            int reg = dest >= 0 ? dest : alloc_reg(BcKind::String);
+            emit(BcOp::SLoadK, reg, string_const(value));
+            return reg;
+        }
+        
+        // Variables
+        case V_AstType::ID: {
+            auto id = static_cast<AstID *>(expr);
+            auto var = lookup(id->id);
+            if (!var || var->kind != BcKind::String) {
+                error("Expected a string variable: " + id->value);
+                return -1;
+            }
+            
+            if (dest >= 0 && dest != var->reg) {
+                emit(BcOp::SMove, dest, var->reg);
+                return dest;
+            }
+            return var->reg;
+        }
+        
+        case V_AstType::ArrayAccess: {
+            auto acc = static_cast<AstArrayAccess *>(expr);
+            auto var = lookup(acc->id);
+            if (!var) {
+                error("Unknown variable: " + acc->value);
+                return -1;
+            }
+            
+            BcOperand array = *var;
+            int index = compile_int(acc->index);
+            int reg = dest >= 0 ? dest : alloc_reg(BcKind::String);
+            
+            if (array.kind == BcKind::String) emit(BcOp::SChar, reg, array.reg, index);
+            else if (array.kind == BcKind::StringArray) emit(BcOp::SAGet, reg, array.reg, index);
+            else error("Expected a string array: " + acc->value);
+            return reg;
+        }
+        
+        // Function call expression
+        case V_AstType::FuncCallExpr: {
+            auto fc = static_cast<AstFuncCallExpr *>(expr);
+            auto args = static_cast<AstExprList *>(fc->args);
+            return compile_call(fc->id, fc->name, args, BcKind::String, dest).reg;
+        }
+        
+        // Assign operator
+        case V_AstType::Assign: {
+            BcOperand result = compile_assign(static_cast<AstAssignOp *>(expr));
+            if (result.kind != BcKind::String) {
+                error("Expected a string expression.");
+                return -1;
+            }
+            
+            if (dest >= 0 && dest != result.reg) {
+                emit(BcOp::SMove, dest, result.reg);
+                return dest;
+            }
+            return result.reg;
+        }
+        
+        default: {}
+    }
+    
+    error("Unsupported string expression.");
+    return -1;
+}
+
+//
+// Compiles an expression that results in an entire array
+//
+int BcCompiler::compile_array(AstExpression *expr, BcKind kind, int dest) {
+    BcOp move = kind == BcKind::IntArray ? BcOp::AMove : BcOp::SAMove;
+    
+    switch (expr->type) {
+        case V_AstType::ID: {
+            auto id = static_cast<AstID *>(expr);
+            auto var = lookup(id->id);
+            if (!var || var->kind != kind) {
+                error("Expected an array: " + id->value);
+                return -1;
+            }
+            
+            if (dest >= 0 && dest != var->reg) {
+                emit(move, dest, var->reg);
+                return dest;
+            }
+            return var->reg;
+        }
+        
+        case V_AstType::FuncCallExpr: {
+            auto fc = static_cast<AstFuncCallExpr *>(expr);
+            auto args = static_cast<AstExprList *>(fc->args);
+            return compile_call(fc->id, fc->name, args, kind, dest).reg;
+        }
+        
+        case V_AstType::Assign: {
+            BcOperand result = compile_assign(static_cast<AstAssignOp *>(expr));
+            if (result.kind != kind) {
+                error("Expected an array expression.");
+                return -1;
+            }
+            
+            if (dest >= 0 && dest != result.reg) {
+                emit(move, dest, result.reg);
+                return dest;
+            }
+            return result.reg;
+        }
+        
+        default: {}
+    }
+    
+    error("Unsupported array expression.");
+    return -1;
+}
+
+//
+// Compiles an assignment
+// Values are computed straight into the register of the variable. The result
+// is the register holding the assigned value.
+//
+BcOperand BcCompiler::compile_assign(AstAssignOp *op) {
+    switch (op->lval->type) {
+        case V_AstType::ID: {
+            auto id = static_cast<AstID *>(op->lval);
+            auto var = lookup(id->id);
+            if (!var) {
+                error("Unknown variable: " + id->value);
+                return BcOperand();
+            }
+            
+            BcOperand result = *var;
+            switch (result.kind) {
+                case BcKind::Int: compile_int(op->rval, result.reg); break;
+                case BcKind::String: compile_string(op->rval, result.reg); break;
+                default: compile_array(op->rval, result.kind, result.reg);
+            }
+            return result;
+        }
+        
+        case V_AstType::ArrayAccess: {
+            auto acc = static_cast<AstArrayAccess *>(op->lval);
+            auto var = lookup(acc->id);
+            if (!var) {
+                error("Unknown variable: " + acc->value);
+                return BcOperand();
+            }
+            
+            BcOperand array = *var;
+            BcOperand result;
+            
+            if (array.kind == BcKind::IntArray) {
+                result.kind = BcKind::Int;
+                result.reg = compile_int(op->rval);
+                int index = compile_int(acc->index);
+                emit(BcOp::ASet, array.reg, index, result.reg);
+            } else if (array.kind == BcKind::StringArray) {
+                result.kind = BcKind::String;
+                result.reg = compile_string(op->rval);
+                int index = compile_int(acc->index);
+                emit(BcOp::SASet, array.reg, index, result.reg);
+            } else {
+                error("Invalid array assignment: " + acc->value);
+            }
+            return result;
+        }
+        
+        default: {}
+    }
+    
+    error("Invalid assignment.");
+    return BcOperand();
+}
+
+//
+// Compiles a function call
+// A few functions are built into the interpreter rather than being defined in
+// the program. "kind" is the type the caller expects, and is also used to tell
+// which kind of array an allocation makes.
+//
+BcOperand BcCompiler::compile_call(SymbolId id, std::string name, AstExprList *args, BcKind kind, int dest) {
+    BcOperand result;
+    auto func = function_map.find(id);
+    
+    if (func == function_map.end()) {
+        // The length of an array or string
+        if ((name == "length" || name == "strlen") && args->list.size() == 1) {
+            auto arg = args->list[0];
+            result.kind = BcKind::Int;
+            
+            if (arg->type == V_AstType::StringL) {
+                result.reg = load_int(static_cast<AstString *>(arg)->value.length(), dest);
+            } else {
+                BcKind arg_kind = kind_of(arg);
+                BcOp instr = BcOp::SLen;
+                int value = -1;
+                
+                switch (arg_kind) {
+                    case BcKind::String: value = compile_string(arg); break;
+                    case BcKind::IntArray: value = compile_array(arg, arg_kind); instr = BcOp::ALen; break;
+                    case BcKind::StringArray: value = compile_array(arg, arg_kind); instr = BcOp::SALen; break;
+                    default: error("Invalid argument to " + name + ".");
+                }
+                
+                result.reg = dest >= 0 ? dest : alloc_reg(BcKind::Int);
+                emit(instr, result.reg, value);
+            }
+            
+        // String comparison
+        } else if (name == "stringcmp" && args->list.size() == 2) {
+            int str1 = compile_string(args->list[0]);
+            int str2 = compile_string(args->list[1]);
+            result.kind = BcKind::Int;
+            result.reg = dest >= 0 ? dest : alloc_reg(BcKind::Int);
+            emit(BcOp::SEq, result.reg, str1, str2);
+            
+        // String concatenation
+        } else if ((name == "strcat_str" || name == "strcat_char") && args->list.size() == 2) {
+            int str1 = compile_string(args->list[0]);
+            int str2 = compile_string(args->list[1]);
+            result.kind = BcKind::String;
+            result.reg = dest >= 0 ? dest : alloc_reg(BcKind::String);
+            emit(BcOp::SCat, result.reg, str1, str2);
+            
+        // Array allocation
+        // Arrays are allocated as "malloc(sizeof * length)", and only the length is needed.
+        } else if ((name == "malloc" || name == "gc_alloc") && args->list.size() == 1) {
+            auto arg = args->list[0];
+            if (arg->type == V_AstType::Mul) arg = static_cast<AstMulOp *>(arg)->rval;
+            int length = compile_int(arg);
+            
+            if (kind != BcKind::IntArray && kind != BcKind::StringArray) {
+                error("Memory can only be allocated for arrays.");
+                return result;
+            }
+            
+            result.kind = kind;
+            result.reg = dest >= 0 ? dest : alloc_reg(kind);
+            emit(kind == BcKind::IntArray ? BcOp::ANew : BcOp::SANew, result.reg, length);
+            
+        } else {
+            error("Unknown function: " + name);
+            return result;
+        }
+    } else {
+        BcFunction *callee = &program->functions[func->second];
+        if (args->list.size() != callee->params.size()) {
+            error("Invalid number of arguments to " + name + ".");
+            return result;
+        }
+        
+        if (kind != BcKind::Void && callee->return_kind != kind) {
+            error("Invalid return type from " + name + ".");
+            return result;
+        }
+        
+        BcCall call;
+        call.func = func->second;
+        
+        for (size_t i = 0; i<args->list.size(); i++) {
+            auto arg = args->list[i];
+            BcOperand operand;
+            operand.kind = callee->params[i].kind;
+            
+            switch (operand.kind) {
+                case BcKind::Int: operand.reg = compile_int(arg); break;
+                case BcKind::String: operand.reg = compile_string(arg); break;
+                default: operand.reg = compile_array(arg, operand.kind);
+            }
+            
+            call.args.push_back(operand);
+        }
+        
+        result.kind = callee->return_kind;
+        if (result.kind != BcKind::Void) {
+            result.reg = dest >= 0 ? dest : alloc_reg(result.kind);
+        }
+        
+        current->calls.push_back(call);
+        emit(BcOp::Call, result.reg, current->calls.size() - 1);
+    }
+    
+    if (kind != BcKind::Void && result.kind != kind) {
+        error("Invalid return type from " + name + ".");
+    }
+    return result;
+}
+
+//
+// Maps a data type to the register bank it is kept in
+//
+BcKind BcCompiler::kind_of(AstDataType *data_type) {
+    if (data_type == nullptr) return BcKind::Void;
+    
+    switch (data_type->type) {
+        case V_AstType::Void: return BcKind::Void;
+        
+        case V_AstType::Bool:
+        case V_AstType::Int8:
+        case V_AstType::Int16:
+        case V_AstType::Int32:
+        case V_AstType::Int64: return BcKind::Int;
+        
+        case V_AstType::Char:
+        case V_AstType::String: return BcKind::String;
+        
+        case V_AstType::Ptr: {
+            auto base_type = static_cast<AstPointerType *>(data_type)->base_type;
+            BcKind base = kind_of(base_type);
+            if (base == BcKind::Int) return BcKind::IntArray;
+            if (base == BcKind::String) return BcKind::StringArray;
+        } break;
+        
+        default: {}
+    }
+    
+    error("Unsupported data type.");
+    return BcKind::Void;
+}
+
+//
+// Works out the type of an expression, for the places where it is not given
+//
+BcKind BcCompiler::kind_of(AstExpression *expr) {
+    switch (expr->type) {
+        case V_AstType::IntL: return BcKind::Int;
+        case V_AstType::CharL:
+        case V_AstType::StringL: return BcKind::String;
+        
+        case V_AstType::ID: {
+            auto var = lookup(static_cast<AstID *>(expr)->id);
+            if (var) return var->kind;
+        } break;
+        
+        case V_AstType::ArrayAccess: {
+            auto var = lookup(static_cast<AstArrayAccess *>(expr)->id);
+            if (!var) break;
+            if (var->kind == BcKind::IntArray) return BcKind::Int;
+            if (var->kind == BcKind::String || var->kind == BcKind::StringArray) return BcKind::String;
+        } break;
+        
+        case V_AstType::FuncCallExpr: {
+            auto fc = static_cast<AstFuncCallExpr *>(expr);
+            auto func = function_map.find(fc->id);
+            if (func != function_map.end()) return program->functions[func->second].return_kind;
+            
+            if (fc->name == "length" || fc->name == "strlen" || fc->name == "stringcmp") return BcKind::Int;
+            if (fc->name == "strcat_str" || fc->name == "strcat_char") return BcKind::String;
+        } break;
+        
+        case V_AstType::Assign: return kind_of(static_cast<AstAssignOp *>(expr)->lval);
+        
+        case V_AstType::Neg:
+        case V_AstType::Add:
+        case V_AstType::Sub:
+        case V_AstType::Mul:
+        case V_AstType::Div:
+        case V_AstType::Mod:
+        case V_AstType::And:
+        case V_AstType::Or:
+        case V_AstType::Xor:
+        case V_AstType::Lsh:
+        case V_AstType::Rsh:
+        case V_AstType::EQ:
+        case V_AstType::NEQ:
+        case V_AstType::GT:
+        case V_AstType::LT:
+        case V_AstType::GTE:
+        case V_AstType::LTE:
+        case V_AstType::LogicalAnd:
+        case V_AstType::LogicalOr: return BcKind::Int;
+        
+        default: {}
+    }
+    
+    return BcKind::Void;
+}
+
+//
+// Finds the register of a variable, starting from the innermost block
+//
+BcOperand *BcCompiler::lookup(SymbolId id) {
+    for (auto scope = scopes.rbegin(); scope != scopes.rend(); scope++) {
+        auto var = scope->find(id);
+        if (var != scope->end()) return &var->second;
+    }
+    return nullptr;
+}
+
+uint16_t BcCompiler::alloc_reg(BcKind kind) {
+    int bank = (int)kind;
+    if (next_reg[bank] == UINT16_MAX) {
+        error("Too many registers in function " + current->name + ".");
+        return 0;
+    }
+    
+    uint16_t reg = next_reg[bank]++;
+    if (next_reg[bank] > current->regs[bank]) current->regs[bank] = next_reg[bank];
+    return reg;
+}
+
+//
+// Loads an integer constant
+// Anything that fits in 32 bits is encoded right in the instruction.
+//
+int BcCompiler::load_int(int64_t value, int dest) {
+    int reg = dest >= 0 ? dest : alloc_reg(BcKind::Int);
+    
+    if (value >= INT32_MIN && value <= INT32_MAX) {
+        emit(BcOp::LoadI, reg, (uint32_t)(int32_t)value);
+    } else {
+        program->int_consts.push_back(value);
+        emit(BcOp::LoadK, reg, program->int_consts.size() - 1);
+    }
+    return reg;
+}
+
+uint32_t BcCompiler::string_const(std::string value) {
+    auto found = string_map.find(value);
+    if (found != string_map.end()) return found->second;
+    
+    uint32_t index = program->string_consts.size();
+    program->string_consts.push_back(value);
+    string_map[value] = index;
+    return index;
+}
+
+size_t BcCompiler::emit(BcOp op, uint32_t a, uint32_t b, uint32_t c) {
+    BcInstr instr;
+    instr.op = op;
+    instr.a = a;
+    instr.b = b;
+    instr.c = c;
+    current->code.push_back(instr);
+    return current->code.size() - 1;
+}
+
+//
+// Points a list of jumps at their target
+// Plain jumps keep the target in "b", and compare-and-branch jumps in "c".
+//
+void BcCompiler::patch(std::vector<size_t> &patches, size_t target) {
+    for (auto index : patches) {
+        BcInstr &instr = current->code[index];
+        if (instr.op == BcOp::Jmp || instr.op == BcOp::Jz || instr.op == BcOp::Jnz) instr.b = target;
+        else instr.c = target;
+    }
+    patches.clear();
+}
+
+bool BcCompiler::error(std::string msg) {
+    if (!failed) message = msg;
+    failed = true;
+    return false;
+}
+
+//
+// Prints the compiled program
+//
+void BcProgram::print() {
+    #define BC_NAME(name) #name,
+    static const char *names[] = { BC_OPCODES(BC_NAME) };
+    #undef BC_NAME
+    
+    for (auto const &func : functions) {
+        std::cout << "FUNC " << func.name << " [i:" << func.regs[(int)BcKind::Int];
+        std::cout << " s:" << func.regs[(int)BcKind::String];
+        std::cout << " a:" << func.regs[(int)BcKind::IntArray];
+        std::cout << " sa:" << func.regs[(int)BcKind::StringArray] << "]" << std::endl;
+        
+        for (size_t i = 0; i<func.code.size(); i++) {
+            auto const &instr = func.code[i];
+            std::cout << "    " << std::setw(4) << i << "  " << std::left << std::setw(8) << names[(int)instr.op];
+            std::cout << std::right << instr.a << ", " << (int32_t)instr.b << ", " << (int32_t)instr.c << std::endl;
+        }
+        
+        std::cout << std::endl;
+    }
+}
+
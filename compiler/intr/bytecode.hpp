@@ -0,0 +1,277 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#pragma once
+
+#include <string>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+#include <ast/ast.hpp>
+
+#include "interpreter.hpp"
+
+//
+// The register banks a value can live in
+// Every frame has one bank of each kind, and the compiler always knows which
+// bank a value is in, so registers never need to carry a type tag.
+//
+enum class BcKind : uint8_t {
+    Void,
+    Int,
+    String,
+    IntArray,
+    StringArray
+};
+
+//
+// Array registers hold handles to shared storage, so moving an array between
+// registers or passing it to a function never copies its elements.
+//
+typedef std::vector<int64_t> BcIntArray;
+typedef std::vector<std::string> BcStringArray;
+typedef std::shared_ptr<BcIntArray> BcIntArrayRef;
+typedef std::shared_ptr<BcStringArray> BcStringArrayRef;
+
+//
+// The instruction set
+// Operands are registers in the current frame unless noted otherwise. The
+// letters give the banks: i = int, s = string, a = int array, sa = string array.
+//
+#define BC_OPCODES(X) \
+    X(LoadI)    /* i[a] = (int32)b */ \
+    X(LoadK)    /* i[a] = int_consts[b] */ \
+    X(Move)     /* i[a] = i[b] */ \
+    X(Add)      /* i[a] = i[b] + i[c] */ \
+    X(AddI)     /* i[a] = i[b] + (int32)c */ \
+    X(Sub) \
+    X(Mul) \
+    X(Div) \
+    X(Mod) \
+    X(And) \
+    X(Or) \
+    X(Xor) \
+    X(Lsh) \
+    X(Rsh) \
+    X(Neg)      /* i[a] = -i[b] */ \
+    X(Eq)       /* i[a] = i[b] == i[c] */ \
+    X(Ne) \
+    X(Gt) \
+    X(Lt) \
+    X(Ge) \
+    X(Le) \
+    X(Jmp)      /* pc = b */ \
+    X(Jz)       /* if (i[a] == 0) pc = b */ \
+    X(Jnz)      /* if (i[a] != 0) pc = b */ \
+    X(JEq)      /* if (i[a] == i[b]) pc = c */ \
+    X(JNe) \
+    X(JGt) \
+    X(JLt) \
+    X(JGe) \
+    X(JLe) \
+    X(SLoadK)   /* s[a] = string_consts[b] */ \
+    X(SMove)    /* s[a] = s[b] */ \
+    X(SChar)    /* s[a] = s[b][i[c]] as a one character string */ \
+    X(SCode)    /* i[a] = s[b][i[c]] */ \
+    X(SLen)     /* i[a] = length of s[b] */ \
+    X(SCat)     /* s[a] = s[b] + s[c] */ \
+    X(SEq)      /* i[a] = s[b] == s[c] */ \
+    X(ANew)     /* a[a] = a new array of i[b] zeroes */ \
+    X(AMove)    /* a[a] = a[b], sharing the storage */ \
+    X(AGet)     /* i[a] = a[b][i[c]] */ \
+    X(ASet)     /* a[a][i[b]] = i[c] */ \
+    X(ALen)     /* i[a] = length of a[b] */ \
+    X(SANew)    /* sa[a] = a new array of i[b] empty strings */ \
+    X(SAMove)   /* sa[a] = sa[b] */ \
+    X(SAGet)    /* s[a] = sa[b][i[c]] */ \
+    X(SASet)    /* sa[a][i[b]] = s[c] */ \
+    X(SALen)    /* i[a] = length of sa[b] */ \
+    X(Call)     /* calls[b], with the result going to register a */ \
+    X(Ret)      /* return i[a] */ \
+    X(SRet)     /* return s[a] */ \
+    X(ARet)     /* return a[a] */ \
+    X(SARet)    /* return sa[a] */ \
+    X(RetV)     /* return the zero value of the function's type */ \
+    X(PrintI)   /* print i[a] */ \
+    X(PrintS)   /* print s[a] */ \
+    X(PrintA)   /* print a[a] */ \
+    X(PrintSA)  /* print sa[a] */ \
+    X(PrintLn)
+
+#define BC_ENUM(name) name,
+
+enum class BcOp : uint8_t {
+    BC_OPCODES(BC_ENUM)
+};
+
+#undef BC_ENUM
+
+struct BcInstr {
+    BcOp op;
+    uint16_t a = 0;
+    uint32_t b = 0;
+    uint32_t c = 0;
+};
+
+//
+// A register, along with the bank it belongs to
+//
+struct BcOperand {
+    BcKind kind = BcKind::Void;
+    uint16_t reg = 0;
+};
+
+//
+// A call site
+// The arguments are copied straight from the caller's registers into the
+// parameter registers of the callee.
+//
+struct BcCall {
+    uint32_t func = 0;
+    std::vector<BcOperand> args;
+};
+
+struct BcFunction {
+    std::string name = "";
+    AstFunction *source = nullptr;
+    BcKind return_kind = BcKind::Void;
+    std::vector<BcOperand> params;
+    std::vector<BcInstr> code;
+    std::vector<BcCall> calls;
+    
+    // The size of each register bank, indexed by BcKind
+    uint16_t regs[5] = {0};
+};
+
+struct BcProgram {
+    void print();
+    
+    // The tree the program was compiled from, which hot functions are JIT'ed from
+    std::shared_ptr<AstTree> tree;
+    std::vector<BcFunction> functions;
+    std::vector<int64_t> int_consts;
+    std::vector<std::string> string_consts;
+    int main_func = -1;
+};
+
+//
+// Translates an AST into bytecode
+// Each variable is given a register in its frame up front, so nothing is looked
+// up by name at run time.
+//
+struct BcCompiler {
+    explicit BcCompiler(std::shared_ptr<AstTree> tree);
+    bool compile();
+    std::shared_ptr<BcProgram> getProgram() { return program; }
+    std::string getError() { return message; }
+    
+protected:
+    // Statements
+    bool compile_function(AstFunction *func, BcFunction *bc);
+    bool compile_block(AstBlock *block);
+    bool compile_statement(AstStatement *stmt);
+    bool compile_var_decl(AstVarDec *vd);
+    bool compile_cond(AstIfStmt *cond);
+    bool compile_while(AstWhileStmt *loop);
+    bool compile_print(AstExprList *args);
+    bool compile_jump_if(AstExpression *expr, bool when, std::vector<size_t> &patches);
+    
+    // Expressions
+    // Each of these returns the register holding the result, or -1 on an error.
+    // If dest is given, the result is always put there.
+    int compile_int(AstExpression *expr, int dest = -1);
+    int compile_string(AstExpression *expr, int dest = -1);
+    int compile_array(AstExpression *expr, BcKind kind, int dest = -1);
+    BcOperand compile_assign(AstAssignOp *op);
+    BcOperand compile_call(SymbolId id, std::string name, AstExprList *args, BcKind kind, int dest = -1);
+    
+    // Types and registers
+    BcKind kind_of(AstDataType *data_type);
+    BcKind kind_of(AstExpression *expr);
+    BcOperand *lookup(SymbolId id);
+    uint16_t alloc_reg(BcKind kind);
+    int load_int(int64_t value, int dest);
+    uint32_t string_const(std::string value);
+    
+    // Code generation
+    size_t emit(BcOp op, uint32_t a = 0, uint32_t b = 0, uint32_t c = 0);
+    void patch(std::vector<size_t> &patches, size_t target);
+    bool error(std::string msg);
+    
+    std::shared_ptr<AstTree> tree;
+    std::shared_ptr<BcProgram> program;
+    std::unordered_map<SymbolId, int> function_map;
+    std::unordered_map<std::string, uint32_t> string_map;
+    
+    // The function being compiled
+    BcFunction *current = nullptr;
+    uint16_t next_reg[5] = {0};
+    std::vector<std::unordered_map<SymbolId, BcOperand>> scopes;
+    
+    // Jumps that need to be patched once the end of the loop is known
+    struct Loop {
+        std::vector<size_t> breaks;
+        std::vector<size_t> continues;
+    };
+    std::vector<Loop> loops;
+    
+    bool failed = false;
+    std::string message = "";
+};
+
+//
+// Runs compiled bytecode
+// The register banks of all active frames are kept in one contiguous stack per
+// bank, and calls never recurse on the C++ stack. Once a function has been
+// called often enough, it goes to the JIT, and calls to it run natively.
+//
+struct BcVM {
+    explicit BcVM(std::shared_ptr<BcProgram> program);
+    int run();
+    
+    // Functions are compiled once they have been called this many times; below
+    // zero turns it off
+    int64_t jit_threshold = 1000;
+    
+protected:
+    struct Frame {
+        const BcFunction *func;
+        const BcInstr *ip;
+        size_t base[5];
+        uint16_t dest;
+    };
+    
+    //
+    // How hot each function is, indexed the same as the program's functions
+    //
+    // * heat -> Bumped on every call
+    // * tiered -> Set once the function has been tried with the JIT
+    // * native -> The compiled function, if the JIT took it
+    //
+    struct Tier {
+        uint64_t heat = 0;
+        bool tiered = false;
+        IntrNative native = nullptr;
+    };
+    
+    void enter(const BcFunction *func, size_t base[5], uint16_t dest);
+    void leave();
+    void tier_up(uint32_t index);
+    
+    std::shared_ptr<BcProgram> program;
+    std::vector<Frame> frames;
+    
+    std::vector<int64_t> int_stack;
+    std::vector<std::string> string_stack;
+    std::vector<BcIntArrayRef> array_stack;
+    std::vector<BcStringArrayRef> sarray_stack;
+    
+    std::vector<Tier> tiers;
+    std::unique_ptr<IntrTier> tier;
+    std::vector<uint64_t> native_args;
+};
+
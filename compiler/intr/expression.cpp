@@ -1,4 +1,5 @@
 #include <iostream>
+#include <cmath>
 
 #include <ast/ast.hpp>
 #include <ast/ast_builder.hpp>
@@ -8,93 +9,97 @@
 //
 // Evaluates an expression
 //
-void AstInterpreter::run_expression(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExpression> expr, std::shared_ptr<AstDataType> type) {
+void AstInterpreter::run_expression(IntrContext *ctx, AstExpression *expr, AstDataType *type) {
     if (is_int_type(type)) run_iexpression(ctx, expr);
     else if (is_float_type(type)) run_fexpression(ctx, expr);
     else if (is_string_type(type)) run_sexpression(ctx, expr);
 }
 
 // Runs an integer-based expression
-void AstInterpreter::run_iexpression(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExpression> expr) {
+void AstInterpreter::run_iexpression(IntrContext *ctx, AstExpression *expr) {
     switch (expr->type) {
         // Constants
         case V_AstType::IntL: {
-            auto i = std::static_pointer_cast<AstInt>(expr);
-            ctx->istack.push(i->value);
+            auto i = static_cast<AstInt *>(expr);
+            ctx->push(i->value);
+        } break;
+        
+        case V_AstType::FloatL: {
+            auto f = static_cast<AstFloat *>(expr);
+            ctx->push((uint64_t)(int64_t)f->value);
         } break;
         
         // Variables
         case V_AstType::ID: {
-            auto id = std::static_pointer_cast<AstID>(expr);
-            if (is_int_array(ctx, id->value)) {
-                ctx->sstack.push(id->value);
+            auto id = static_cast<AstID *>(expr);
+            IntrSlot &slot = ctx->slots[id->slot];
+            if (slot.kind == IntrKind::IntArray) {
+                ctx->push(slot.iarray);
+            } else if (slot.kind == IntrKind::Float) {
+                ctx->push((uint64_t)(int64_t)slot.fvalue);
             } else {
-                ctx->istack.push(ctx->ivar_map[id->value]);
+                ctx->push((uint64_t)slot.ivalue);
             }
         } break;
         
         case V_AstType::ArrayAccess: {
-            auto acc = std::static_pointer_cast<AstArrayAccess>(expr);
+            auto acc = static_cast<AstArrayAccess *>(expr);
             run_iexpression(ctx, acc->index);
-            int idx = ctx->istack.top();
-            ctx->istack.pop();
-            ctx->istack.push(ctx->iarray_map[acc->value][idx]);
+            int idx = ctx->pop_int();
+            
+            IntrSlot &slot = ctx->slots[acc->slot];
+            if (slot.kind == IntrKind::FloatArray) {
+                ctx->push((uint64_t)(int64_t)(*slot.farray)[idx]);
+            } else {
+                ctx->push((*slot.iarray)[idx]);
+            }
         } break;
         
         // Function call expression
         case V_AstType::FuncCallExpr: {
-            auto fc = std::static_pointer_cast<AstFuncCallExpr>(expr);
+            auto fc = static_cast<AstFuncCallExpr *>(expr);
             if (fc->name == "malloc" || fc->name == "gc_alloc") {
-                auto args = std::static_pointer_cast<AstExprList>(fc->args);
-                auto mul = std::static_pointer_cast<AstMulOp>(args->list[0]);
+                auto args = static_cast<AstExprList *>(fc->args);
+                auto mul = static_cast<AstMulOp *>(args->list[0]);
                 run_iexpression(ctx, mul->rval);
-                int length = ctx->istack.top();
-                ctx->istack_array = std::vector<uint64_t>();
-                for (int i = 0; i<length; i++) {
-                    ctx->istack_array.push_back(0);
-                }
-                ctx->istack.pop();
+                int length = ctx->pop_int();
+                ctx->push(std::make_shared<std::vector<uint64_t>>(length > 0 ? length : 0, 0));
             } else {
-                auto func = function_map[fc->name];
-                if (func && func->data_type->type == V_AstType::Ptr) {
-                    auto array = call_function(ctx, fc->name, std::static_pointer_cast<AstExprList>(fc->args));
-                    ctx->istack_array = *std::get_if<std::vector<uint64_t>>(&array);
+                auto func = find_function(fc->id);
+                auto value = call_function(ctx, fc->id, static_cast<AstExprList *>(fc->args));
+                if (func && is_float_type(func->data_type) && func->data_type->type != V_AstType::Ptr) {
+                    ctx->push((uint64_t)(int64_t)value.fvalue);
                 } else {
-                    auto value = call_function(ctx, fc->name, std::static_pointer_cast<AstExprList>(fc->args));
-                    ctx->istack.push(*std::get_if<uint64_t>(&value));
+                    ctx->push(std::move(value));
                 }
             }
         } break;
         
         // Assign operator
         case V_AstType::Assign: {
-            auto op = std::static_pointer_cast<AstAssignOp>(expr);
+            auto op = static_cast<AstAssignOp *>(expr);
             run_iexpression(ctx, op->rval);
             
             switch (op->lval->type) {
                 // Simple variables
                 case V_AstType::ID: {
-                    auto id = std::static_pointer_cast<AstID>(op->lval);
-                    if (is_int_array(ctx, id->value)) {
-                        ctx->iarray_map[id->value] = ctx->istack_array;
-                        ctx->istack_array.clear();
+                    auto id = static_cast<AstID *>(op->lval);
+                    if (is_int_array(ctx, id->slot)) {
+                        ctx->slots[id->slot].iarray = ctx->pop().iarray;
                     } else {
-                        ctx->ivar_map[id->value] = ctx->istack.top();
-                        ctx->istack.pop();
+                        ctx->slots[id->slot].ivalue = ctx->pop_int();
                     }
                 } break;
                 
                 // Array access
                 case V_AstType::ArrayAccess: {
-                    auto acc = std::static_pointer_cast<AstArrayAccess>(op->lval);
-                    int value = ctx->istack.top();
-                    ctx->istack.pop();
+                    auto acc = static_cast<AstArrayAccess *>(op->lval);
+                    int value = ctx->pop_int();
                     
                     run_iexpression(ctx, acc->index);
-                    int idx = ctx->istack.top();
-                    ctx->istack.pop();
+                    int idx = ctx->pop_int();
                     
-                    ctx->iarray_map[acc->value][idx] = value;
+                    (*ctx->slots[acc->slot].iarray)[idx] = value;
                 } break;
                 
                 // Unknown lval
@@ -102,6 +107,29 @@ void AstInterpreter::run_iexpression(std::shared_ptr<IntrContext> ctx, std::shar
             }
         } break;
         
+        // Negation
+        case V_AstType::Neg: {
+            auto op = static_cast<AstNegOp *>(expr);
+            run_iexpression(ctx, op->value);
+            ctx->push(-ctx->pop_int());
+        } break;
+        
+        // Comparisons
+        // If either side is a float, both sides are compared as floats.
+        case V_AstType::EQ:
+        case V_AstType::NEQ:
+        case V_AstType::GT:
+        case V_AstType::LT:
+        case V_AstType::GTE:
+        case V_AstType::LTE: {
+            auto op = static_cast<AstBinaryOp *>(expr);
+            if (is_float_expression(ctx, op->lval) || is_float_expression(ctx, op->rval)) {
+                run_fcompare(ctx, op);
+                break;
+            }
+        }
+        // fallthrough
+        
         // Operators
         case V_AstType::Add:
         case V_AstType::Sub:
@@ -113,146 +141,266 @@ void AstInterpreter::run_iexpression(std::shared_ptr<IntrContext> ctx, std::shar
         case V_AstType::Xor:
         case V_AstType::Lsh:
         case V_AstType::Rsh:
-        case V_AstType::EQ:
-        case V_AstType::NEQ:
-        case V_AstType::GT:
-        case V_AstType::LT:
-        case V_AstType::GTE:
-        case V_AstType::LTE:
         {
-            auto op = std::static_pointer_cast<AstBinaryOp>(expr);
+            auto op = static_cast<AstBinaryOp *>(expr);
             run_iexpression(ctx, op->lval);
             run_iexpression(ctx, op->rval);
             
-            uint64_t rval = ctx->istack.top();
-            ctx->istack.pop();
-            uint64_t lval = ctx->istack.top();
-            ctx->istack.pop();
+            uint64_t rval = ctx->pop_int();
+            uint64_t lval = ctx->pop_int();
             
-            if (expr->type == V_AstType::Add) ctx->istack.push(lval + rval);
-            else if (expr->type == V_AstType::Sub) ctx->istack.push(lval - rval);
-            else if (expr->type == V_AstType::Mul) ctx->istack.push(lval * rval);
-            else if (expr->type == V_AstType::Div) ctx->istack.push(lval / rval);
-            else if (expr->type == V_AstType::Mod) ctx->istack.push(lval % rval);
-            else if (expr->type == V_AstType::And) ctx->istack.push(lval & rval);
-            else if (expr->type == V_AstType::Or)  ctx->istack.push(lval | rval);
-            else if (expr->type == V_AstType::Xor) ctx->istack.push(lval ^ rval);
-            else if (expr->type == V_AstType::Lsh) ctx->istack.push(lval << rval);
-            else if (expr->type == V_AstType::Rsh) ctx->istack.push(lval >> rval);
-            else if (expr->type == V_AstType::EQ)  ctx->istack.push((int)(lval == rval));
-            else if (expr->type == V_AstType::NEQ) ctx->istack.push((int)(lval != rval));
-            else if (expr->type == V_AstType::GT)  ctx->istack.push((int)(lval > rval));
-            else if (expr->type == V_AstType::LT)  ctx->istack.push((int)(lval < rval));
-            else if (expr->type == V_AstType::GTE) ctx->istack.push((int)(lval >= rval));
-            else if (expr->type == V_AstType::LTE) ctx->istack.push((int)(lval <= rval));
+            if (expr->type == V_AstType::Add) ctx->push(lval + rval);
+            else if (expr->type == V_AstType::Sub) ctx->push(lval - rval);
+            else if (expr->type == V_AstType::Mul) ctx->push(lval * rval);
+            else if (expr->type == V_AstType::Div) ctx->push(lval / rval);
+            else if (expr->type == V_AstType::Mod) ctx->push(lval % rval);
+            else if (expr->type == V_AstType::And) ctx->push(lval & rval);
+            else if (expr->type == V_AstType::Or)  ctx->push(lval | rval);
+            else if (expr->type == V_AstType::Xor) ctx->push(lval ^ rval);
+            else if (expr->type == V_AstType::Lsh) ctx->push(lval << rval);
+            else if (expr->type == V_AstType::Rsh) ctx->push(lval >> rval);
+            else if (expr->type == V_AstType::EQ)  ctx->push((uint64_t)(lval == rval));
+            else if (expr->type == V_AstType::NEQ) ctx->push((uint64_t)(lval != rval));
+            else if (expr->type == V_AstType::GT)  ctx->push((uint64_t)(lval > rval));
+            else if (expr->type == V_AstType::LT)  ctx->push((uint64_t)(lval < rval));
+            else if (expr->type == V_AstType::GTE) ctx->push((uint64_t)(lval >= rval));
+            else if (expr->type == V_AstType::LTE) ctx->push((uint64_t)(lval <= rval));
         } break;
         
         default: {}
     }
 }
 
-// Runs a floating point expression
-void AstInterpreter::run_fexpression(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExpression> expr) {
+// Compares two floats, leaving an integer result
+void AstInterpreter::run_fcompare(IntrContext *ctx, AstBinaryOp *op) {
+    run_fexpression(ctx, op->lval);
+    run_fexpression(ctx, op->rval);
+    
+    double rval = ctx->pop_float();
+    double lval = ctx->pop_float();
+    
+    switch (op->type) {
+        case V_AstType::EQ: ctx->push((uint64_t)(lval == rval)); break;
+        case V_AstType::NEQ: ctx->push((uint64_t)(lval != rval)); break;
+        case V_AstType::GT: ctx->push((uint64_t)(lval > rval)); break;
+        case V_AstType::LT: ctx->push((uint64_t)(lval < rval)); break;
+        case V_AstType::GTE: ctx->push((uint64_t)(lval >= rval)); break;
+        case V_AstType::LTE: ctx->push((uint64_t)(lval <= rval)); break;
+        default: ctx->push((uint64_t)0);
+    }
+}
 
+// Runs a floating point expression
+void AstInterpreter::run_fexpression(IntrContext *ctx, AstExpression *expr) {
+    switch (expr->type) {
+        // Constants
+        case V_AstType::IntL: {
+            auto i = static_cast<AstInt *>(expr);
+            ctx->push((double)(int64_t)i->value);
+        } break;
+        
+        case V_AstType::FloatL: {
+            auto f = static_cast<AstFloat *>(expr);
+            ctx->push(f->value);
+        } break;
+        
+        // Variables
+        case V_AstType::ID: {
+            auto id = static_cast<AstID *>(expr);
+            IntrSlot &slot = ctx->slots[id->slot];
+            if (slot.kind == IntrKind::FloatArray) {
+                ctx->push(slot.farray);
+            } else if (slot.kind == IntrKind::Int) {
+                ctx->push((double)(int64_t)slot.ivalue);
+            } else {
+                ctx->push(slot.fvalue);
+            }
+        } break;
+        
+        case V_AstType::ArrayAccess: {
+            auto acc = static_cast<AstArrayAccess *>(expr);
+            run_iexpression(ctx, acc->index);
+            int idx = ctx->pop_int();
+            
+            IntrSlot &slot = ctx->slots[acc->slot];
+            if (slot.kind == IntrKind::IntArray) {
+                ctx->push((double)(int64_t)(*slot.iarray)[idx]);
+            } else {
+                ctx->push((*slot.farray)[idx]);
+            }
+        } break;
+        
+        // Function call expression
+        case V_AstType::FuncCallExpr: {
+            auto fc = static_cast<AstFuncCallExpr *>(expr);
+            if (fc->name == "malloc" || fc->name == "gc_alloc") {
+                auto args = static_cast<AstExprList *>(fc->args);
+                auto mul = static_cast<AstMulOp *>(args->list[0]);
+                run_iexpression(ctx, mul->rval);
+                int length = ctx->pop_int();
+                ctx->push(std::make_shared<std::vector<double>>(length > 0 ? length : 0, 0));
+            } else {
+                auto func = find_function(fc->id);
+                auto value = call_function(ctx, fc->id, static_cast<AstExprList *>(fc->args));
+                if (func && is_int_type(func->data_type) && func->data_type->type != V_AstType::Ptr) {
+                    ctx->push((double)(int64_t)value.ivalue);
+                } else {
+                    ctx->push(std::move(value));
+                }
+            }
+        } break;
+        
+        // Assign operator
+        case V_AstType::Assign: {
+            auto op = static_cast<AstAssignOp *>(expr);
+            run_fexpression(ctx, op->rval);
+            
+            switch (op->lval->type) {
+                // Simple variables
+                case V_AstType::ID: {
+                    auto id = static_cast<AstID *>(op->lval);
+                    IntrSlot &slot = ctx->slots[id->slot];
+                    if (slot.kind == IntrKind::FloatArray) {
+                        slot.farray = ctx->pop().farray;
+                    } else {
+                        slot.fvalue = fit_float(slot.type, ctx->pop_float());
+                    }
+                } break;
+                
+                // Array access
+                case V_AstType::ArrayAccess: {
+                    auto acc = static_cast<AstArrayAccess *>(op->lval);
+                    IntrSlot &slot = ctx->slots[acc->slot];
+                    double value = fit_float(slot.type, ctx->pop_float());
+                    
+                    run_iexpression(ctx, acc->index);
+                    int idx = ctx->pop_int();
+                    
+                    (*slot.farray)[idx] = value;
+                } break;
+                
+                // Unknown lval
+                default: {}
+            }
+        } break;
+        
+        // Negation
+        case V_AstType::Neg: {
+            auto op = static_cast<AstNegOp *>(expr);
+            run_fexpression(ctx, op->value);
+            ctx->push(-ctx->pop_float());
+        } break;
+        
+        // Operators
+        case V_AstType::Add:
+        case V_AstType::Sub:
+        case V_AstType::Mul:
+        case V_AstType::Div:
+        case V_AstType::Mod:
+        {
+            auto op = static_cast<AstBinaryOp *>(expr);
+            run_fexpression(ctx, op->lval);
+            run_fexpression(ctx, op->rval);
+            
+            double rval = ctx->pop_float();
+            double lval = ctx->pop_float();
+            
+            if (expr->type == V_AstType::Add) ctx->push(lval + rval);
+            else if (expr->type == V_AstType::Sub) ctx->push(lval - rval);
+            else if (expr->type == V_AstType::Mul) ctx->push(lval * rval);
+            else if (expr->type == V_AstType::Div) ctx->push(lval / rval);
+            else if (expr->type == V_AstType::Mod) ctx->push(std::fmod(lval, rval));
+        } break;
+        
+        // Anything else only makes sense on integers, so the result is converted
+        default: {
+            run_iexpression(ctx, expr);
+            ctx->push((double)(int64_t)ctx->pop_int());
+        }
+    }
 }
 
 // Runs a string expression
-void AstInterpreter::run_sexpression(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExpression> expr) {
+void AstInterpreter::run_sexpression(IntrContext *ctx, AstExpression *expr) {
     switch (expr->type) {
         // Constants
         case V_AstType::IntL: {
-            auto i = std::static_pointer_cast<AstInt>(expr);
-            ctx->sstack.push(std::to_string(i->value));
+            auto i = static_cast<AstInt *>(expr);
+            ctx->push(std::to_string(i->value));
         } break;
         
         case V_AstType::CharL: {
-            auto c = std::static_pointer_cast<AstChar>(expr);
-            ctx->sstack.push(std::string(1, c->value));
+            auto c = static_cast<AstChar *>(expr);
+            ctx->push(std::string(1, c->value));
         } break;
         
         case V_AstType::StringL: {
-            auto s = std::static_pointer_cast<AstString>(expr);
-            ctx->sstack.push(s->value);
+            auto s = static_cast<AstString *>(expr);
+            ctx->push(s->value);
         } break;
         
         // Variables
         case V_AstType::ID: {
-            auto id = std::static_pointer_cast<AstID>(expr);
-            if (is_string_array(ctx, id->value)) {
-                ctx->sstack.push(id->value);
+            auto id = static_cast<AstID *>(expr);
+            if (is_string_array(ctx, id->slot)) {
+                ctx->push(ctx->slots[id->slot].sarray);
             } else {
-                ctx->sstack.push(ctx->svar_map[id->value]);
+                ctx->push(ctx->slots[id->slot].svalue);
             }
         } break;
         
         case V_AstType::ArrayAccess: {
-            auto acc = std::static_pointer_cast<AstArrayAccess>(expr);
+            auto acc = static_cast<AstArrayAccess *>(expr);
             run_iexpression(ctx, acc->index);
-            int idx = ctx->istack.top();
-            ctx->istack.pop();
+            int idx = ctx->pop_int();
             
-            if (ctx->type_map[acc->value]->type == V_AstType::String) {
-                char c = ctx->svar_map[acc->value][idx];
-                ctx->sstack.push(std::string(1, c));
+            if (ctx->slots[acc->slot].type->type == V_AstType::String) {
+                char c = ctx->slots[acc->slot].svalue[idx];
+                ctx->push(std::string(1, c));
             } else {
-                ctx->sstack.push(ctx->sarray_map[acc->value][idx]);
+                ctx->push((*ctx->slots[acc->slot].sarray)[idx]);
             }
         } break;
         
         // Function call expression
         case V_AstType::FuncCallExpr: {
-            auto fc = std::static_pointer_cast<AstFuncCallExpr>(expr);
+            auto fc = static_cast<AstFuncCallExpr *>(expr);
             if (fc->name == "malloc" || fc->name == "gc_alloc") {
-                auto args = std::static_pointer_cast<AstExprList>(fc->args);
-                auto mul = std::static_pointer_cast<AstMulOp>(args->list[0]);
+                auto args = static_cast<AstExprList *>(fc->args);
+                auto mul = static_cast<AstMulOp *>(args->list[0]);
                 run_iexpression(ctx, mul->rval);
-                int length = ctx->istack.top();
-                ctx->sstack_array = std::vector<std::string>();
-                for (int i = 0; i<length; i++) {
-                    ctx->sstack_array.push_back("");
-                }
-                ctx->istack.pop();
+                int length = ctx->pop_int();
+                ctx->push(std::make_shared<std::vector<std::string>>(length > 0 ? length : 0));
             } else {
-                auto func = function_map[fc->name];
-                if (func && func->data_type->type == V_AstType::Ptr) {
-                    auto array = call_function(ctx, fc->name, std::static_pointer_cast<AstExprList>(fc->args));
-                    ctx->sstack_array = *std::get_if<std::vector<std::string>>(&array);
-                } else {
-                    auto value = call_function(ctx, fc->name, std::static_pointer_cast<AstExprList>(fc->args));
-                    ctx->sstack.push(*std::get_if<std::string>(&value));
-                }
+                ctx->push(call_function(ctx, fc->id, static_cast<AstExprList *>(fc->args)));
             }
         } break;
         
         // Assign operator
         case V_AstType::Assign: {
-            auto op = std::static_pointer_cast<AstAssignOp>(expr);
+            auto op = static_cast<AstAssignOp *>(expr);
             run_sexpression(ctx, op->rval);
             
             switch (op->lval->type) {
                 // Simple variables
                 case V_AstType::ID: {
-                    auto id = std::static_pointer_cast<AstID>(op->lval);
-                    if (is_string_array(ctx, id->value)) {
-                        ctx->sarray_map[id->value] = ctx->sstack_array;
-                        ctx->sstack_array.clear();
+                    auto id = static_cast<AstID *>(op->lval);
+                    if (is_string_array(ctx, id->slot)) {
+                        ctx->slots[id->slot].sarray = ctx->pop().sarray;
                     } else {
-                        ctx->svar_map[id->value] = ctx->sstack.top();
-                        ctx->sstack.pop();
+                        ctx->slots[id->slot].svalue = ctx->pop_string();
                     }
                 } break;
                 
                 // Array access
                 case V_AstType::ArrayAccess: {
-                    auto acc = std::static_pointer_cast<AstArrayAccess>(op->lval);
-                    std::string value = ctx->sstack.top();
-                    ctx->sstack.pop();
+                    auto acc = static_cast<AstArrayAccess *>(op->lval);
+                    std::string value = ctx->pop_string();
                     
                     run_iexpression(ctx, acc->index);
-                    int idx = ctx->istack.top();
-                    ctx->istack.pop();
+                    int idx = ctx->pop_int();
                     
-                    ctx->sarray_map[acc->value][idx] = value;
+                    (*ctx->slots[acc->slot].sarray)[idx] = value;
                 } break;
                 
                 // Unknown lval
@@ -263,14 +411,12 @@ void AstInterpreter::run_sexpression(std::shared_ptr<IntrContext> ctx, std::shar
         // Operators
         /*case V_AstType::Add:
         {
-            auto op = std::static_pointer_cast<AstBinaryOp>(expr);
+            auto op = static_cast<AstBinaryOp *>(expr);
             run_iexpression(ctx, op->lval);
             run_iexpression(ctx, op->rval);
             
-            uint64_t rval = ctx->istack.top();
-            ctx->istack.pop();
-            uint64_t lval = ctx->istack.top();
-            ctx->istack.pop();
+            uint64_t rval = ctx->pop_int();
+            uint64_t lval = ctx->pop_int();
             
         } break;*/
         
@@ -8,36 +8,62 @@
 //
 // For running functions
 //
-vm_arg_list AstInterpreter::run_function(std::shared_ptr<AstFunction> func, std::vector<vm_arg_list> args) {   
-    auto ctx = std::make_shared<IntrContext>();
+IntrValue AstInterpreter::run_function(IntrFunction &function, std::vector<IntrValue> args) {
+    AstFunction *func = function.func;
+    
+    // Hot functions are handed to the JIT
+    // A loop that is already running stays in the interpreter; the function
+    // goes native from its next call on.
+    if (!function.tiered && jit_threshold >= 0 && function.heat >= (uint64_t)jit_threshold) {
+        tier_up(function);
+    }
+    
+    if (function.native) return run_native(function, args);
+    function.heat++;
+    
+    IntrContext context;
+    IntrContext *ctx = &context;
+    ctx->slots = stack.push(function.frame_size);
+    ctx->function = &function;
     ctx->func_type = func->data_type;
+    ctx->values = &values;
+    ctx->base = values.size();
     
-    // Merge arguments into the symbol table
+    // Merge arguments into the frame
+    // The resolve pass puts the arguments in the first slots, in order.
     for (int i = 0; i<func->args.size(); i++) {
         auto arg = func->args[i];
+        IntrSlot &slot = ctx->slots[i];
+        
         // Arrays
         if (arg.type->type == V_AstType::Ptr) {
-            auto ptr = std::static_pointer_cast<AstPointerType>(arg.type);
-            ctx->type_map[arg.name] = ptr->base_type;
+            auto ptr = static_cast<AstPointerType *>(arg.type);
+            slot.type = ptr->base_type;
             
             if (is_int_type(ptr->base_type)) {
-                ctx->iarray_map[arg.name] = *std::get_if<std::vector<uint64_t>>(&args[i]);
+                slot.kind = IntrKind::IntArray;
+                slot.iarray = std::move(args[i].iarray);
             } else if (is_float_type(ptr->base_type)) {
-            
+                slot.kind = IntrKind::FloatArray;
+                slot.farray = std::move(args[i].farray);
             } else if (is_string_type(ptr->base_type)) {
-                ctx->sarray_map[arg.name] = *std::get_if<std::vector<std::string>>(&args[i]);
+                slot.kind = IntrKind::StringArray;
+                slot.sarray = std::move(args[i].sarray);
             }
             
         // Scalar variables
         } else {
-            ctx->type_map[arg.name] = arg.type;
+            slot.type = arg.type;
             
             if (is_int_type(arg.type)) {
-                ctx->ivar_map[arg.name] = *std::get_if<uint64_t>(&args[i]);
+                slot.kind = IntrKind::Int;
+                slot.ivalue = args[i].ivalue;
             } else if (is_float_type(arg.type)) {
-            
+                slot.kind = IntrKind::Float;
+                slot.fvalue = fit_float(arg.type, args[i].fvalue);
             } else if (is_string_type(arg.type)) {
-                ctx->svar_map[arg.name] = *std::get_if<std::string>(&args[i]);
+                slot.kind = IntrKind::String;
+                slot.svalue = std::move(args[i].svalue);
             }
         }
     }
@@ -46,54 +72,47 @@ vm_arg_list AstInterpreter::run_function(std::shared_ptr<AstFunction> func, std:
     run_block(ctx, func->block);
     
     // At the end, check the stack
-    if (is_int_type(func->data_type)) {
-        if (func->data_type->type == V_AstType::Ptr) {
-            std::string name = ctx->sstack.top();
-            return ctx->iarray_map[name];
-        }
-        if (ctx->istack.empty()) return (uint64_t)0;
-        return ctx->istack.top();
-    } else if (is_float_type(func->data_type)) {
-    
+    // The return statement leaves its value on top.
+    IntrValue result = (uint64_t)0;
+    if (func->data_type->type != V_AstType::Ptr && is_float_type(func->data_type)) {
+        result = ctx->empty() ? 0.0 : fit_float(func->data_type, ctx->pop_float());
+    } else if (!ctx->empty()) {
+        result = ctx->pop();
     } else if (is_string_type(func->data_type)) {
-        std::string value = "";
-        if (func->data_type->type == V_AstType::Ptr) {
-            std::string name = ctx->sstack.top();
-            return ctx->sarray_map[name];
-        }
-        if (!ctx->sstack.empty()) {
-            value = ctx->sstack.top();
-        }
-        return value;
+        result = std::string("");
     }
     
-    return (uint64_t)0;
+    values.truncate(ctx->base);
+    stack.pop(ctx->slots, function.frame_size);
+    return result;
 }
 
-vm_arg_list AstInterpreter::call_function(std::shared_ptr<IntrContext> ctx, std::string name, std::shared_ptr<AstExprList> args) {
+IntrValue AstInterpreter::call_function(IntrContext *ctx, SymbolId name, AstExprList *args) {
     // Handle the "length" call for arrays and strings
-    if (name == "length") {
+    static const SymbolId length_id = Symbol::intern("length");
+    if (name == length_id) {
         auto arg1 = args->list[0];
         if (arg1->type == V_AstType::ID) {
-            auto id = std::static_pointer_cast<AstID>(arg1);
-            if (is_int_array(ctx, id->value)) {
-                return (uint64_t)ctx->iarray_map[id->value].size();
-            } else if (is_float_array(ctx, id->value)) {
-            
-            } else if (is_string_array(ctx, id->value)) {
-                return (uint64_t)ctx->sarray_map[id->value].size();
-            } else if (ctx->type_map[id->value]->type == V_AstType::String) {
-                return (uint64_t)ctx->svar_map[id->value].length();
+            auto id = static_cast<AstID *>(arg1);
+            if (is_int_array(ctx, id->slot)) {
+                return (uint64_t)ctx->slots[id->slot].iarray->size();
+            } else if (is_float_array(ctx, id->slot)) {
+                return (uint64_t)ctx->slots[id->slot].farray->size();
+            } else if (is_string_array(ctx, id->slot)) {
+                return (uint64_t)ctx->slots[id->slot].sarray->size();
+            } else if (ctx->slots[id->slot].type->type == V_AstType::String) {
+                return (uint64_t)ctx->slots[id->slot].svalue.length();
             }
         } else if (arg1->type == V_AstType::StringL) {
-            auto s = std::static_pointer_cast<AstString>(arg1);
+            auto s = static_cast<AstString *>(arg1);
             return (uint64_t)s->value.length();
         }
     }
     
     // Otherwise, pull from the table
-    auto func = function_map[name];
-    std::vector<vm_arg_list> addrs;
+    IntrFunction &function = function_map[name];
+    auto func = function.func;
+    std::vector<IntrValue> addrs;
     
     // TODO: Check type
     for (int i = 0; i<args->list.size(); i++) {
@@ -102,72 +121,75 @@ vm_arg_list AstInterpreter::call_function(std::shared_ptr<IntrContext> ctx, std:
         
         // Pointers
         if (data_type->type == V_AstType::Ptr) {
-            auto base_type = std::static_pointer_cast<AstPointerType>(data_type)->base_type;
-            auto id = std::static_pointer_cast<AstID>(arg);
+            auto base_type = static_cast<AstPointerType *>(data_type)->base_type;
+            auto id = static_cast<AstID *>(arg);
             if (is_int_type(base_type)) {
-                addrs.push_back(ctx->iarray_map[id->value]);
+                addrs.push_back(ctx->slots[id->slot].iarray);
             } else if (is_float_type(base_type)) {
-            
+                addrs.push_back(ctx->slots[id->slot].farray);
             } else if (is_string_type(base_type)) {
-                addrs.push_back(ctx->sarray_map[id->value]);
+                addrs.push_back(ctx->slots[id->slot].sarray);
             }
             
         // Everything else
         } else {
             if (is_int_type(data_type)) {
                 run_iexpression(ctx, arg);
-                uint64_t value = ctx->istack.top();
-                ctx->istack.pop();
-                addrs.push_back(value);
+                addrs.push_back(ctx->pop_int());
             } else if (is_float_type(data_type)) {
-            
+                run_fexpression(ctx, arg);
+                addrs.push_back(ctx->pop_float());
             } else if (is_string_type(data_type)) {
                 run_sexpression(ctx, arg);
-                std::string value = ctx->sstack.top();
-                ctx->sstack.pop();
-                addrs.push_back(value);
+                addrs.push_back(ctx->pop_string());
             }
         }
     }
     
     // Run it
-    return run_function(func, addrs);
+    return run_function(function, std::move(addrs));
 }
 
 //
 // Runs the builtin print call
 //
-void AstInterpreter::run_print(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExprList> args) {
+void AstInterpreter::run_print(IntrContext *ctx, AstExprList *args) {
     for (auto const &arg : args->list) {
         switch (arg->type) {
             // Print a string literal
             case V_AstType::StringL: {
-                auto s = std::static_pointer_cast<AstString>(arg);
+                auto s = static_cast<AstString *>(arg);
                 std::cout << s->value;
             } break;
             
             // Print a character literal
             case V_AstType::CharL: {
-                auto c = std::static_pointer_cast<AstChar>(arg);
+                auto c = static_cast<AstChar *>(arg);
                 std::cout << c->value;
             } break;
             
             // Print an integer literal
             case V_AstType::IntL: {
-                auto i = std::static_pointer_cast<AstInt>(arg);
+                auto i = static_cast<AstInt *>(arg);
                 std::cout << i->value;
             } break;
             
+            // Print a float literal
+            case V_AstType::FloatL: {
+                auto f = static_cast<AstFloat *>(arg);
+                std::cout << f->value;
+            } break;
+            
             // Identifier
             // TODO: Eventually clean this up
             case V_AstType::ID: {
-                auto id = std::static_pointer_cast<AstID>(arg);
-                auto data_type = ctx->type_map[id->value];
+                auto id = static_cast<AstID *>(arg);
+                auto data_type = ctx->slots[id->slot].type;
                 
                 // Integers
                 if (is_int_type(data_type)) {
-                    if (is_int_array(ctx, id->value)) {
-                        auto array = ctx->iarray_map[id->value];
+                    if (is_int_array(ctx, id->slot)) {
+                        auto &array = *ctx->slots[id->slot].iarray;
                         std::cout << "[";
                         for (int i = 0; i<array.size(); i++) {
                             std::cout << array[i];
@@ -175,16 +197,27 @@ void AstInterpreter::run_print(std::shared_ptr<IntrContext> ctx, std::shared_ptr
                         }
                         std::cout << "]";
                     } else {
-                        std::cout << ctx->ivar_map[id->value];
+                        std::cout << (int64_t)ctx->slots[id->slot].ivalue;
                     }
                 
-                // Floatss
+                // Floats
                 } else if (is_float_type(data_type)) {
+                    if (is_float_array(ctx, id->slot)) {
+                        auto &array = *ctx->slots[id->slot].farray;
+                        std::cout << "[";
+                        for (int i = 0; i<array.size(); i++) {
+                            std::cout << array[i];
+                            if (i+1 < array.size()) std::cout << ", ";
+                        }
+                        std::cout << "]";
+                    } else {
+                        std::cout << ctx->slots[id->slot].fvalue;
+                    }
                 
                 // Strings
                 } else if (is_string_type(data_type)) {
-                    if (is_string_array(ctx, id->value)) {
-                        auto array = ctx->sarray_map[id->value];
+                    if (is_string_array(ctx, id->slot)) {
+                        auto &array = *ctx->slots[id->slot].sarray;
                         std::cout << "[";
                         for (int i = 0; i<array.size(); i++) {
                             std::cout << "\"" << array[i] << "\"";
@@ -192,53 +225,53 @@ void AstInterpreter::run_print(std::shared_ptr<IntrContext> ctx, std::shared_ptr
                         }
                         std::cout << "]";
                     } else {
-                        std::cout << ctx->svar_map[id->value];
+                        std::cout << ctx->slots[id->slot].svalue;
                     }
                 }
             } break;
             
             // Array access
             case V_AstType::ArrayAccess: {
-                auto acc = std::static_pointer_cast<AstArrayAccess>(arg);
+                auto acc = static_cast<AstArrayAccess *>(arg);
                 run_iexpression(ctx, acc->index);
-                int idx = ctx->istack.top();
-                ctx->istack.pop();
+                int idx = ctx->pop_int();
                 
-                if (is_int_array(ctx, acc->value)) {
-                    std::cout << ctx->iarray_map[acc->value][idx];
-                } else if (is_float_array(ctx, acc->value)) {
-                
-                } else if (is_string_array(ctx, acc->value)) {
-                    std::cout << ctx->sarray_map[acc->value][idx];
-                } else if (ctx->type_map[acc->value]->type == V_AstType::String) {
-                    std::cout << ctx->svar_map[acc->value][idx];
+                if (is_int_array(ctx, acc->slot)) {
+                    std::cout << (*ctx->slots[acc->slot].iarray)[idx];
+                } else if (is_float_array(ctx, acc->slot)) {
+                    std::cout << (*ctx->slots[acc->slot].farray)[idx];
+                } else if (is_string_array(ctx, acc->slot)) {
+                    std::cout << (*ctx->slots[acc->slot].sarray)[idx];
+                } else if (ctx->slots[acc->slot].type->type == V_AstType::String) {
+                    std::cout << ctx->slots[acc->slot].svalue[idx];
                 }
             } break;
             
             // Function call expression
             // TODO: Type checking
             case V_AstType::FuncCallExpr: {
-                auto fc = std::static_pointer_cast<AstFuncCallExpr>(arg);
-                auto value = call_function(ctx, fc->name, std::static_pointer_cast<AstExprList>(fc->args));
+                auto fc = static_cast<AstFuncCallExpr *>(arg);
+                auto value = call_function(ctx, fc->id, static_cast<AstExprList *>(fc->args));
                 
                 // The length function
                 if (fc->name == "length") {
-                    std::cout << *std::get_if<uint64_t>(&value);
+                    std::cout << value.ivalue;
                     
                 // All other functions
                 } else {
-                    auto func_type = function_map[fc->name]->data_type;
+                    auto func_type = function_map[fc->id].func->data_type;
                     if (is_int_type(func_type)) {
-                        std::cout << *std::get_if<uint64_t>(&value);
+                        std::cout << value.ivalue;
                     } else if (is_float_type(func_type)) {
-                    
+                        std::cout << value.fvalue;
                     } else if (is_string_type(func_type)) {
-                        std::cout << *std::get_if<std::string>(&value);
+                        std::cout << value.svalue;
                     }
                 }
             } break;
             
             // Print a binary operation
+            case V_AstType::Neg:
             case V_AstType::Add:
             case V_AstType::Sub:
             case V_AstType::Mul:
@@ -263,11 +296,9 @@ void AstInterpreter::run_print(std::shared_ptr<IntrContext> ctx, std::shared_ptr
                 }
                 
                 run_expression(ctx, arg, data_type);
-                if (data_type->type == V_AstType::Int32) {
-                    std::cout << ctx->istack.top();
-                    ctx->istack.pop();
-                }
-                // TODO: Other types here
+                if (is_int_type(data_type)) std::cout << ctx->pop_int();
+                else if (is_float_type(data_type)) std::cout << ctx->pop_float();
+                else if (is_string_type(data_type)) std::cout << ctx->pop_string();
             } break;
             
             default: {
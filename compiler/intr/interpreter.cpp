@@ -12,34 +12,41 @@ AstInterpreter::AstInterpreter(std::shared_ptr<AstTree> tree) {
     this->tree = tree;
 }
 
+AstInterpreter::~AstInterpreter() {}
+
 //
 // The entry point of the interpreter
 //
-// The first step is to catalog all our functions, and then run
-// the main function.
+// The first step is to catalog all our functions and give their variables
+// slots, and then run the main function.
 //
 int AstInterpreter::run() {
+    int index = 0;
     for (auto const& stmt : tree->block->block) {
         if (stmt->type != V_AstType::Func) continue;
         
-        auto func = std::static_pointer_cast<AstFunction>(stmt);
-        function_map[func->name] = func;
+        auto func = static_cast<AstFunction *>(stmt);
+        IntrFunction &function = function_map[Symbol::intern(func->name)];
+        function.func = func;
+        function.frame_size = resolve_function(func);
+        function.index = index++;
     }
     
     // Verify we have the main function
-    if (function_map.find("main") == function_map.end()) {
+    SymbolId main_id = Symbol::intern("main");
+    if (function_map.find(main_id) == function_map.end()) {
         std::cout << "[FATAL] Unable to find main function." << std::endl;
         return 1;
     }
     
-    auto val = run_function(function_map["main"], std::vector<vm_arg_list>());
-    return *std::get_if<uint64_t>(&val);
+    auto val = run_function(function_map[main_id], std::vector<IntrValue>());
+    return val.ivalue;
 }
 
 //
 // Runs a block of statements
 //
-void AstInterpreter::run_block(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstBlock> block) {
+void AstInterpreter::run_block(IntrContext *ctx, AstBlock *block) {
     // TODO: Create symbol table within the context
     
     // Run the block
@@ -47,7 +54,7 @@ void AstInterpreter::run_block(std::shared_ptr<IntrContext> ctx, std::shared_ptr
         switch (stmt->type) {
             // Expression statements
             case V_AstType::ExprStmt: {
-                auto stmt2 = std::static_pointer_cast<AstExprStatement>(stmt);
+                auto stmt2 = static_cast<AstExprStatement *>(stmt);
                 run_expression(ctx, stmt2->expression, stmt2->dataType);
             } break;
         
@@ -62,12 +69,12 @@ void AstInterpreter::run_block(std::shared_ptr<IntrContext> ctx, std::shared_ptr
             
             // Function calls
             case V_AstType::FuncCallStmt: {
-                auto fc = std::static_pointer_cast<AstFuncCallStmt>(stmt);
+                auto fc = static_cast<AstFuncCallStmt *>(stmt);
                 if (fc->name == "print") {
-                    run_print(ctx, std::static_pointer_cast<AstExprList>(fc->expression));
+                    run_print(ctx, static_cast<AstExprList *>(fc->expression));
                 } else {
-                    auto args = std::static_pointer_cast<AstExprList>(fc->expression);
-                    call_function(ctx, fc->name, args);
+                    auto args = static_cast<AstExprList *>(fc->expression);
+                    call_function(ctx, fc->id, args);
                 }
             } break;
             
@@ -83,30 +90,38 @@ void AstInterpreter::run_block(std::shared_ptr<IntrContext> ctx, std::shared_ptr
 //
 // Variable and array declarations
 //
-void AstInterpreter::run_var_decl(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstStatement> stmt) {
-    auto vd = std::static_pointer_cast<AstVarDec>(stmt);
+void AstInterpreter::run_var_decl(IntrContext *ctx, AstStatement *stmt) {
+    auto vd = static_cast<AstVarDec *>(stmt);
+    
+    IntrSlot &slot = ctx->slots[vd->slot];
     
     // Arrays need slightly different treatment
     if (vd->data_type->type == V_AstType::Ptr) {
-        auto ptr_type = std::static_pointer_cast<AstPointerType>(vd->data_type);
-        ctx->type_map[vd->name] = ptr_type->base_type;
+        auto ptr_type = static_cast<AstPointerType *>(vd->data_type);
+        slot.type = ptr_type->base_type;
         if (is_int_type(ptr_type->base_type)) {
-            ctx->iarray_map[vd->name] = std::vector<uint64_t>();
+            slot.kind = IntrKind::IntArray;
+            slot.iarray = std::make_shared<std::vector<uint64_t>>();
         } else if (is_float_type(ptr_type->base_type)) {
-        
+            slot.kind = IntrKind::FloatArray;
+            slot.farray = std::make_shared<std::vector<double>>();
         } else if (is_string_type(ptr_type->base_type)) {
-            ctx->sarray_map[vd->name] = std::vector<std::string>();
+            slot.kind = IntrKind::StringArray;
+            slot.sarray = std::make_shared<std::vector<std::string>>();
         }
         
-    // Regular scalar variables go right into the normal variable tables
+    // Regular scalar variables go right into their slot
     } else {
-        ctx->type_map[vd->name] = vd->data_type;
+        slot.type = vd->data_type;
         if (is_int_type(vd->data_type)) {
-            ctx->ivar_map[vd->name] = 0;
+            slot.kind = IntrKind::Int;
+            slot.ivalue = 0;
         } else if (is_float_type(vd->data_type)) {
-        
+            slot.kind = IntrKind::Float;
+            slot.fvalue = 0;
         } else if (is_string_type(vd->data_type)) {
-            ctx->svar_map[vd->name] = "";
+            slot.kind = IntrKind::String;
+            slot.svalue = "";
         }
     }
 }
@@ -114,12 +129,11 @@ void AstInterpreter::run_var_decl(std::shared_ptr<IntrContext> ctx, std::shared_
 //
 // Runs a conditional statement
 //
-void AstInterpreter::run_cond(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstStatement> stmt) {
-    auto cond = std::static_pointer_cast<AstIfStmt>(stmt);
+void AstInterpreter::run_cond(IntrContext *ctx, AstStatement *stmt) {
+    auto cond = static_cast<AstIfStmt *>(stmt);
     
     run_iexpression(ctx, cond->expression);
-    bool result = (bool)ctx->istack.top();
-    ctx->istack.pop();
+    bool result = (bool)ctx->pop_int();
     
     if (result) run_block(ctx, cond->true_block);
     else run_block(ctx, cond->false_block);
@@ -128,15 +142,15 @@ void AstInterpreter::run_cond(std::shared_ptr<IntrContext> ctx, std::shared_ptr<
 //
 // Runs a while loop
 //
-void AstInterpreter::run_while(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstStatement> stmt) {
-    auto loop = std::static_pointer_cast<AstWhileStmt>(stmt);
+void AstInterpreter::run_while(IntrContext *ctx, AstStatement *stmt) {
+    auto loop = static_cast<AstWhileStmt *>(stmt);
     
     while (true) {
         run_iexpression(ctx, loop->expression);
-        bool result = (bool)ctx->istack.top();
-        ctx->istack.pop();
+        bool result = (bool)ctx->pop_int();
         if (result == false) break;
         run_block(ctx, loop->block);
+        ctx->function->heat++;
     }
 }
 
@@ -145,15 +159,36 @@ void AstInterpreter::run_while(std::shared_ptr<IntrContext> ctx, std::shared_ptr
 // Note: We only return either Int32, String, or Float32, since these generalize
 // to one of the three overall types are expression works with.
 //
-// Generally, we decide on types based on the lval
+// Generally, we decide on types based on the lval. The literal types are
+// shared, so nothing is allocated while the program runs.
 //
-std::shared_ptr<AstDataType> AstInterpreter::interpret_type(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExpression> expr) {
+AstDataType *AstInterpreter::interpret_type(IntrContext *ctx, AstExpression *expr) {
+    static AstDataType int_type(V_AstType::Int32);
+    static AstDataType float_type(V_AstType::Float64);
+    
     switch (expr->type) {
-        case V_AstType::IntL: return AstBuilder::buildInt32Type();
+        case V_AstType::IntL: return &int_type;
+        case V_AstType::FloatL: return &float_type;
         
         case V_AstType::ID: {
-            auto id = std::static_pointer_cast<AstID>(expr);
-            return ctx->type_map[id->value];
+            auto id = static_cast<AstID *>(expr);
+            return ctx->slots[id->slot].type;
+        }
+        
+        case V_AstType::ArrayAccess: {
+            auto acc = static_cast<AstArrayAccess *>(expr);
+            return ctx->slots[acc->slot].type;
+        }
+        
+        case V_AstType::FuncCallExpr: {
+            auto func = find_function(static_cast<AstFuncCallExpr *>(expr)->id);
+            if (func) return func->data_type;
+            return nullptr;
+        }
+        
+        case V_AstType::Neg: {
+            auto op = static_cast<AstNegOp *>(expr);
+            return interpret_type(ctx, op->value);
         }
         
         case V_AstType::Add:
@@ -173,7 +208,7 @@ std::shared_ptr<AstDataType> AstInterpreter::interpret_type(std::shared_ptr<Intr
         case V_AstType::GTE:
         case V_AstType::LTE:
         {
-            auto op = std::static_pointer_cast<AstBinaryOp>(expr);
+            auto op = static_cast<AstBinaryOp *>(expr);
             auto d_type = interpret_type(ctx, op->lval);
             if (d_type) return d_type;
             d_type = interpret_type(ctx, op->rval);
@@ -190,7 +225,7 @@ std::shared_ptr<AstDataType> AstInterpreter::interpret_type(std::shared_ptr<Intr
 //
 // Helper functions for determining the three general type
 //
-bool AstInterpreter::is_int_type(std::shared_ptr<AstDataType> data_type) {
+bool AstInterpreter::is_int_type(AstDataType *data_type) {
     switch (data_type->type) {
         case V_AstType::Bool:
         case V_AstType::Int8:
@@ -199,7 +234,7 @@ bool AstInterpreter::is_int_type(std::shared_ptr<AstDataType> data_type) {
         case V_AstType::Int64: return true;
         
         case V_AstType::Ptr: {
-            auto ptr = std::static_pointer_cast<AstPointerType>(data_type);
+            auto ptr = static_cast<AstPointerType *>(data_type);
             return is_int_type(ptr->base_type);
         }
         
@@ -209,13 +244,13 @@ bool AstInterpreter::is_int_type(std::shared_ptr<AstDataType> data_type) {
     return false;
 }
 
-bool AstInterpreter::is_float_type(std::shared_ptr<AstDataType> data_type) {
+bool AstInterpreter::is_float_type(AstDataType *data_type) {
     switch (data_type->type) {
         case V_AstType::Float32:
         case V_AstType::Float64: return true;
         
         case V_AstType::Ptr: {
-            auto ptr = std::static_pointer_cast<AstPointerType>(data_type);
+            auto ptr = static_cast<AstPointerType *>(data_type);
             return is_float_type(ptr->base_type);
         }
         
@@ -225,13 +260,13 @@ bool AstInterpreter::is_float_type(std::shared_ptr<AstDataType> data_type) {
     return false;
 }
 
-bool AstInterpreter::is_string_type(std::shared_ptr<AstDataType> data_type) {
+bool AstInterpreter::is_string_type(AstDataType *data_type) {
     switch (data_type->type) {
         case V_AstType::Char:
         case V_AstType::String: return true;
         
         case V_AstType::Ptr: {
-            auto ptr = std::static_pointer_cast<AstPointerType>(data_type);
+            auto ptr = static_cast<AstPointerType *>(data_type);
             return is_string_type(ptr->base_type);
         }
         
@@ -241,20 +276,171 @@ bool AstInterpreter::is_string_type(std::shared_ptr<AstDataType> data_type) {
     return false;
 }
 
+//
+// Checks whether an expression needs floating point math
+// This is used to decide how to compare two values, since comparisons are always
+// run as integer expressions.
+//
+bool AstInterpreter::is_float_expression(IntrContext *ctx, AstExpression *expr) {
+    switch (expr->type) {
+        case V_AstType::FloatL: return true;
+        case V_AstType::ID: return ctx->slots[static_cast<AstID *>(expr)->slot].kind == IntrKind::Float;
+        case V_AstType::ArrayAccess: return is_float_array(ctx, static_cast<AstArrayAccess *>(expr)->slot);
+        case V_AstType::Neg: return is_float_expression(ctx, static_cast<AstNegOp *>(expr)->value);
+        
+        case V_AstType::FuncCallExpr: {
+            auto func = find_function(static_cast<AstFuncCallExpr *>(expr)->id);
+            return func && func->data_type->type != V_AstType::Ptr && is_float_type(func->data_type);
+        }
+        
+        case V_AstType::Add:
+        case V_AstType::Sub:
+        case V_AstType::Mul:
+        case V_AstType::Div:
+        case V_AstType::Mod: {
+            auto op = static_cast<AstBinaryOp *>(expr);
+            return is_float_expression(ctx, op->lval) || is_float_expression(ctx, op->rval);
+        }
+        
+        default: {}
+    }
+    
+    return false;
+}
+
+//
+// Looks up a user function without adding builtins to the table
+//
+AstFunction *AstInterpreter::find_function(SymbolId name) {
+    auto function = function_map.find(name);
+    if (function == function_map.end()) return nullptr;
+    return function->second.func;
+}
+
+//
+// Rounds a value to the precision of the type it is being stored to
+//
+double AstInterpreter::fit_float(AstDataType *data_type, double value) {
+    if (data_type->type == V_AstType::Float32) return (float)value;
+    return value;
+}
+
 //
 // Helper functions for determining if a variable is an array of one of the general types
 //
-bool AstInterpreter::is_int_array(std::shared_ptr<IntrContext> ctx, std::string name) {
-    if (ctx->iarray_map.find(name) == ctx->iarray_map.end()) return false;
-    return true;
+bool AstInterpreter::is_int_array(IntrContext *ctx, int slot) {
+    return ctx->slots[slot].kind == IntrKind::IntArray;
 }
 
-bool AstInterpreter::is_float_array(std::shared_ptr<IntrContext> ctx, std::string name) {
-    return false;
+bool AstInterpreter::is_float_array(IntrContext *ctx, int slot) {
+    return ctx->slots[slot].kind == IntrKind::FloatArray;
+}
+
+bool AstInterpreter::is_string_array(IntrContext *ctx, int slot) {
+    return ctx->slots[slot].kind == IntrKind::StringArray;
 }
 
-bool AstInterpreter::is_string_array(std::shared_ptr<IntrContext> ctx, std::string name) {
-    if (ctx->sarray_map.find(name) == ctx->sarray_map.end()) return false;
-    return true;
+//
+// Copies a value
+// Numbers are copied directly; everything else goes through the real copy
+// constructor of its member.
+//
+IntrValue &IntrValue::operator=(const IntrValue &other) {
+    if (this == &other) return *this;
+    if (kind > IntrKind::Float) release();
+    
+    kind = other.kind;
+    switch (kind) {
+        case IntrKind::Float: fvalue = other.fvalue; break;
+        case IntrKind::String: new (&svalue) std::string(other.svalue); break;
+        case IntrKind::IntArray: new (&iarray) IntrIntArray(other.iarray); break;
+        case IntrKind::FloatArray: new (&farray) IntrFloatArray(other.farray); break;
+        case IntrKind::StringArray: new (&sarray) IntrStringArray(other.sarray); break;
+        default: ivalue = other.ivalue;
+    }
+    
+    return *this;
 }
 
+IntrValue &IntrValue::operator=(IntrValue &&other) noexcept {
+    if (this == &other) return *this;
+    if (kind > IntrKind::Float) release();
+    
+    kind = other.kind;
+    switch (kind) {
+        case IntrKind::Float: fvalue = other.fvalue; break;
+        case IntrKind::String: new (&svalue) std::string(std::move(other.svalue)); break;
+        case IntrKind::IntArray: new (&iarray) IntrIntArray(std::move(other.iarray)); break;
+        case IntrKind::FloatArray: new (&farray) IntrFloatArray(std::move(other.farray)); break;
+        case IntrKind::StringArray: new (&sarray) IntrStringArray(std::move(other.sarray)); break;
+        default: ivalue = other.ivalue;
+    }
+    
+    return *this;
+}
+
+//
+// Destroys whatever the value holds
+// This is only called for strings and arrays.
+//
+void IntrValue::release() {
+    switch (kind) {
+        case IntrKind::String: svalue.~basic_string(); break;
+        case IntrKind::IntArray: iarray.~IntrIntArray(); break;
+        case IntrKind::FloatArray: farray.~IntrFloatArray(); break;
+        case IntrKind::StringArray: sarray.~IntrStringArray(); break;
+        default: {}
+    }
+    
+    kind = IntrKind::Int;
+    ivalue = 0;
+}
+
+//
+// Takes values off the expression stack
+//
+std::string IntrContext::pop_string() {
+    IntrValue &value = values->top();
+    values->drop();
+    if (value.kind == IntrKind::String) return std::move(value.svalue);
+    return "";
+}
+
+//
+// Takes a frame from the top of the stack
+// When the current chunk is full, the frame starts at the beginning of the next
+// one instead, so frames are always contiguous.
+//
+IntrSlot *IntrStack::push(int count) {
+    while (current < chunks.size()) {
+        Chunk &chunk = chunks[current];
+        if (chunk.used + count <= chunk.size) {
+            IntrSlot *frame = chunk.slots.get() + chunk.used;
+            chunk.used += count;
+            return frame;
+        }
+        
+        if (current + 1 == chunks.size()) break;
+        ++current;
+    }
+    
+    Chunk chunk;
+    chunk.size = count > 1024 ? count : 1024;
+    chunk.slots = std::make_unique<IntrSlot[]>(chunk.size);
+    chunk.used = count;
+    
+    if (!chunks.empty()) ++current;
+    chunks.push_back(std::move(chunk));
+    return chunks[current].slots.get();
+}
+
+//
+// Hands the top frame back, and clears out its slots for the next call
+//
+void IntrStack::pop(IntrSlot *frame, int count) {
+    for (int i = 0; i<count; i++) frame[i] = IntrSlot();
+    
+    // Any chunks above the one holding the frame are empty by now
+    while (current > 0 && chunks[current].used == 0) --current;
+    chunks[current].used -= count;
+}
@@ -3,80 +3,311 @@
 #include <string>
 #include <memory>
 #include <map>
-#include <stack>
+#include <unordered_map>
 #include <vector>
 #include <cstdint>
-#include <variant>
+#include <type_traits>
 
 #include <ast/ast.hpp>
 
 //
-// This contains the contextual information
-// Every function creates a context
+// The kinds of values a slot can hold
 //
-// * var_map -> Holds variable values
-// * stack -> Holds values from expression evaluation
+enum class IntrKind {
+    None,
+    Int,
+    Float,
+    String,
+    IntArray,
+    FloatArray,
+    StringArray
+};
+
 //
-struct IntrContext {
-    std::map<std::string, std::shared_ptr<AstDataType>> type_map;
-    std::shared_ptr<AstDataType> func_type;
+// Array storage
+// Arrays are handles to shared storage, the same way they are pointers in
+// compiled code. Passing, returning, or assigning an array only copies the
+// handle, and all copies see the same elements.
+//
+typedef std::shared_ptr<std::vector<uint64_t>> IntrIntArray;
+typedef std::shared_ptr<std::vector<double>> IntrFloatArray;
+typedef std::shared_ptr<std::vector<std::string>> IntrStringArray;
+
+//
+// A single value
+// This is what expressions leave on the stack, and what is passed to and
+// returned from functions. Numbers are held directly in the value, and the
+// string and array members are only constructed when the value holds one, so
+// pushing and popping numbers never touches the heap.
+//
+// Floats are always held as doubles, and are rounded when they are stored to
+// an f32 variable.
+//
+struct IntrValue {
+    IntrValue() : kind(IntrKind::Int), ivalue(0) {}
+    IntrValue(uint64_t value) : kind(IntrKind::Int), ivalue(value) {}
+    IntrValue(double value) : kind(IntrKind::Float), fvalue(value) {}
+    IntrValue(std::string value) : kind(IntrKind::String), svalue(std::move(value)) {}
+    IntrValue(IntrIntArray value) : kind(IntrKind::IntArray), iarray(std::move(value)) {}
+    IntrValue(IntrFloatArray value) : kind(IntrKind::FloatArray), farray(std::move(value)) {}
+    IntrValue(IntrStringArray value) : kind(IntrKind::StringArray), sarray(std::move(value)) {}
+    
+    IntrValue(const IntrValue &other) : kind(IntrKind::Int), ivalue(0) { *this = other; }
+    IntrValue(IntrValue &&other) noexcept : kind(IntrKind::Int), ivalue(0) { *this = std::move(other); }
+    ~IntrValue() { if (kind > IntrKind::Float) release(); }
+    
+    IntrValue &operator=(const IntrValue &other);
+    IntrValue &operator=(IntrValue &&other) noexcept;
+    
+    bool is_number() { return kind <= IntrKind::Float; }
     
-    // For variable storage
-    std::map<std::string, int> ivar_map;
-    std::map<std::string, std::string> svar_map;
+    void set(uint64_t value) {
+        if (kind > IntrKind::Float) release();
+        kind = IntrKind::Int;
+        ivalue = value;
+    }
     
-    // For array storage
-    std::map<std::string, std::vector<uint64_t>> iarray_map;
-    std::map<std::string, std::vector<std::string>> sarray_map;
+    void set(double value) {
+        if (kind > IntrKind::Float) release();
+        kind = IntrKind::Float;
+        fvalue = value;
+    }
     
-    // For expression evaluation
-    std::stack<uint64_t> istack;
-    std::stack<double> fstack;
-    std::stack<std::string> sstack;
+    // A slot that already holds a string keeps its buffer
+    template <class T>
+    void set_string(T &&value) {
+        if (kind == IntrKind::String) {
+            svalue = std::forward<T>(value);
+            return;
+        }
+        
+        if (kind > IntrKind::Float) release();
+        new (&svalue) std::string(std::forward<T>(value));
+        kind = IntrKind::String;
+    }
     
-    // For a few specific operations
-    std::vector<uint64_t> istack_array;
-    std::vector<std::string> sstack_array;
+    IntrKind kind;
+    union {
+        uint64_t ivalue;
+        double fvalue;
+        std::string svalue;
+        IntrIntArray iarray;
+        IntrFloatArray farray;
+        IntrStringArray sarray;
+    };
+    
+private:
+    void release();
 };
 
 //
-// For passing arguments
+// A single local variable
+// The resolve pass gives every local in a function its own slot, so variables
+// are found by index instead of by name.
 //
-typedef std::variant<uint64_t, float, std::string, std::vector<uint64_t>, std::vector<float>, std::vector<std::string>> vm_arg_list;
+struct IntrSlot {
+    IntrKind kind = IntrKind::None;
+    AstDataType *type = nullptr;
+    
+    uint64_t ivalue = 0;
+    double fvalue = 0;
+    std::string svalue;
+    IntrIntArray iarray;
+    IntrFloatArray farray;
+    IntrStringArray sarray;
+};
+
+//
+// Hands out frames of slots in last-in, first-out order
+// Frames are carved out of large chunks that never move, so a frame stays
+// where it is while the functions it calls push frames of their own.
+//
+struct IntrStack {
+    IntrSlot *push(int count);
+    void pop(IntrSlot *frame, int count);
+    
+private:
+    struct Chunk {
+        std::unique_ptr<IntrSlot[]> slots;
+        int size = 0;
+        int used = 0;
+    };
+    
+    std::vector<Chunk> chunks;
+    size_t current = 0;
+};
+
+//
+// Native code for a function, through its JIT entry point
+// Arguments and the result are passed as 64-bit slots.
+//
+typedef void (*IntrNative)(uint64_t *args, uint64_t *result);
+
+//
+// A function, along with the size of its frame
+//
+// * index -> Where the function is in the source file
+// * heat -> Bumped on every call and every loop iteration
+// * tiered -> Set once the function has been tried with the JIT
+// * native -> The compiled function, if the JIT took it
+//
+struct IntrFunction {
+    AstFunction *func = nullptr;
+    int frame_size = 0;
+    int index = 0;
+    
+    uint64_t heat = 0;
+    bool tiered = false;
+    IntrNative native = nullptr;
+};
+
+class Jit;
+
+//
+// Compiles hot functions to native code
+// The tree walker and the bytecode VM each keep their own heat counts, and
+// both come here once a function gets hot. The functions are cataloged from
+// the tree, since the code generator works on the AST either way.
+//
+struct IntrTier {
+    explicit IntrTier(std::shared_ptr<AstTree> tree);
+    ~IntrTier();
+    IntrNative compile(AstFunction *func);
+    
+    // Set if the JIT couldn't be started, so callers can stop trying
+    bool failed = false;
+    
+protected:
+    std::shared_ptr<AstTree> tree;
+    std::unordered_map<SymbolId, IntrFunction> function_map;
+    std::unique_ptr<Jit> jit;
+};
+
+//
+// The expression stack
+// Every call shares one stack, and a call only ever looks at the values above
+// where its own stack started. Popping a value does not destroy it; the slot is
+// simply reused by the next push, so pushing and popping numbers never has to
+// leave the inline fast path.
+//
+struct IntrValueStack {
+    template <class T>
+    void push(T &&value) {
+        using V = std::decay_t<T>;
+        if constexpr (std::is_integral_v<V>) next().set((uint64_t)value);
+        else if constexpr (std::is_floating_point_v<V>) next().set((double)value);
+        else if constexpr (std::is_same_v<V, std::string>) next().set_string(std::forward<T>(value));
+        else next() = IntrValue(std::forward<T>(value));
+    }
+    
+    IntrValue pop() { return std::move(values[--count]); }
+    IntrValue &top() { return values[count - 1]; }
+    void drop() { --count; }
+    
+    size_t size() { return count; }
+    void truncate(size_t size) { count = size; }
+    
+private:
+    IntrValue &next() {
+        if (count == values.size()) values.resize(count * 2 + 64);
+        return values[count++];
+    }
+    
+    std::vector<IntrValue> values;
+    size_t count = 0;
+};
+
+//
+// This contains the contextual information
+// Every function call creates a context
+//
+// * slots -> Holds variable values, indexed by the slot from the resolve pass
+// * function -> The function being run
+// * values -> Holds values from expression evaluation, of any type
+// * base -> Where this call's values start on the shared stack
+//
+struct IntrContext {
+    IntrSlot *slots = nullptr;
+    IntrFunction *function = nullptr;
+    AstDataType *func_type = nullptr;
+    IntrValueStack *values = nullptr;
+    size_t base = 0;
+    
+    template <class T>
+    void push(T &&value) { values->push(std::forward<T>(value)); }
+    
+    bool empty() { return values->size() == base; }
+    IntrValue pop() { return values->pop(); }
+    std::string pop_string();
+    
+    // Numbers are converted if they aren't already the type that was asked for
+    uint64_t pop_int() {
+        IntrValue &value = values->top();
+        values->drop();
+        if (value.kind == IntrKind::Int) return value.ivalue;
+        return value.kind == IntrKind::Float ? (int64_t)value.fvalue : 0;
+    }
+    
+    double pop_float() {
+        IntrValue &value = values->top();
+        values->drop();
+        if (value.kind == IntrKind::Float) return value.fvalue;
+        return value.kind == IntrKind::Int ? (int64_t)value.ivalue : 0;
+    }
+};
 
 //
 // This handles running the actual interpreter
 //
 struct AstInterpreter {
     explicit AstInterpreter(std::shared_ptr<AstTree> tree);
+    ~AstInterpreter();
     int run();
     
+    // Functions are compiled once their heat reaches this; below zero turns it off
+    int64_t jit_threshold = 1000;
+    
     // function.cpp
-    vm_arg_list run_function(std::shared_ptr<AstFunction> func, std::vector<vm_arg_list> args);
-    vm_arg_list call_function(std::shared_ptr<IntrContext> ctx, std::string name, std::shared_ptr<AstExprList> args);
-    void run_print(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExprList> args);
+    IntrValue run_function(IntrFunction &function, std::vector<IntrValue> args);
+    IntrValue call_function(IntrContext *ctx, SymbolId name, AstExprList *args);
+    void run_print(IntrContext *ctx, AstExprList *args);
     
     // interpreter.cpp
-    void run_block(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstBlock> block);
-    void run_var_decl(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstStatement> stmt);
-    void run_cond(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstStatement> stmt);
-    void run_while(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstStatement> stmt);
-    std::shared_ptr<AstDataType> interpret_type(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExpression> expr);
-    bool is_int_type(std::shared_ptr<AstDataType> data_type);
-    bool is_float_type(std::shared_ptr<AstDataType> data_type);
-    bool is_string_type(std::shared_ptr<AstDataType> data_type);
-    bool is_int_array(std::shared_ptr<IntrContext> ctx, std::string name);
-    bool is_float_array(std::shared_ptr<IntrContext> ctx, std::string name);
-    bool is_string_array(std::shared_ptr<IntrContext> ctx, std::string name);
+    void run_block(IntrContext *ctx, AstBlock *block);
+    void run_var_decl(IntrContext *ctx, AstStatement *stmt);
+    void run_cond(IntrContext *ctx, AstStatement *stmt);
+    void run_while(IntrContext *ctx, AstStatement *stmt);
+    AstDataType *interpret_type(IntrContext *ctx, AstExpression *expr);
+    bool is_int_type(AstDataType *data_type);
+    bool is_float_type(AstDataType *data_type);
+    bool is_string_type(AstDataType *data_type);
+    bool is_float_expression(IntrContext *ctx, AstExpression *expr);
+    AstFunction *find_function(SymbolId name);
+    double fit_float(AstDataType *data_type, double value);
+    bool is_int_array(IntrContext *ctx, int slot);
+    bool is_float_array(IntrContext *ctx, int slot);
+    bool is_string_array(IntrContext *ctx, int slot);
     
     // expression.cpp
-    void run_expression(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExpression> expr, std::shared_ptr<AstDataType> type);
-    void run_iexpression(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExpression> expr);
-    void run_fexpression(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExpression> expr);
-    void run_sexpression(std::shared_ptr<IntrContext> ctx, std::shared_ptr<AstExpression> expr);
+    void run_expression(IntrContext *ctx, AstExpression *expr, AstDataType *type);
+    void run_iexpression(IntrContext *ctx, AstExpression *expr);
+    void run_fexpression(IntrContext *ctx, AstExpression *expr);
+    void run_fcompare(IntrContext *ctx, AstBinaryOp *op);
+    void run_sexpression(IntrContext *ctx, AstExpression *expr);
+    
+    // resolve.cpp
+    int resolve_function(AstFunction *func);
+    
+    // tier.cpp
+    void tier_up(IntrFunction &function);
+    IntrValue run_native(IntrFunction &function, std::vector<IntrValue> &args);
     
 protected:
     std::shared_ptr<AstTree> tree;
-    std::map<std::string, std::shared_ptr<AstFunction>> function_map;
+    std::unordered_map<SymbolId, IntrFunction> function_map;
+    IntrStack stack;
+    IntrValueStack values;
+    std::unique_ptr<IntrTier> tier;
+    std::vector<uint64_t> native_args;
 };
 
@@ -0,0 +1,157 @@
+#include <unordered_map>
+#include <vector>
+
+#include <ast/ast.hpp>
+
+#include "interpreter.hpp"
+
+//
+// Walks a function and numbers its variables
+//
+// Each block's variables come after the ones in the blocks around it, and the
+// slots are handed back at the end of the block so sibling blocks can share them.
+//
+struct IntrResolver {
+    std::vector<std::unordered_map<SymbolId, int>> scopes;
+    int next = 0;
+    int frame_size = 0;
+
+    int declare(SymbolId id) {
+        int slot = next++;
+        if (next > frame_size) frame_size = next;
+        scopes.back()[id] = slot;
+        return slot;
+    }
+
+    //
+    // Names that were never declared get a slot at the function level, the same
+    // way the old name-keyed tables quietly created them
+    //
+    int lookup(SymbolId id) {
+        for (auto scope = scopes.rbegin(); scope != scopes.rend(); scope++) {
+            auto slot = scope->find(id);
+            if (slot != scope->end()) return slot->second;
+        }
+
+        int slot = next++;
+        if (next > frame_size) frame_size = next;
+        scopes.front()[id] = slot;
+        return slot;
+    }
+
+    void resolve_block(AstBlock *block) {
+        if (!block) return;
+
+        int saved = next;
+        scopes.emplace_back();
+
+        for (auto const &stmt : block->block) {
+            resolve_statement(stmt);
+        }
+
+        scopes.pop_back();
+        next = saved;
+    }
+
+    void resolve_statement(AstStatement *stmt) {
+        switch (stmt->type) {
+            case V_AstType::VarDec: {
+                auto vd = static_cast<AstVarDec *>(stmt);
+                vd->slot = declare(vd->id);
+            } break;
+
+            case V_AstType::If: {
+                auto cond = static_cast<AstIfStmt *>(stmt);
+                resolve_expression(cond->expression);
+                resolve_block(cond->true_block);
+                resolve_block(cond->false_block);
+            } break;
+
+            case V_AstType::While: {
+                auto loop = static_cast<AstWhileStmt *>(stmt);
+                resolve_expression(loop->expression);
+                resolve_block(loop->block);
+            } break;
+
+            default: {
+                if (stmt->hasExpression()) resolve_expression(stmt->expression);
+            }
+        }
+    }
+
+    void resolve_expression(AstExpression *expr) {
+        if (!expr) return;
+
+        switch (expr->type) {
+            case V_AstType::ID: {
+                auto id = static_cast<AstID *>(expr);
+                id->slot = lookup(id->id);
+            } break;
+
+            case V_AstType::ArrayAccess: {
+                auto acc = static_cast<AstArrayAccess *>(expr);
+                acc->slot = lookup(acc->id);
+                resolve_expression(acc->index);
+            } break;
+
+            case V_AstType::ExprList: {
+                auto list = static_cast<AstExprList *>(expr);
+                for (auto const &item : list->list) resolve_expression(item);
+            } break;
+
+            case V_AstType::FuncCallExpr: {
+                auto fc = static_cast<AstFuncCallExpr *>(expr);
+                resolve_expression(fc->args);
+            } break;
+
+            case V_AstType::Neg: {
+                auto op = static_cast<AstUnaryOp *>(expr);
+                resolve_expression(op->value);
+            } break;
+
+            case V_AstType::Assign:
+            case V_AstType::Add:
+            case V_AstType::Sub:
+            case V_AstType::Mul:
+            case V_AstType::Div:
+            case V_AstType::Mod:
+            case V_AstType::And:
+            case V_AstType::Or:
+            case V_AstType::Xor:
+            case V_AstType::Lsh:
+            case V_AstType::Rsh:
+            case V_AstType::EQ:
+            case V_AstType::NEQ:
+            case V_AstType::GT:
+            case V_AstType::LT:
+            case V_AstType::GTE:
+            case V_AstType::LTE:
+            case V_AstType::LogicalAnd:
+            case V_AstType::LogicalOr:
+            {
+                auto op = static_cast<AstBinaryOp *>(expr);
+                resolve_expression(op->lval);
+                resolve_expression(op->rval);
+            } break;
+
+            default: {}
+        }
+    }
+};
+
+//
+// Gives every variable in a function a slot in its frame, and returns how many
+// slots the frame needs. The arguments take the first slots, in order.
+//
+int AstInterpreter::resolve_function(AstFunction *func) {
+    IntrResolver resolver;
+    resolver.scopes.emplace_back();
+
+    for (auto const &arg : func->args) {
+        resolver.declare(arg.id);
+    }
+
+    resolver.resolve_block(func->block);
+    return resolver.frame_size;
+}
+
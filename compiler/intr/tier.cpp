@@ -0,0 +1,295 @@
+#include <iostream>
+#include <cstring>
+#include <unordered_set>
+#include <algorithm>
+
+#include <ast/ast.hpp>
+#include <llvm/Jit.hpp>
+
+#include "interpreter.hpp"
+
+//
+// Checks whether a function can be handed to the native code generator
+//
+// Only functions that stick to scalar numbers qualify, along with everything
+// they call. The callees are gathered up as well, since the whole group goes
+// into one module. A function can only call ones that come before it (or
+// itself), which is the order the code generator needs them in.
+//
+struct IntrTierScan {
+    std::unordered_map<SymbolId, IntrFunction> &function_map;
+    std::unordered_set<AstFunction *> seen;
+    std::vector<IntrFunction *> group;
+    
+    std::unordered_set<SymbolId> locals;
+    int index = 0;
+    
+    explicit IntrTierScan(std::unordered_map<SymbolId, IntrFunction> &function_map)
+        : function_map(function_map) {}
+    
+    static bool is_scalar(AstDataType *data_type) {
+        switch (data_type->type) {
+            case V_AstType::Bool:
+            case V_AstType::Int8:
+            case V_AstType::Int16:
+            case V_AstType::Int32:
+            case V_AstType::Int64:
+            case V_AstType::Float32:
+            case V_AstType::Float64: return true;
+            
+            default: {}
+        }
+        
+        return false;
+    }
+    
+    bool scan_function(IntrFunction &function) {
+        auto func = function.func;
+        if (!seen.insert(func).second) return true;
+        group.push_back(&function);
+        
+        if (func->data_type->type != V_AstType::Void && !is_scalar(func->data_type)) return false;
+        
+        // Each function has its own variables, so save the caller's
+        auto saved_locals = std::move(locals);
+        int saved_index = index;
+        locals.clear();
+        index = function.index;
+        
+        bool result = true;
+        for (auto const &arg : func->args) {
+            if (!is_scalar(arg.type)) result = false;
+            locals.insert(arg.id);
+        }
+        
+        if (result) result = scan_block(func->block);
+        
+        locals = std::move(saved_locals);
+        index = saved_index;
+        return result;
+    }
+    
+    bool scan_call(SymbolId name, AstExpression *args) {
+        auto function = function_map.find(name);
+        if (function == function_map.end() || !function->second.func) return false;
+        if (function->second.index > index) return false;
+        
+        if (!scan_expression(args)) return false;
+        return scan_function(function->second);
+    }
+    
+    bool scan_block(AstBlock *block) {
+        if (!block) return true;
+        
+        for (auto const &stmt : block->block) {
+            if (!scan_statement(stmt)) return false;
+        }
+        
+        return true;
+    }
+    
+    bool scan_statement(AstStatement *stmt) {
+        switch (stmt->type) {
+            case V_AstType::VarDec: {
+                auto vd = static_cast<AstVarDec *>(stmt);
+                if (!is_scalar(vd->data_type)) return false;
+                locals.insert(vd->id);
+            } return true;
+            
+            case V_AstType::ExprStmt: return scan_expression(stmt->expression);
+            
+            case V_AstType::Return: {
+                if (!stmt->hasExpression()) return true;
+                return scan_expression(stmt->expression);
+            }
+            
+            case V_AstType::FuncCallStmt: {
+                auto fc = static_cast<AstFuncCallStmt *>(stmt);
+                return scan_call(fc->id, fc->expression);
+            }
+            
+            case V_AstType::If: {
+                auto cond = static_cast<AstIfStmt *>(stmt);
+                return scan_expression(cond->expression)
+                    && scan_block(cond->true_block)
+                    && scan_block(cond->false_block);
+            }
+            
+            case V_AstType::While: {
+                auto loop = static_cast<AstWhileStmt *>(stmt);
+                return scan_expression(loop->expression) && scan_block(loop->block);
+            }
+            
+            default: {}
+        }
+        
+        return false;
+    }
+    
+    bool scan_expression(AstExpression *expr) {
+        if (!expr) return true;
+        
+        switch (expr->type) {
+            case V_AstType::IntL:
+            case V_AstType::FloatL: return true;
+            
+            case V_AstType::ID: {
+                auto id = static_cast<AstID *>(expr);
+                return locals.find(id->id) != locals.end();
+            }
+            
+            case V_AstType::ExprList: {
+                auto list = static_cast<AstExprList *>(expr);
+                for (auto const &item : list->list) {
+                    if (!scan_expression(item)) return false;
+                }
+            } return true;
+            
+            case V_AstType::FuncCallExpr: {
+                auto fc = static_cast<AstFuncCallExpr *>(expr);
+                return scan_call(fc->id, fc->args);
+            }
+            
+            case V_AstType::Neg: {
+                auto op = static_cast<AstUnaryOp *>(expr);
+                return scan_expression(op->value);
+            }
+            
+            case V_AstType::Assign: {
+                auto op = static_cast<AstBinaryOp *>(expr);
+                if (op->lval->type != V_AstType::ID) return false;
+                return scan_expression(op->lval) && scan_expression(op->rval);
+            }
+            
+            case V_AstType::Add:
+            case V_AstType::Sub:
+            case V_AstType::Mul:
+            case V_AstType::Div:
+            case V_AstType::Mod:
+            case V_AstType::And:
+            case V_AstType::Or:
+            case V_AstType::Xor:
+            case V_AstType::Lsh:
+            case V_AstType::Rsh:
+            case V_AstType::EQ:
+            case V_AstType::NEQ:
+            case V_AstType::GT:
+            case V_AstType::LT:
+            case V_AstType::GTE:
+            case V_AstType::LTE:
+            case V_AstType::LogicalAnd:
+            case V_AstType::LogicalOr:
+            {
+                auto op = static_cast<AstBinaryOp *>(expr);
+                return scan_expression(op->lval) && scan_expression(op->rval);
+            }
+            
+            default: {}
+        }
+        
+        return false;
+    }
+};
+
+//
+// Catalogs the functions in the tree, in source order
+//
+IntrTier::IntrTier(std::shared_ptr<AstTree> tree) {
+    this->tree = tree;
+    
+    int index = 0;
+    for (auto const &stmt : tree->block->block) {
+        if (stmt->type != V_AstType::Func) continue;
+        
+        auto func = static_cast<AstFunction *>(stmt);
+        IntrFunction &function = function_map[Symbol::intern(func->name)];
+        function.func = func;
+        function.index = index++;
+    }
+}
+
+IntrTier::~IntrTier() {}
+
+//
+// Tries to compile a function to native code
+//
+// If the function (or anything it calls) uses something the code generator
+// can't take yet, or the module doesn't come out valid, this returns null and
+// the function just keeps running where it is.
+//
+IntrNative IntrTier::compile(AstFunction *func) {
+    auto function = function_map.find(Symbol::intern(func->name));
+    if (failed || function == function_map.end()) return nullptr;
+    
+    IntrTierScan scan(function_map);
+    if (!scan.scan_function(function->second)) return nullptr;
+    
+    if (!jit) {
+        std::string error;
+        jit = Jit::create(error);
+        if (!jit) {
+            std::cerr << "[JIT] " << error << std::endl;
+            failed = true;
+            return nullptr;
+        }
+    }
+    
+    // The group goes into its own tree, in source order
+    std::sort(scan.group.begin(), scan.group.end(), [](IntrFunction *a, IntrFunction *b) {
+        return a->index < b->index;
+    });
+    
+    auto group = std::make_shared<AstTree>(tree->file);
+    for (auto const &member : scan.group) {
+        group->addGlobalStatement(member->func);
+    }
+    
+    CFlags flags;
+    flags.name = func->name;
+    flags.opt_level = 2;
+    
+    Compiler compiler(group, flags);
+    if (!compiler.compile()) return nullptr;
+    compiler.compileJitEntry(func);
+    
+    return (IntrNative)jit->compile(&compiler, func->name + ".entry");
+}
+
+//
+// Hands a hot function to the JIT
+// This only happens once per function.
+//
+void AstInterpreter::tier_up(IntrFunction &function) {
+    function.tiered = true;
+    
+    if (!tier) tier = std::make_unique<IntrTier>(tree);
+    function.native = tier->compile(function.func);
+    if (tier->failed) jit_threshold = -1;
+}
+
+//
+// Calls the native version of a function
+//
+IntrValue AstInterpreter::run_native(IntrFunction &function, std::vector<IntrValue> &args) {
+    native_args.resize(args.size());
+    for (size_t i = 0; i<args.size(); i++) {
+        if (args[i].kind == IntrKind::Float) {
+            memcpy(&native_args[i], &args[i].fvalue, sizeof(double));
+        } else {
+            native_args[i] = args[i].ivalue;
+        }
+    }
+    
+    uint64_t result = 0;
+    function.native(native_args.data(), &result);
+    
+    AstDataType *data_type = function.func->data_type;
+    if (is_float_type(data_type)) {
+        double value;
+        memcpy(&value, &result, sizeof(double));
+        return fit_float(data_type, value);
+    }
+    
+    return result;
+}
+
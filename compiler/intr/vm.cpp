@@ -0,0 +1,441 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#include <iostream>
+
+#include "bytecode.hpp"
+
+// GCC and Clang can jump straight from one instruction to the next
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(BC_NO_COMPUTED_GOTO)
+#define BC_COMPUTED_GOTO
+#endif
+
+static const int I = (int)BcKind::Int;
+static const int S = (int)BcKind::String;
+static const int A = (int)BcKind::IntArray;
+static const int SA = (int)BcKind::StringArray;
+
+BcVM::BcVM(std::shared_ptr<BcProgram> program) {
+    this->program = program;
+    frames.reserve(256);
+    tiers.resize(program->functions.size());
+}
+
+//
+// Pushes a new frame, growing the register stacks if needed
+//
+void BcVM::enter(const BcFunction *func, size_t base[5], uint16_t dest) {
+    if (int_stack.size() < base[I] + func->regs[I]) int_stack.resize((base[I] + func->regs[I]) * 2);
+    if (string_stack.size() < base[S] + func->regs[S]) string_stack.resize((base[S] + func->regs[S]) * 2);
+    if (array_stack.size() < base[A] + func->regs[A]) array_stack.resize((base[A] + func->regs[A]) * 2);
+    if (sarray_stack.size() < base[SA] + func->regs[SA]) sarray_stack.resize((base[SA] + func->regs[SA]) * 2);
+    
+    Frame frame;
+    frame.func = func;
+    frame.ip = func->code.data();
+    for (int i = 0; i<5; i++) frame.base[i] = base[i];
+    frame.dest = dest;
+    frames.push_back(frame);
+}
+
+//
+// Pops the current frame
+// Array handles are released here, so storage the function allocated is freed
+// once nothing else refers to it.
+//
+void BcVM::leave() {
+    Frame &frame = frames.back();
+    for (int i = 0; i<frame.func->regs[S]; i++) string_stack[frame.base[S] + i].clear();
+    for (int i = 0; i<frame.func->regs[A]; i++) array_stack[frame.base[A] + i].reset();
+    for (int i = 0; i<frame.func->regs[SA]; i++) sarray_stack[frame.base[SA] + i].reset();
+    frames.pop_back();
+}
+
+//
+// Hands a hot function to the JIT
+// Functions that take it only use numbers, so their arguments and result
+// always live in the int bank.
+//
+void BcVM::tier_up(uint32_t index) {
+    tiers[index].tiered = true;
+    
+    if (!tier) tier = std::make_unique<IntrTier>(program->tree);
+    tiers[index].native = tier->compile(program->functions[index].source);
+    if (tier->failed) jit_threshold = -1;
+}
+
+//
+// Runs the program from the main function, and returns its result
+//
+int BcVM::run() {
+    if (program->main_func < 0) {
+        std::cout << "[FATAL] Unable to find main function." << std::endl;
+        return 1;
+    }
+    
+    size_t base[5] = {0};
+    enter(&program->functions[program->main_func], base, 0);
+    
+    const BcFunction *func = frames.back().func;
+    const BcInstr *ip = func->code.data();
+    const BcInstr *in = nullptr;
+    const int64_t *int_consts = program->int_consts.data();
+    const std::string *string_consts = program->string_consts.data();
+    std::string message = "";
+    int64_t result = 0;
+    
+    // The registers of the current frame
+    int64_t *R = nullptr;
+    std::string *RS = nullptr;
+    BcIntArrayRef *RA = nullptr;
+    BcStringArrayRef *RSA = nullptr;
+    
+    // The stacks may move whenever a frame is pushed, so these are reloaded
+    // after every call and return.
+    #define VM_LOAD() do { \
+        Frame &frame = frames.back(); \
+        R = int_stack.data() + frame.base[I]; \
+        RS = string_stack.data() + frame.base[S]; \
+        RA = array_stack.data() + frame.base[A]; \
+        RSA = sarray_stack.data() + frame.base[SA]; \
+    } while (0)
+    
+    #define VM_RETURN() do { \
+        func = frames.back().func; \
+        ip = frames.back().ip; \
+        VM_LOAD(); \
+    } while (0)
+    
+    #define VM_CHECK_INDEX(index, size) \
+        if ((uint64_t)(index) >= (uint64_t)(size)) { \
+            message = "Index " + std::to_string(index) + " is out of bounds."; \
+            goto fail; \
+        }
+
+#ifdef BC_COMPUTED_GOTO
+    #define BC_LABEL(name) &&op_##name,
+    static const void *dispatch_table[] = { BC_OPCODES(BC_LABEL) };
+    #undef BC_LABEL
+    
+    #define VM_DISPATCH() do { in = ip++; goto *dispatch_table[(int)in->op]; } while (0)
+    #define VM_OP(name) op_##name:
+#else
+    #define VM_DISPATCH() goto dispatch
+    #define VM_OP(name) case BcOp::name:
+#endif
+    
+    VM_LOAD();
+
+#ifdef BC_COMPUTED_GOTO
+    VM_DISPATCH();
+#else
+dispatch:
+    in = ip++;
+    switch (in->op) {
+#endif
+    
+    //
+    // Integers
+    //
+    VM_OP(LoadI) { R[in->a] = (int32_t)in->b; VM_DISPATCH(); }
+    VM_OP(LoadK) { R[in->a] = int_consts[in->b]; VM_DISPATCH(); }
+    VM_OP(Move) { R[in->a] = R[in->b]; VM_DISPATCH(); }
+    
+    // Wrapping arithmetic is done unsigned
+    VM_OP(Add) { R[in->a] = (int64_t)((uint64_t)R[in->b] + (uint64_t)R[in->c]); VM_DISPATCH(); }
+    VM_OP(AddI) { R[in->a] = (int64_t)((uint64_t)R[in->b] + (uint64_t)(int64_t)(int32_t)in->c); VM_DISPATCH(); }
+    VM_OP(Sub) { R[in->a] = (int64_t)((uint64_t)R[in->b] - (uint64_t)R[in->c]); VM_DISPATCH(); }
+    VM_OP(Mul) { R[in->a] = (int64_t)((uint64_t)R[in->b] * (uint64_t)R[in->c]); VM_DISPATCH(); }
+    
+    VM_OP(Div) {
+        int64_t rval = R[in->c];
+        if (rval == 0) {
+            message = "Division by zero.";
+            goto fail;
+        }
+        R[in->a] = rval == -1 ? (int64_t)(0 - (uint64_t)R[in->b]) : R[in->b] / rval;
+        VM_DISPATCH();
+    }
+    
+    VM_OP(Mod) {
+        int64_t rval = R[in->c];
+        if (rval == 0) {
+            message = "Division by zero.";
+            goto fail;
+        }
+        R[in->a] = rval == -1 ? 0 : R[in->b] % rval;
+        VM_DISPATCH();
+    }
+    
+    VM_OP(And) { R[in->a] = R[in->b] & R[in->c]; VM_DISPATCH(); }
+    VM_OP(Or) { R[in->a] = R[in->b] | R[in->c]; VM_DISPATCH(); }
+    VM_OP(Xor) { R[in->a] = R[in->b] ^ R[in->c]; VM_DISPATCH(); }
+    VM_OP(Lsh) { R[in->a] = (int64_t)((uint64_t)R[in->b] << (R[in->c] & 63)); VM_DISPATCH(); }
+    VM_OP(Rsh) { R[in->a] = R[in->b] >> (R[in->c] & 63); VM_DISPATCH(); }
+    VM_OP(Neg) { R[in->a] = (int64_t)(0 - (uint64_t)R[in->b]); VM_DISPATCH(); }
+    
+    VM_OP(Eq) { R[in->a] = R[in->b] == R[in->c]; VM_DISPATCH(); }
+    VM_OP(Ne) { R[in->a] = R[in->b] != R[in->c]; VM_DISPATCH(); }
+    VM_OP(Gt) { R[in->a] = R[in->b] > R[in->c]; VM_DISPATCH(); }
+    VM_OP(Lt) { R[in->a] = R[in->b] < R[in->c]; VM_DISPATCH(); }
+    VM_OP(Ge) { R[in->a] = R[in->b] >= R[in->c]; VM_DISPATCH(); }
+    VM_OP(Le) { R[in->a] = R[in->b] <= R[in->c]; VM_DISPATCH(); }
+    
+    //
+    // Branches
+    //
+    VM_OP(Jmp) { ip = func->code.data() + in->b; VM_DISPATCH(); }
+    VM_OP(Jz) { if (R[in->a] == 0) ip = func->code.data() + in->b; VM_DISPATCH(); }
+    VM_OP(Jnz) { if (R[in->a] != 0) ip = func->code.data() + in->b; VM_DISPATCH(); }
+    VM_OP(JEq) { if (R[in->a] == R[in->b]) ip = func->code.data() + in->c; VM_DISPATCH(); }
+    VM_OP(JNe) { if (R[in->a] != R[in->b]) ip = func->code.data() + in->c; VM_DISPATCH(); }
+    VM_OP(JGt) { if (R[in->a] > R[in->b]) ip = func->code.data() + in->c; VM_DISPATCH(); }
+    VM_OP(JLt) { if (R[in->a] < R[in->b]) ip = func->code.data() + in->c; VM_DISPATCH(); }
+    VM_OP(JGe) { if (R[in->a] >= R[in->b]) ip = func->code.data() + in->c; VM_DISPATCH(); }
+    VM_OP(JLe) { if (R[in->a] <= R[in->b]) ip = func->code.data() + in->c; VM_DISPATCH(); }
+    
+    //
+    // Strings
+    //
+    VM_OP(SLoadK) { RS[in->a] = string_consts[in->b]; VM_DISPATCH(); }
+    VM_OP(SMove) { RS[in->a] = RS[in->b]; VM_DISPATCH(); }
+    
+    VM_OP(SChar) {
+        int64_t index = R[in->c];
+        VM_CHECK_INDEX(index, RS[in->b].length());
+        RS[in->a] = std::string(1, RS[in->b][index]);
+        VM_DISPATCH();
+    }
+    
+    VM_OP(SCode) {
+        int64_t index = R[in->c];
+        VM_CHECK_INDEX(index, RS[in->b].length());
+        R[in->a] = RS[in->b][index];
+        VM_DISPATCH();
+    }
+    
+    VM_OP(SLen) { R[in->a] = RS[in->b].length(); VM_DISPATCH(); }
+    VM_OP(SCat) { RS[in->a] = RS[in->b] + RS[in->c]; VM_DISPATCH(); }
+    VM_OP(SEq) { R[in->a] = RS[in->b] == RS[in->c]; VM_DISPATCH(); }
+    
+    //
+    // Arrays
+    //
+    VM_OP(ANew) {
+        int64_t length = R[in->b];
+        RA[in->a] = std::make_shared<BcIntArray>(length > 0 ? length : 0, 0);
+        VM_DISPATCH();
+    }
+    
+    VM_OP(AMove) { RA[in->a] = RA[in->b]; VM_DISPATCH(); }
+    
+    VM_OP(AGet) {
+        int64_t index = R[in->c];
+        BcIntArray &array = *RA[in->b];
+        VM_CHECK_INDEX(index, array.size());
+        R[in->a] = array[index];
+        VM_DISPATCH();
+    }
+    
+    VM_OP(ASet) {
+        int64_t index = R[in->b];
+        BcIntArray &array = *RA[in->a];
+        VM_CHECK_INDEX(index, array.size());
+        array[index] = R[in->c];
+        VM_DISPATCH();
+    }
+    
+    VM_OP(ALen) { R[in->a] = RA[in->b]->size(); VM_DISPATCH(); }
+    
+    VM_OP(SANew) {
+        int64_t length = R[in->b];
+        RSA[in->a] = std::make_shared<BcStringArray>(length > 0 ? length : 0);
+        VM_DISPATCH();
+    }
+    
+    VM_OP(SAMove) { RSA[in->a] = RSA[in->b]; VM_DISPATCH(); }
+    
+    VM_OP(SAGet) {
+        int64_t index = R[in->c];
+        BcStringArray &array = *RSA[in->b];
+        VM_CHECK_INDEX(index, array.size());
+        RS[in->a] = array[index];
+        VM_DISPATCH();
+    }
+    
+    VM_OP(SASet) {
+        int64_t index = R[in->b];
+        BcStringArray &array = *RSA[in->a];
+        VM_CHECK_INDEX(index, array.size());
+        array[index] = RS[in->c];
+        VM_DISPATCH();
+    }
+    
+    VM_OP(SALen) { R[in->a] = RSA[in->b]->size(); VM_DISPATCH(); }
+    
+    //
+    // Calls
+    // The callee's frame starts right after the caller's registers. Arguments
+    // are copied over once the frame exists, since pushing it can move the stacks.
+    //
+    VM_OP(Call) {
+        const BcCall &call = func->calls[in->b];
+        const BcFunction *callee = &program->functions[call.func];
+        
+        Tier &state = tiers[call.func];
+        if (!state.tiered && jit_threshold >= 0 && state.heat >= (uint64_t)jit_threshold) {
+            tier_up(call.func);
+        }
+            
+        if (state.native) {
+            native_args.resize(call.args.size());
+            for (size_t i = 0; i<call.args.size(); i++) native_args[i] = R[call.args[i].reg];
+                
+            uint64_t value = 0;
+            state.native(native_args.data(), &value);
+            if (callee->return_kind == BcKind::Int) R[in->a] = (int64_t)value;
+            VM_DISPATCH();
+        }
+            
+        state.heat++;
+            
+        size_t caller[5];
+        size_t callee_base[5];
+        frames.back().ip = ip;
+        for (int i = 0; i<5; i++) {
+            caller[i] = frames.back().base[i];
+            callee_base[i] = caller[i] + func->regs[i];
+        }
+        
+        enter(callee, callee_base, in->a);
+        
+        for (size_t i = 0; i<call.args.size(); i++) {
+            const BcOperand &arg = call.args[i];
+            uint16_t param = callee->params[i].reg;
+            
+            switch (arg.kind) {
+                case BcKind::Int: int_stack[callee_base[I] + param] = int_stack[caller[I] + arg.reg]; break;
+                case BcKind::String: string_stack[callee_base[S] + param] = string_stack[caller[S] + arg.reg]; break;
+                case BcKind::IntArray: array_stack[callee_base[A] + param] = array_stack[caller[A] + arg.reg]; break;
+                case BcKind::StringArray: sarray_stack[callee_base[SA] + param] = sarray_stack[caller[SA] + arg.reg]; break;
+                default: {}
+            }
+        }
+        
+        func = callee;
+        ip = callee->code.data();
+        VM_LOAD();
+        VM_DISPATCH();
+    }
+    
+    VM_OP(Ret) {
+        int64_t value = R[in->a];
+        uint16_t dest = frames.back().dest;
+        leave();
+        if (frames.empty()) {
+            result = value;
+            goto done;
+        }
+        
+        VM_RETURN();
+        R[dest] = value;
+        VM_DISPATCH();
+    }
+    
+    VM_OP(SRet) {
+        std::string value = std::move(RS[in->a]);
+        uint16_t dest = frames.back().dest;
+        leave();
+        if (frames.empty()) goto done;
+        
+        VM_RETURN();
+        RS[dest] = std::move(value);
+        VM_DISPATCH();
+    }
+    
+    VM_OP(ARet) {
+        BcIntArrayRef value = std::move(RA[in->a]);
+        uint16_t dest = frames.back().dest;
+        leave();
+        if (frames.empty()) goto done;
+        
+        VM_RETURN();
+        RA[dest] = std::move(value);
+        VM_DISPATCH();
+    }
+    
+    VM_OP(SARet) {
+        BcStringArrayRef value = std::move(RSA[in->a]);
+        uint16_t dest = frames.back().dest;
+        leave();
+        if (frames.empty()) goto done;
+        
+        VM_RETURN();
+        RSA[dest] = std::move(value);
+        VM_DISPATCH();
+    }
+    
+    VM_OP(RetV) {
+        BcKind kind = func->return_kind;
+        uint16_t dest = frames.back().dest;
+        leave();
+        if (frames.empty()) goto done;
+        
+        VM_RETURN();
+        switch (kind) {
+            case BcKind::Int: R[dest] = 0; break;
+            case BcKind::String: RS[dest].clear(); break;
+            case BcKind::IntArray: RA[dest] = std::make_shared<BcIntArray>(); break;
+            case BcKind::StringArray: RSA[dest] = std::make_shared<BcStringArray>(); break;
+            default: {}
+        }
+        VM_DISPATCH();
+    }
+    
+    //
+    // The builtin print function
+    //
+    VM_OP(PrintI) { std::cout << R[in->a]; VM_DISPATCH(); }
+    VM_OP(PrintS) { std::cout << RS[in->a]; VM_DISPATCH(); }
+    
+    VM_OP(PrintA) {
+        const BcIntArray &array = *RA[in->a];
+        std::cout << "[";
+        for (size_t i = 0; i<array.size(); i++) {
+            std::cout << array[i];
+            if (i+1 < array.size()) std::cout << ", ";
+        }
+        std::cout << "]";
+        VM_DISPATCH();
+    }
+    
+    VM_OP(PrintSA) {
+        const BcStringArray &array = *RSA[in->a];
+        std::cout << "[";
+        for (size_t i = 0; i<array.size(); i++) {
+            std::cout << "\"" << array[i] << "\"";
+            if (i+1 < array.size()) std::cout << ", ";
+        }
+        std::cout << "]";
+        VM_DISPATCH();
+    }
+    
+    VM_OP(PrintLn) { std::cout << "\n"; VM_DISPATCH(); }
+
+#ifndef BC_COMPUTED_GOTO
+    }
+#endif
+
+fail:
+    std::cout.flush();
+    std::cerr << "[FATAL] " << message << std::endl;
+    while (!frames.empty()) leave();
+    return 1;
+
+done:
+    std::cout.flush();
+    return (int)result;
+}
+
@@ -24,11 +24,11 @@ void Compiler::Build(std::shared_ptr<AstTree> tree) {
     
     // Check for constructors
     bool found_const = false;
-    std::shared_ptr<AstBlock> const_block;
+    AstBlock *const_block = nullptr;
     
     for (auto GS : tree->block->block) {
         if (GS->type != V_AstType::Func) continue;
-        auto funcAst = std::static_pointer_cast<AstFunction>(GS);
+        auto funcAst = static_cast<AstFunction *>(GS);
         if (funcAst->name == className) {
             found_const = true;
             const_block = funcAst->block;
@@ -52,7 +52,7 @@ void Compiler::Build(std::shared_ptr<AstTree> tree) {
     // Build the functions (declarations only)
     for (auto GS : tree->block->block) {
         if (GS->type == V_AstType::Func) {
-            auto funcAst = std::static_pointer_cast<AstFunction>(GS);
+            auto funcAst = static_cast<AstFunction *>(GS);
             if (funcAst->name == className) continue;
             BuildFunction(GS);
         }
@@ -61,7 +61,7 @@ void Compiler::Build(std::shared_ptr<AstTree> tree) {
     // Now the code
     for (auto GS : tree->block->block) {
         if (GS->type == V_AstType::Func) {
-            auto funcAst = std::static_pointer_cast<AstFunction>(GS);
+            auto funcAst = static_cast<AstFunction *>(GS);
             std::shared_ptr<JavaFunction> func = funcMap[funcAst->name];
             if (funcAst->name == className) {
                 continue;
@@ -83,8 +83,8 @@ void Compiler::Write() {
 }
 
 // Builds a function
-void Compiler::BuildFunction(std::shared_ptr<AstStatement> GS) {
-    auto func = std::static_pointer_cast<AstFunction>(GS);
+void Compiler::BuildFunction(AstStatement *GS) {
+    auto func = static_cast<AstFunction *>(GS);
     
     int flags = 0;
     if (func->routine) flags |= F_STATIC;
@@ -103,7 +103,7 @@ void Compiler::BuildFunction(std::shared_ptr<AstStatement> GS) {
 }
 
 // Builds a statement
-void Compiler::BuildStatement(std::shared_ptr<AstStatement> stmt, std::shared_ptr<JavaFunction> function) {
+void Compiler::BuildStatement(AstStatement *stmt, std::shared_ptr<JavaFunction> function) {
     switch (stmt->type) {
         case V_AstType::VarDec: BuildVarDec(stmt, function); break;
         case V_AstType::ExprStmt: BuildVarAssign(stmt, function); break;
@@ -123,8 +123,8 @@ void Compiler::BuildStatement(std::shared_ptr<AstStatement> stmt, std::shared_pt
 }
 
 // Builds a variable declaration
-void Compiler::BuildVarDec(std::shared_ptr<AstStatement> stmt, std::shared_ptr<JavaFunction> function) {
-    auto vd = std::static_pointer_cast<AstVarDec>(stmt);
+void Compiler::BuildVarDec(AstStatement *stmt, std::shared_ptr<JavaFunction> function) {
+    auto vd = static_cast<AstVarDec *>(stmt);
     
     switch (vd->data_type->type) {
         case V_AstType::Int32: {
@@ -149,8 +149,8 @@ void Compiler::BuildVarDec(std::shared_ptr<AstStatement> stmt, std::shared_ptr<J
 }
 
 // Builds a variable assignment
-void Compiler::BuildVarAssign(std::shared_ptr<AstStatement> stmt, std::shared_ptr<JavaFunction> function) {
-    auto va = std::static_pointer_cast<AstExprStatement>(stmt);
+void Compiler::BuildVarAssign(AstStatement *stmt, std::shared_ptr<JavaFunction> function) {
+    auto va = static_cast<AstExprStatement *>(stmt);
     BuildExpr(va->expression, function, va->dataType);
     
     // TODO: Eventually get rid of this when we migrate from Espresso
@@ -168,8 +168,8 @@ void Compiler::BuildVarAssign(std::shared_ptr<AstStatement> stmt, std::shared_pt
 }
 
 // Builds a function call statement
-void Compiler::BuildFuncCallStatement(std::shared_ptr<AstStatement> stmt, std::shared_ptr<JavaFunction> function) {
-    auto fc = std::static_pointer_cast<AstFuncCallStmt>(stmt);
+void Compiler::BuildFuncCallStatement(AstStatement *stmt, std::shared_ptr<JavaFunction> function) {
+    auto fc = static_cast<AstFuncCallStmt *>(stmt);
     
     if (fc->name == "println" || fc->name == "print") {
         builder->CreateGetStatic(function, "out");
@@ -189,7 +189,7 @@ void Compiler::BuildFuncCallStatement(std::shared_ptr<AstStatement> stmt, std::s
         builder->CreateALoad(function, pos);
     }
     
-    /*auto list = std::static_pointer_cast<AstExprList>(fc->expression);
+    /*auto list = static_cast<AstExprList *>(fc->expression);
     for (auto const &expr : list->list) {
         signature = GetTypeForExpr(expr);
         BuildExpr(expr, function);
@@ -204,29 +204,29 @@ void Compiler::BuildFuncCallStatement(std::shared_ptr<AstStatement> stmt, std::s
 }
 
 // Builds an expression
-void Compiler::BuildExpr(std::shared_ptr<AstExpression> expr, std::shared_ptr<JavaFunction> function, std::shared_ptr<AstDataType> dataType) {
+void Compiler::BuildExpr(AstExpression *expr, std::shared_ptr<JavaFunction> function, AstDataType *dataType) {
     if (expr == nullptr) return;
 
     switch (expr->type) {
         case V_AstType::ExprList: {
-            auto list = std::static_pointer_cast<AstExprList>(expr);
+            auto list = static_cast<AstExprList *>(expr);
             for (auto const &item : list->list) {
                 BuildExpr(item, function, dataType);
             }
         } break;
     
         case V_AstType::IntL: {
-            auto i = std::static_pointer_cast<AstInt>(expr);
+            auto i = static_cast<AstInt *>(expr);
             builder->CreateBIPush(function, i->value);
         } break;
     
         case V_AstType::StringL: {
-            std::shared_ptr<AstString> str = std::static_pointer_cast<AstString>(expr);
+            AstString *str = static_cast<AstString *>(expr);
             builder->CreateString(function, str->value);
         } break;
         
         case V_AstType::ID: {
-            std::shared_ptr<AstID> id = std::static_pointer_cast<AstID>(expr);
+            AstID *id = static_cast<AstID *>(expr);
             int pos = intMap[id->value];
             builder->CreateILoad(function, pos);
             /*switch (dataType->type) {
@@ -245,10 +245,10 @@ void Compiler::BuildExpr(std::shared_ptr<AstExpression> expr, std::shared_ptr<Ja
         } break;
         
         case V_AstType::Assign: {
-            auto op = std::static_pointer_cast<AstBinaryOp>(expr);
+            auto op = static_cast<AstBinaryOp *>(expr);
             BuildExpr(op->rval, function, dataType);
             
-            auto id = std::static_pointer_cast<AstID>(op->lval);
+            auto id = static_cast<AstID *>(op->lval);
             switch (dataType->type) {
                 case V_AstType::Int32: {
                     int iPos = intMap[id->value];
@@ -270,7 +270,7 @@ void Compiler::BuildExpr(std::shared_ptr<AstExpression> expr, std::shared_ptr<Ja
         case V_AstType::Lsh:
         case V_AstType::Rsh:
         {
-            std::shared_ptr<AstBinaryOp> op = std::static_pointer_cast<AstBinaryOp>(expr);
+            AstBinaryOp *op = static_cast<AstBinaryOp *>(expr);
             BuildExpr(op->lval, function, dataType);
             BuildExpr(op->rval, function, dataType);
             
@@ -304,7 +304,7 @@ void Compiler::BuildExpr(std::shared_ptr<AstExpression> expr, std::shared_ptr<Ja
 }
 
 // Returns a type value for an expression
-std::string Compiler::GetTypeForExpr(std::shared_ptr<AstExpression> expr) {
+std::string Compiler::GetTypeForExpr(AstExpression *expr) {
     if (expr == nullptr) return "";
 
     switch (expr->type) {
@@ -312,7 +312,7 @@ std::string Compiler::GetTypeForExpr(std::shared_ptr<AstExpression> expr) {
         case V_AstType::StringL: return "Ljava/lang/String;";
         
         case V_AstType::ID: {
-            std::shared_ptr<AstID> id = std::static_pointer_cast<AstID>(expr);
+            AstID *id = static_cast<AstID *>(expr);
             
             if (intMap.find(id->value) != intMap.end()) {
                 return "I";
@@ -320,7 +320,7 @@ std::string Compiler::GetTypeForExpr(std::shared_ptr<AstExpression> expr) {
         } break;
         
         case V_AstType::ExprList: {
-            auto list = std::static_pointer_cast<AstExprList>(expr);
+            auto list = static_cast<AstExprList *>(expr);
             return GetTypeForExpr(list->list[0]);
         };
         
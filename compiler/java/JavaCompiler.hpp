@@ -21,15 +21,15 @@ public:
     void Build(std::shared_ptr<AstTree> tree);
     void Write();
 protected:
-    void BuildFunction(std::shared_ptr<AstStatement> GS);
-    void BuildStatement(std::shared_ptr<AstStatement> stmt, std::shared_ptr<JavaFunction> function);
+    void BuildFunction(AstStatement *GS);
+    void BuildStatement(AstStatement *stmt, std::shared_ptr<JavaFunction> function);
     
-    void BuildVarDec(std::shared_ptr<AstStatement> stmt, std::shared_ptr<JavaFunction> function);
-    void BuildVarAssign(std::shared_ptr<AstStatement> stmt, std::shared_ptr<JavaFunction> function);
-    void BuildFuncCallStatement(std::shared_ptr<AstStatement> stmt, std::shared_ptr<JavaFunction> function);
-    void BuildExpr(std::shared_ptr<AstExpression> expr, std::shared_ptr<JavaFunction> function, std::shared_ptr<AstDataType> dataType = nullptr);
+    void BuildVarDec(AstStatement *stmt, std::shared_ptr<JavaFunction> function);
+    void BuildVarAssign(AstStatement *stmt, std::shared_ptr<JavaFunction> function);
+    void BuildFuncCallStatement(AstStatement *stmt, std::shared_ptr<JavaFunction> function);
+    void BuildExpr(AstExpression *expr, std::shared_ptr<JavaFunction> function, AstDataType *dataType = nullptr);
     
-    std::string GetTypeForExpr(std::shared_ptr<AstExpression> expr);
+    std::string GetTypeForExpr(AstExpression *expr);
 private:
     std::string className;
     std::shared_ptr<JavaClassBuilder> builder;
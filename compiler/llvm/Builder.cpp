@@ -5,37 +5,74 @@
 //
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Host.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/Program.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/MC/TargetRegistry.h"
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetOptions.h"
 #include "llvm/IR/LegacyPassManager.h"
+#include "llvm/IR/Verifier.h"
+#include "llvm/Passes/PassBuilder.h"
+#include "llvm/Analysis/TargetLibraryInfo.h"
+#include "llvm/CodeGen/ParallelCG.h"
+
+#include <cstdlib>
+#include <mutex>
 
 using namespace llvm;
 using namespace llvm::sys;
 
 #include "Compiler.hpp"
+#include "TimeReport.hpp"
 
-void Compiler::writeAssembly() {
-    std::string triple = "";
+static std::once_flag targetFlag;
 
-    LLVMInitializeX86TargetInfo();
-    LLVMInitializeX86Target();
-    LLVMInitializeX86TargetMC();
-    LLVMInitializeX86AsmParser();
-    LLVMInitializeX86AsmPrinter();
+//
+// Sets up the target machine for the host, and prepares the module for it
+// The IR optimizer is run here as well, so it only happens once per module
+// no matter how many files we write out.
+//
+TargetMachine *Compiler::getTargetMachine() {
+    if (machine) return machine.get();
+    
+    // The target registry is shared by every compiler in the process
+    std::call_once(targetFlag, []() {
+        LLVMInitializeX86TargetInfo();
+        LLVMInitializeX86Target();
+        LLVMInitializeX86TargetMC();
+        LLVMInitializeX86AsmParser();
+        LLVMInitializeX86AsmPrinter();
+    });
+    
+    mod->setTargetTriple(sys::getDefaultTargetTriple());
+    
+    machine = createTargetMachine();
+    if (!machine) return nullptr;
+    
+    mod->setDataLayout(machine->createDataLayout());
     
-    triple = sys::getDefaultTargetTriple();
-    mod->setTargetTriple(triple);
+    // Run the IR optimizer before handing off to the code generator
+    TimePhase phase("optimize", cflags.name);
+    optimize(machine.get());
     
+    return machine.get();
+}
+
+//
+// Creates a new target machine for the module's target
+// Parallel code generation needs a separate one for each thread.
+//
+std::unique_ptr<TargetMachine> Compiler::createTargetMachine() {
+    std::string triple = mod->getTargetTriple();
     std::string error;
     auto target = TargetRegistry::lookupTarget(triple, error);
     
     // Check for any errors with the target triple
     if (!target) {
         errs() << error;
-        return;
+        return nullptr;
     }
     
     // CPU and features
@@ -44,29 +81,184 @@ void Compiler::writeAssembly() {
     
     TargetOptions options;
     auto RM = Optional<Reloc::Model>();
-    auto machine = target->createTargetMachine(triple, CPU, features, options, RM);
-    mod->setDataLayout(machine->createDataLayout());
     
-    // Write it out
-    std::string outputPath = "/tmp/" + cflags.name + ".asm";
+    CodeGenOpt::Level codeGenLevel = CodeGenOpt::None;
+    switch (cflags.opt_level) {
+        case 0: codeGenLevel = CodeGenOpt::None; break;
+        case 1: codeGenLevel = CodeGenOpt::Less; break;
+        case 2: codeGenLevel = CodeGenOpt::Default; break;
+        default: codeGenLevel = CodeGenOpt::Aggressive;
+    }
+    
+    TargetMachine *targetMachine = target->createTargetMachine(triple, CPU, features, options, RM, None, codeGenLevel);
+    return std::unique_ptr<TargetMachine>(targetMachine);
+}
+
+//
+// Runs the code generator, and writes the result to the given path
+//
+bool Compiler::emitFile(std::string path, CodeGenFileType fileType) {
+    TargetMachine *targetMachine = getTargetMachine();
+    if (!targetMachine) return false;
     
     std::error_code errorCode;
-    raw_fd_ostream writer(outputPath, errorCode, sys::fs::OF_None);
+    raw_fd_ostream writer(path, errorCode, sys::fs::OF_None);
     
     if (errorCode) {
-        errs() << "Unable to open file: " << errorCode.message();
-        return;
+        errs() << "Unable to open file: " << errorCode.message() << "\n";
+        return false;
     }
     
     legacy::PassManager pass;
-    auto outputType = CGFT_AssemblyFile;
     
-    if (machine->addPassesToEmitFile(pass, writer, nullptr, outputType)) {
-        errs() << "Unable to write to file.";
-        return;
+    if (targetMachine->addPassesToEmitFile(pass, writer, nullptr, fileType)) {
+        errs() << "Unable to write to file.\n";
+        return false;
     }
     
+    TimePhase phase("codegen", cflags.name);
     pass.run(*mod);
     writer.flush();
+    return true;
+}
+
+//
+// Writes the module out as a textual assembly file
+//
+bool Compiler::writeAssembly(std::string path) {
+    return emitFile(path, CGFT_AssemblyFile);
+}
+
+//
+// Writes the module out as an object file, straight from the code generator
+//
+bool Compiler::writeObject(std::string path) {
+    if (cflags.codegen_threads > 1) return emitSplitObject(path);
+    return emitFile(path, CGFT_ObjectFile);
+}
+
+//
+// Splits the module into partitions, and runs the code generator on each of
+// them in parallel. The partial objects are merged back into one with "ld -r".
+// Local symbols are preserved, so they stay in the same partition as their users.
+//
+bool Compiler::emitSplitObject(std::string path) {
+    if (!getTargetMachine()) return false;
+    
+    // The partitions are handed to the threads as bitcode, which is only
+    // readable if the module is valid. Otherwise, fall back to one thread.
+    if (verifyModule(*mod)) return emitFile(path, CGFT_ObjectFile);
+    
+    std::vector<std::string> parts;
+    std::vector<std::unique_ptr<raw_fd_ostream>> streams;
+    std::vector<raw_pwrite_stream *> outputs;
+    bool failed = false;
+    
+    for (int i = 0; i<cflags.codegen_threads; i++) {
+        SmallString<128> part;
+        std::error_code errorCode = sys::fs::createTemporaryFile("codegen-part" + std::to_string(i), "o", part);
+        if (errorCode) {
+            errs() << "Unable to create temporary file: " << errorCode.message() << "\n";
+            failed = true;
+            break;
+        }
+        
+        parts.push_back(part.str().str());
+        streams.push_back(std::make_unique<raw_fd_ostream>(part, errorCode, sys::fs::OF_None));
+        outputs.push_back(streams.back().get());
+        
+        if (errorCode) {
+            errs() << "Unable to open file: " << errorCode.message() << "\n";
+            failed = true;
+            break;
+        }
+    }
+    
+    if (!failed) {
+        TimePhase phase("codegen", cflags.name);
+        auto factory = [this]() { return createTargetMachine(); };
+        splitCodeGen(*mod, outputs, {}, factory, CGFT_ObjectFile, true);
+    }
+    
+    // Close everything before the linker reads it back in
+    streams.clear();
+    
+    // The linker is run directly, so nothing in the paths needs quoting
+    if (!failed) {
+        TimePhase phase("merge objects", cflags.name);
+        
+        auto ld = sys::findProgramByName("ld");
+        std::vector<StringRef> args = { "ld", "-r", "-o", path };
+        for (auto const &part : parts) args.push_back(part);
+        
+        if (!ld || sys::ExecuteAndWait(*ld, args) != 0) {
+            errs() << "Unable to merge object files.\n";
+            failed = true;
+        }
+    }
+    
+    for (auto const &part : parts) sys::fs::remove(part);
+    return !failed;
 }
 
+//
+// Writes the module to a uniquely-named temporary object file, and returns its path
+// Parallel builds of the same program name never collide on the same file.
+//
+std::string Compiler::writeTempObject() {
+    SmallString<128> path;
+    std::string prefix = sys::path::filename(cflags.name).str();
+    
+    std::error_code errorCode = sys::fs::createTemporaryFile(prefix, "o", path);
+    if (errorCode) {
+        errs() << "Unable to create temporary file: " << errorCode.message() << "\n";
+        return "";
+    }
+    
+    if (!writeObject(path.str().str())) {
+        sys::fs::remove(path);
+        return "";
+    }
+    
+    return path.str().str();
+}
+
+//
+// Runs the new pass manager pipeline for the requested optimization level
+// At -O0, nothing is done so the output stays a direct translation of the AST.
+//
+void Compiler::optimize(TargetMachine *machine) {
+    if (cflags.opt_level <= 0) return;
+    
+    OptimizationLevel level = OptimizationLevel::O1;
+    if (cflags.opt_level == 2) level = OptimizationLevel::O2;
+    else if (cflags.opt_level >= 3) level = OptimizationLevel::O3;
+    
+    LoopAnalysisManager LAM;
+    FunctionAnalysisManager FAM;
+    CGSCCAnalysisManager CGAM;
+    ModuleAnalysisManager MAM;
+    
+    PipelineTuningOptions tuning;
+    tuning.LoopVectorization = cflags.opt_level >= 2;
+    tuning.SLPVectorization = cflags.opt_level >= 2;
+    
+    PassBuilder PB(machine, tuning);
+    
+    // Riya programs are linked without a C library, so the optimizer can't
+    // turn loops into calls to memset and memcpy
+    if (cflags.freestanding) {
+        TargetLibraryInfoImpl libraryInfo(Triple(mod->getTargetTriple()));
+        libraryInfo.disableAllFunctions();
+        FAM.registerPass([&] { return TargetLibraryAnalysis(libraryInfo); });
+    }
+    
+    PB.registerModuleAnalyses(MAM);
+    PB.registerCGSCCAnalyses(CGAM);
+    PB.registerFunctionAnalyses(FAM);
+    PB.registerLoopAnalyses(LAM);
+    PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+    
+    ModulePassManager MPM = PB.buildPerModuleDefaultPipeline(level);
+    MPM.run(*mod, MAM);
+}
@@ -12,13 +12,21 @@ using namespace llvm::sys;
 
 #include <iostream>
 #include <exception>
+#include <mutex>
 
 #include "Compiler.hpp"
 #include <llvm-c/Support.h>
 
+//
+// LLVM's command line options are process-wide, so they are only parsed once
+// even when several compilers are running on different threads.
+static std::once_flag optionsFlag;
+
 Compiler::Compiler(std::shared_ptr<AstTree> tree, CFlags cflags) {
-    char const *args[] = { "", "--x86-asm-syntax=intel" };
-    LLVMParseCommandLineOptions(2, args, NULL);
+    std::call_once(optionsFlag, []() {
+        char const *args[] = { "", "--x86-asm-syntax=intel" };
+        LLVMParseCommandLineOptions(2, args, NULL);
+    });
     
     this->tree = tree;
     this->cflags = cflags;
@@ -28,7 +36,10 @@ Compiler::Compiler(std::shared_ptr<AstTree> tree, CFlags cflags) {
     builder = std::make_unique<IRBuilder<>>(*context);
 }
 
-void Compiler::compile() {
+bool Compiler::compile() {
+    // Anything built for the tree along the way belongs to it
+    AstArena::Scope scope(tree->arena);
+    
     // Build the structures used by the program
     for (auto str : tree->structs) {
         std::vector<Type *> elementTypes;
@@ -62,6 +73,8 @@ void Compiler::compile() {
             default: {}
         }
     }
+    
+    return !failed;
 }
 
 void Compiler::debug() {
@@ -76,22 +89,22 @@ void Compiler::emitLLVM(std::string path) {
 }
 
 // Compiles an individual statement
-void Compiler::compileStatement(std::shared_ptr<AstStatement> stmt) {
+void Compiler::compileStatement(AstStatement *stmt) {
     switch (stmt->type) {
         // Expression statement
         case V_AstType::ExprStmt: {
-            std::shared_ptr<AstExprStatement> expr_stmt = std::static_pointer_cast<AstExprStatement>(stmt);
+            AstExprStatement *expr_stmt = static_cast<AstExprStatement *>(stmt);
             compileValue(expr_stmt->expression);
         } break;
     
         // A variable declaration (alloca) statement
         case V_AstType::VarDec: {
-            std::shared_ptr<AstVarDec> vd = std::static_pointer_cast<AstVarDec>(stmt);
+            AstVarDec *vd = static_cast<AstVarDec *>(stmt);
             Type *type = translateType(vd->data_type);
             
-            AllocaInst *var = builder->CreateAlloca(type);
-            symtable[vd->name] = var;
-            typeTable[vd->name] = vd->data_type;
+            AllocaInst *var = createEntryAlloca(type);
+            symtable[vd->id] = var;
+            typeTable[vd->id] = vd->data_type;
         } break;
         
         // A structure declaration
@@ -147,11 +160,11 @@ void Compiler::compileStatement(std::shared_ptr<AstStatement> stmt) {
 }
 
 // Converts an AST value to an LLVM value
-Value *Compiler::compileValue(std::shared_ptr<AstExpression> expr, V_AstType dataType, bool isAssign) {
+Value *Compiler::compileValue(AstExpression *expr, V_AstType dataType, bool isAssign) {
     if (expr == nullptr) return nullptr;
     switch (expr->type) {
         case V_AstType::IntL: {
-            auto i = std::static_pointer_cast<AstInt>(expr);
+            auto i = static_cast<AstInt *>(expr);
             if (i->size == 8) return builder->getInt8(i->value);
             else if (i->size == 16) return builder->getInt16(i->value);
             else if (i->size == 64) return builder->getInt64(i->value);
@@ -159,35 +172,35 @@ Value *Compiler::compileValue(std::shared_ptr<AstExpression> expr, V_AstType dat
         } break;
         
         case V_AstType::FloatL: {
-            std::shared_ptr<AstFloat> flt = std::static_pointer_cast<AstFloat>(expr);
+            AstFloat *flt = static_cast<AstFloat *>(expr);
             if (dataType == V_AstType::Float64)
                 return ConstantFP::get(Type::getDoubleTy(*context), flt->value);
             return ConstantFP::get(Type::getFloatTy(*context), flt->value);
         } break;
         
         case V_AstType::CharL: {
-            std::shared_ptr<AstChar> cval = std::static_pointer_cast<AstChar>(expr);
+            AstChar *cval = static_cast<AstChar *>(expr);
             return builder->getInt8(cval->value);
         } break;
         
         case V_AstType::StringL: {
-            std::shared_ptr<AstString> str = std::static_pointer_cast<AstString>(expr);
+            AstString *str = static_cast<AstString *>(expr);
             return builder->CreateGlobalStringPtr(str->value);
         } break;
         
         case V_AstType::ID: {
-            std::shared_ptr<AstID> id = std::static_pointer_cast<AstID>(expr);
-            AllocaInst *ptr = symtable[id->value];
-            Type *type = translateType(typeTable[id->value]);
+            AstID *id = static_cast<AstID *>(expr);
+            AllocaInst *ptr = symtable[id->id];
+            Type *type = translateType(typeTable[id->id]);
             
-            if (typeTable[id->value]->type == V_AstType::Struct || isAssign) return ptr;
+            if (typeTable[id->id]->type == V_AstType::Struct || isAssign) return ptr;
             return builder->CreateLoad(type, ptr);
         } break;
         
         case V_AstType::ArrayAccess: {
-            std::shared_ptr<AstArrayAccess> acc = std::static_pointer_cast<AstArrayAccess>(expr);
-            AllocaInst *ptr = symtable[acc->value];
-            std::shared_ptr<AstDataType> ptrType = typeTable[acc->value];
+            AstArrayAccess *acc = static_cast<AstArrayAccess *>(expr);
+            AllocaInst *ptr = symtable[acc->id];
+            AstDataType *ptrType = typeTable[acc->id];
             Value *index = compileValue(acc->index);
             
             if (ptrType->type == V_AstType::String) {
@@ -199,7 +212,7 @@ Value *Compiler::compileValue(std::shared_ptr<AstExpression> expr, V_AstType dat
                 if (isAssign) return ep;
                 else return builder->CreateLoad(i8Type, ep);
             } else {
-                std::shared_ptr<AstDataType> subType = std::static_pointer_cast<AstPointerType>(ptrType)->base_type;
+                AstDataType *subType = static_cast<AstPointerType *>(ptrType)->base_type;
                 Type *arrayPtrType = translateType(ptrType);
                 Type *arrayElementType = translateType(subType);
                 
@@ -213,10 +226,10 @@ Value *Compiler::compileValue(std::shared_ptr<AstExpression> expr, V_AstType dat
         case V_AstType::StructAccess: return compileStructAccess(expr, isAssign);
         
         case V_AstType::FuncCallExpr: {
-            std::shared_ptr<AstFuncCallExpr> fc = std::static_pointer_cast<AstFuncCallExpr>(expr);
+            AstFuncCallExpr *fc = static_cast<AstFuncCallExpr *>(expr);
             std::vector<Value *> args;
             
-            std::shared_ptr<AstExprList> list = std::static_pointer_cast<AstExprList>(fc->args);
+            AstExprList *list = static_cast<AstExprList *>(fc->args);
             for (auto arg : list->list) {
                 Value *val = compileValue(arg);
                 args.push_back(val);
@@ -224,11 +237,12 @@ Value *Compiler::compileValue(std::shared_ptr<AstExpression> expr, V_AstType dat
             
             Function *callee = mod->getFunction(fc->name);
             if (!callee) std::cerr << "Invalid function call statement: " << fc->name << std::endl;
+            convertArgs(callee, args, list);
             return builder->CreateCall(callee, args);
         } break;
         
         case V_AstType::FuncRef: {
-            auto ref = std::static_pointer_cast<AstFuncRef>(expr);
+            auto ref = static_cast<AstFuncRef *>(expr);
             
             Function *callee = mod->getFunction(ref->value);
             if (!callee) std::cerr << "Invalid function reference." << std::endl;
@@ -236,45 +250,52 @@ Value *Compiler::compileValue(std::shared_ptr<AstExpression> expr, V_AstType dat
         }
         
         case V_AstType::PtrTo: {
-            auto id = std::static_pointer_cast<AstPtrTo>(expr);
-            AllocaInst *ptr = symtable[id->value];
-            Type *type = translateType(typeTable[id->value]);
+            auto id = static_cast<AstPtrTo *>(expr);
+            AllocaInst *ptr = symtable[id->id];
+            Type *type = translateType(typeTable[id->id]);
             
             Value *ld1 = builder->CreateLoad(type, ptr);
             return builder->CreateLoad(Type::getInt32Ty(*context), ld1);
         }
         
         case V_AstType::Ref: {
-            auto ref = std::static_pointer_cast<AstRef>(expr);
-            AllocaInst *ptr2 = symtable[ref->value];
+            auto ref = static_cast<AstRef *>(expr);
+            AllocaInst *ptr2 = symtable[ref->id];
             return ptr2;
         }
         
         case V_AstType::Neg: {
-            std::shared_ptr<AstNegOp> op = std::static_pointer_cast<AstNegOp>(expr);
+            AstNegOp *op = static_cast<AstNegOp *>(expr);
             Value *val = compileValue(op->value);
             
             return builder->CreateNeg(val);
         } break;
         
         case V_AstType::Assign: {
-            std::shared_ptr<AstAssignOp> op = std::static_pointer_cast<AstAssignOp >(expr);
-            std::shared_ptr<AstExpression> lvalExpr = op->lval;
+            AstAssignOp *op = static_cast<AstAssignOp *>(expr);
+            AstExpression *lvalExpr = op->lval;
             
-            auto lval_id = std::static_pointer_cast<AstID>(lvalExpr);
-            V_AstType dtype = typeTable[lval_id->value]->type;
+            // The variable being assigned to
+            SymbolId lval_name = 0;
+            switch (lvalExpr->type) {
+                case V_AstType::ArrayAccess: lval_name = static_cast<AstArrayAccess *>(lvalExpr)->id; break;
+                case V_AstType::StructAccess: lval_name = static_cast<AstStructAccess *>(lvalExpr)->var_id; break;
+                case V_AstType::PtrTo: lval_name = static_cast<AstPtrTo *>(lvalExpr)->id; break;
+                default: lval_name = static_cast<AstID *>(lvalExpr)->id;
+            }
+            V_AstType dtype = typeTable[lval_name]->type;
             
             Value *ptr = compileValue(lvalExpr, V_AstType::Void, true);
             Value *rval = compileValue(op->rval, dtype);
             
-            builder->CreateStore(rval, ptr);
+            createStore(rval, ptr, isUnsigned(op->rval));
         } break;
         
         case V_AstType::LogicalAnd:
         case V_AstType::LogicalOr: {
-            std::shared_ptr<AstBinaryOp> op = std::static_pointer_cast<AstBinaryOp>(expr);
-            std::shared_ptr<AstExpression> lvalExpr = op->lval;
-            std::shared_ptr<AstExpression> rvalExpr = op->rval;
+            AstBinaryOp *op = static_cast<AstBinaryOp *>(expr);
+            AstExpression *lvalExpr = op->lval;
+            AstExpression *rvalExpr = op->rval;
             
             // We only want the LVal first
             Value *lval = compileValue(lvalExpr);
@@ -314,9 +335,9 @@ Value *Compiler::compileValue(std::shared_ptr<AstExpression> expr, V_AstType dat
         case V_AstType::LT:
         case V_AstType::GTE:
         case V_AstType::LTE: {
-            std::shared_ptr<AstBinaryOp> op = std::static_pointer_cast<AstBinaryOp>(expr);
-            std::shared_ptr<AstExpression> lvalExpr = op->lval;
-            std::shared_ptr<AstExpression> rvalExpr = op->rval;
+            AstBinaryOp *op = static_cast<AstBinaryOp *>(expr);
+            AstExpression *lvalExpr = op->lval;
+            AstExpression *rvalExpr = op->rval;
             
             Value *lval = compileValue(lvalExpr);
             Value *rval = compileValue(rvalExpr);
@@ -326,20 +347,20 @@ Value *Compiler::compileValue(std::shared_ptr<AstExpression> expr, V_AstType dat
                 fltOp = true;
                 
                 if (lvalExpr->type == V_AstType::ID) {
-                    auto lvalID = std::static_pointer_cast<AstID>(lvalExpr);
-                    if (typeTable[lvalID->value]->type == V_AstType::Float64)
+                    auto lvalID = static_cast<AstID *>(lvalExpr);
+                    if (typeTable[lvalID->id]->type == V_AstType::Float64)
                         rval = compileValue(rvalExpr, V_AstType::Float64);
                 } else if (rvalExpr->type == V_AstType::ID) {
-                    auto rvalID = std::static_pointer_cast<AstID>(rvalExpr);
-                    if (typeTable[rvalID->value]->type == V_AstType::Float64)
+                    auto rvalID = static_cast<AstID *>(rvalExpr);
+                    if (typeTable[rvalID->id]->type == V_AstType::Float64)
                         lval = compileValue(lvalExpr, V_AstType::Float64);
                 }
             } else if (lvalExpr->type == V_AstType::ID && rvalExpr->type == V_AstType::ID) {
-                auto lvalID = std::static_pointer_cast<AstID>(lvalExpr);
-                auto rvalID = std::static_pointer_cast<AstID>(rvalExpr);
+                auto lvalID = static_cast<AstID *>(lvalExpr);
+                auto rvalID = static_cast<AstID *>(rvalExpr);
                 
-                V_AstType lvalType = typeTable[lvalID->value]->type;
-                V_AstType rvalType = typeTable[rvalID->value]->type;
+                V_AstType lvalType = typeTable[lvalID->id]->type;
+                V_AstType rvalType = typeTable[rvalID->id]->type;
                 
                 if (lvalType == V_AstType::Float32 || lvalType == V_AstType::Float64) fltOp = true;
                 if (rvalType == V_AstType::Float32 || rvalType == V_AstType::Float64) fltOp = true;
@@ -392,7 +413,7 @@ Value *Compiler::compileValue(std::shared_ptr<AstExpression> expr, V_AstType dat
     return nullptr;
 }
 
-Type *Compiler::translateType(std::shared_ptr<AstDataType> dataType) {
+Type *Compiler::translateType(AstDataType *dataType) {
     if (dataType == nullptr) return Type::getVoidTy(*context);
     Type *type;
     
@@ -409,13 +430,13 @@ Type *Compiler::translateType(std::shared_ptr<AstDataType> dataType) {
         case V_AstType::String:  type = PointerType::getUnqual(Type::getInt8PtrTy(*context)); break;
         
         case V_AstType::Ptr: {
-            std::shared_ptr<AstPointerType> ptrType = std::static_pointer_cast<AstPointerType>(dataType);
+            AstPointerType *ptrType = static_cast<AstPointerType *>(dataType);
             Type *baseType = translateType(ptrType->base_type);
             type = PointerType::getUnqual(baseType);
         } break;
         
         case V_AstType::Struct: {
-            std::shared_ptr<AstStructType> sType = std::static_pointer_cast<AstStructType>(dataType);
+            AstStructType *sType = static_cast<AstStructType *>(dataType);
             type = structTable[sType->name];
         } break;
         
@@ -425,9 +446,141 @@ Type *Compiler::translateType(std::shared_ptr<AstDataType> dataType) {
     return type;
 }
 
-int Compiler::getStructIndex(std::string name, std::string member) {
-    std::string name2 = structVarTable[name];
-    if (name2 != "") name = name2;
+//
+// Creates a stack variable at the top of the current function
+// Keeping every alloca in the entry block lets mem2reg promote them, and
+// stops declarations inside loops from growing the stack on each iteration.
+//
+AllocaInst *Compiler::createEntryAlloca(Type *type) {
+    BasicBlock &entry = currentFunc->getEntryBlock();
+    IRBuilder<> entryBuilder(&entry, entry.begin());
+    return entryBuilder.CreateAlloca(type);
+}
+
+//
+// Stores a value, converting it to the type the pointer points to first
+// The IR for a value doesn't always match its variable (a string literal is
+// an i8*, while string variables hold an i8**), and typed pointers need the
+// two to agree. A structure returned by value can't be converted, so it's
+// stored through a cast of the pointer, as long as it fits. Anything else
+// that doesn't match is a compile error.
+//
+StoreInst *Compiler::createStore(Value *val, Value *ptr, bool unsignedValue) {
+    auto ptrType = cast<PointerType>(ptr->getType());
+    if (!ptrType->isOpaque()) {
+        Type *type = ptrType->getNonOpaquePointerElementType();
+        val = convertValue(val, type, unsignedValue);
+        if (val->getType() != type) {
+            const DataLayout &layout = mod->getDataLayout();
+            if (!val->getType()->isAggregateType() || layout.getTypeStoreSize(val->getType()) > layout.getTypeStoreSize(type)) {
+                std::cerr << "Error: Unable to store a value of the wrong type in ";
+                std::cerr << currentFunc->getName().str() << "." << std::endl;
+                failed = true;
+                return nullptr;
+            }
+            
+            ptr = builder->CreatePointerCast(ptr, PointerType::getUnqual(val->getType()));
+        }
+    }
+    
+    return builder->CreateStore(val, ptr);
+}
+
+//
+// Works out whether an expression gives an unsigned value, so it's widened
+// with a zero extension rather than a sign extension
+// Arithmetic takes after its operands.
+//
+bool Compiler::isUnsigned(AstExpression *expr) {
+    if (expr == nullptr) return false;
+    
+    switch (expr->type) {
+        case V_AstType::ID: {
+            auto type = typeTable.find(static_cast<AstID *>(expr)->id);
+            return type != typeTable.end() && type->second->is_unsigned;
+        }
+        
+        case V_AstType::ArrayAccess: {
+            auto type = typeTable.find(static_cast<AstArrayAccess *>(expr)->id);
+            if (type == typeTable.end() || type->second->type != V_AstType::Ptr) return false;
+            return static_cast<AstPointerType *>(type->second)->base_type->is_unsigned;
+        }
+        
+        case V_AstType::StructAccess: {
+            auto sa = static_cast<AstStructAccess *>(expr);
+            std::string name = structVarTable[sa->var_id];
+            int pos = getStructIndex(sa->var_id, sa->member);
+            
+            for (auto s : tree->structs) {
+                if (s->name == name && pos < (int)s->items.size()) return s->items[pos].type->is_unsigned;
+            }
+            return false;
+        }
+        
+        case V_AstType::Add:
+        case V_AstType::Sub:
+        case V_AstType::Mul:
+        case V_AstType::Div:
+        case V_AstType::Mod:
+        case V_AstType::And:
+        case V_AstType::Or:
+        case V_AstType::Xor:
+        case V_AstType::Lsh:
+        case V_AstType::Rsh: {
+            auto op = static_cast<AstBinaryOp *>(expr);
+            return isUnsigned(op->lval) || isUnsigned(op->rval);
+        }
+        
+        default: {}
+    }
+    
+    return false;
+}
+
+//
+// Converts a value to the given type when the two do not already match
+// Integers are extended or truncated, and integer constants can stand in for
+// pointers (ie, passing 0 as a null pointer). Booleans and unsigned values
+// are zero-extended, and everything else is sign-extended. Pointers are cast
+// to the pointer type that was asked for.
+//
+Value *Compiler::convertValue(Value *val, Type *type, bool unsignedValue) {
+    Type *valType = val->getType();
+    if (valType == type) return val;
+    
+    if (valType->isIntegerTy() && type->isIntegerTy()) {
+        if (unsignedValue || valType->isIntegerTy(1)) return builder->CreateZExtOrTrunc(val, type);
+        return builder->CreateSExtOrTrunc(val, type);
+    }
+    if (valType->isIntegerTy() && type->isPointerTy()) return builder->CreateIntToPtr(val, type);
+    if (valType->isPointerTy() && type->isIntegerTy()) return builder->CreatePtrToInt(val, type);
+    if (valType->isPointerTy() && type->isPointerTy()) return builder->CreatePointerCast(val, type);
+    
+    if (valType->isFloatingPointTy() && type->isFloatingPointTy()) return builder->CreateFPCast(val, type);
+    if (valType->isIntegerTy() && type->isFloatingPointTy()) {
+        if (unsignedValue || valType->isIntegerTy(1)) return builder->CreateUIToFP(val, type);
+        return builder->CreateSIToFP(val, type);
+    }
+    if (valType->isFloatingPointTy() && type->isIntegerTy()) return builder->CreateFPToSI(val, type);
+    return val;
+}
+
+//
+// Converts call arguments to the declared parameter types of the callee
+// Anything passed through the variable-length part of the call is left as-is.
+//
+void Compiler::convertArgs(Function *callee, std::vector<Value *> &args, AstExprList *list) {
+    if (!callee) return;
+    
+    FunctionType *FT = callee->getFunctionType();
+    for (unsigned i = 0; i<args.size() && i<FT->getNumParams(); i++) {
+        args[i] = convertValue(args[i], FT->getParamType(i), isUnsigned(list->list[i]));
+    }
+}
+
+int Compiler::getStructIndex(SymbolId var, std::string member) {
+    std::string name = structVarTable[var];
+    if (name == "") name = Symbol::getName(var);
     
     for (auto s : tree->structs) {
         if (s->name != name) continue;
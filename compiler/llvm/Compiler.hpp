@@ -8,11 +8,14 @@
 #include "llvm/IR/IRBuilder.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/Module.h"
+#include "llvm/Target/TargetMachine.h"
+#include "llvm/ExecutionEngine/Orc/ThreadSafeModule.h"
 
 using namespace llvm;
 
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <stack>
 #include <memory>
 
@@ -21,37 +24,58 @@ using namespace llvm;
 struct CFlags {
     std::string name;
     bool use_memgc = false;
+    bool freestanding = false;
+    int opt_level = 0;
+    int codegen_threads = 1;
 };
 
 class Compiler {
 public:
     explicit Compiler(std::shared_ptr<AstTree> tree, CFlags flags);
-    void compile();
+    bool compile();
     void debug();
     void emitLLVM(std::string path);
-    void writeAssembly();
+    bool writeAssembly(std::string path);
+    bool writeObject(std::string path);
+    std::string writeTempObject();
+    
+    // Jit.cpp
+    void compileJitEntry(AstFunction *astFunc);
+    orc::ThreadSafeModule takeModule();
 protected:
-    void compileStatement(std::shared_ptr<AstStatement> stmt);
-    Value *compileValue(std::shared_ptr<AstExpression> expr, V_AstType dataType = V_AstType::Void, bool isAssign = false);
-    Type *translateType(std::shared_ptr<AstDataType> dataType);
-    int getStructIndex(std::string name, std::string member);
+    void compileStatement(AstStatement *stmt);
+    Value *compileValue(AstExpression *expr, V_AstType dataType = V_AstType::Void, bool isAssign = false);
+    Type *translateType(AstDataType *dataType);
+    int getStructIndex(SymbolId var, std::string member);
+    AllocaInst *createEntryAlloca(Type *type);
+    StoreInst *createStore(Value *val, Value *ptr, bool unsignedValue = false);
+    bool isUnsigned(AstExpression *expr);
+    Value *convertValue(Value *val, Type *type, bool unsignedValue);
+    void convertArgs(Function *callee, std::vector<Value *> &args, AstExprList *list);
+    
+    // Builder.cpp
+    TargetMachine *getTargetMachine();
+    std::unique_ptr<TargetMachine> createTargetMachine();
+    bool emitFile(std::string path, CodeGenFileType fileType);
+    bool emitSplitObject(std::string path);
+    void optimize(TargetMachine *machine);
 
     // Function.cpp
-    void compileFunction(std::shared_ptr<AstStatement> global);
-    void compileExternFunction(std::shared_ptr<AstStatement> global);
-    void compileFuncCallStatement(std::shared_ptr<AstStatement> stmt);
-    void compileReturnStatement(std::shared_ptr<AstStatement> stmt);
+    void compileFunction(AstStatement *global);
+    void compileExternFunction(AstStatement *global);
+    void compileFuncCallStatement(AstStatement *stmt);
+    void compileReturnStatement(AstStatement *stmt);
     
     // Flow.cpp
-    void compileIfStatement(std::shared_ptr<AstStatement> stmt);
-    void compileWhileStatement(std::shared_ptr<AstStatement> stmt);
-    void compileRepeatStatement(std::shared_ptr<AstStatement> stmt);
-    void compileForStatement(std::shared_ptr<AstStatement> stmt);
-    void compileForAllStatement(std::shared_ptr<AstStatement> stmt);
+    void compileIfStatement(AstStatement *stmt);
+    void compileWhileStatement(AstStatement *stmt);
+    void compileRepeatStatement(AstStatement *stmt);
+    void compileForStatement(AstStatement *stmt);
+    void compileForAllStatement(AstStatement *stmt);
     
     // Variable.cpp
-    void compileStructDeclaration(std::shared_ptr<AstStatement> stmt);
-    Value *compileStructAccess(std::shared_ptr<AstExpression> expr, bool isAssign = false);
+    void compileStructDeclaration(AstStatement *stmt);
+    Value *compileStructAccess(AstExpression *expr, bool isAssign = false);
 private:
     std::shared_ptr<AstTree> tree;
     CFlags cflags;
@@ -60,17 +84,18 @@ private:
     std::unique_ptr<LLVMContext> context;
     std::unique_ptr<Module> mod;
     std::unique_ptr<IRBuilder<>> builder;
+    std::unique_ptr<TargetMachine> machine;
     Function *currentFunc;
-    std::shared_ptr<AstDataType> currentFuncType;
+    AstDataType *currentFuncType = nullptr;
     
     // The user-defined structure table
     std::map<std::string, StructType*> structTable;
-    std::map<std::string, std::string> structVarTable;
+    std::unordered_map<SymbolId, std::string> structVarTable;
     std::map<std::string, std::vector<Type *>> structElementTypeTable;
     
     // Symbol table
-    std::map<std::string, AllocaInst *> symtable;
-    std::map<std::string, std::shared_ptr<AstDataType>> typeTable;
+    std::unordered_map<SymbolId, AllocaInst *> symtable;
+    std::unordered_map<SymbolId, AstDataType *> typeTable;
     
     // Block stack
     int blockCount = 0;
@@ -78,5 +103,8 @@ private:
     std::stack<BasicBlock *> continueStack;
     std::stack<BasicBlock *> logicalAndStack;
     std::stack<BasicBlock *> logicalOrStack;
+    
+    // Set once an error has been reported
+    bool failed = false;
 };
 
@@ -6,10 +6,10 @@
 #include "Compiler.hpp"
 
 // Translates an AST IF statement to LLVM
-void Compiler::compileIfStatement(std::shared_ptr<AstStatement> stmt) {
-    std::shared_ptr<AstIfStmt> condStmt = std::static_pointer_cast<AstIfStmt>(stmt);
-    std::shared_ptr<AstBlock> astTrueBlock = condStmt->true_block;
-    std::shared_ptr<AstBlock> astFalseBlock = condStmt->false_block;
+void Compiler::compileIfStatement(AstStatement *stmt) {
+    AstIfStmt *condStmt = static_cast<AstIfStmt *>(stmt);
+    AstBlock *astTrueBlock = condStmt->true_block;
+    AstBlock *astFalseBlock = condStmt->false_block;
     
     BasicBlock *trueBlock = BasicBlock::Create(*context, "true" + std::to_string(blockCount), currentFunc);
     BasicBlock *falseBlock = BasicBlock::Create(*context, "false" + std::to_string(blockCount), currentFunc);
@@ -37,6 +37,7 @@ void Compiler::compileIfStatement(std::shared_ptr<AstStatement> stmt) {
         compileStatement(stmt2);
         if (stmt2->type == V_AstType::Return) branchEnd = false;
         if (stmt2->type == V_AstType::Break) branchEnd = false;
+        if (stmt2->type == V_AstType::Continue) branchEnd = false;
     }
     if (branchEnd) builder->CreateBr(endBlock);
     
@@ -47,6 +48,7 @@ void Compiler::compileIfStatement(std::shared_ptr<AstStatement> stmt) {
         compileStatement(stmt2);
         if (stmt2->type == V_AstType::Return) branchEnd = false;
         if (stmt2->type == V_AstType::Break) branchEnd = false;
+        if (stmt2->type == V_AstType::Continue) branchEnd = false;
     }
     if (branchEnd) builder->CreateBr(endBlock);
     
@@ -55,8 +57,8 @@ void Compiler::compileIfStatement(std::shared_ptr<AstStatement> stmt) {
 }
 
 // Translates a while statement to LLVM
-void Compiler::compileWhileStatement(std::shared_ptr<AstStatement> stmt) {
-    std::shared_ptr<AstWhileStmt> loop = std::static_pointer_cast<AstWhileStmt>(stmt);
+void Compiler::compileWhileStatement(AstStatement *stmt) {
+    AstWhileStmt *loop = static_cast<AstWhileStmt *>(stmt);
 
     BasicBlock *loopBlock = BasicBlock::Create(*context, "loop_body" + std::to_string(blockCount), currentFunc);
     BasicBlock *loopCmp = BasicBlock::Create(*context, "loop_cmp" + std::to_string(blockCount), currentFunc);
@@ -80,7 +82,7 @@ void Compiler::compileWhileStatement(std::shared_ptr<AstStatement> stmt) {
     for (auto stmt : loop->block->getBlock()) {
         compileStatement(stmt);
     }
-    builder->CreateBr(loopCmp);
+    if (!builder->GetInsertBlock()->getTerminator()) builder->CreateBr(loopCmp);
     
     builder->SetInsertPoint(loopEnd);
     
@@ -89,8 +91,8 @@ void Compiler::compileWhileStatement(std::shared_ptr<AstStatement> stmt) {
 }
 
 // Translates a repeat statement to LLVM
-void Compiler::compileRepeatStatement(std::shared_ptr<AstStatement> stmt) {
-    std::shared_ptr<AstRepeatStmt> loop = std::static_pointer_cast<AstRepeatStmt>(stmt);
+void Compiler::compileRepeatStatement(AstStatement *stmt) {
+    AstRepeatStmt *loop = static_cast<AstRepeatStmt *>(stmt);
     
     BasicBlock *loopBlock = BasicBlock::Create(*context, "loop_body" + std::to_string(blockCount), currentFunc);
     BasicBlock *loopEnd = BasicBlock::Create(*context, "loop_end" + std::to_string(blockCount), currentFunc);
@@ -109,7 +111,7 @@ void Compiler::compileRepeatStatement(std::shared_ptr<AstStatement> stmt) {
     for (auto stmt : loop->block->getBlock()) {
         compileStatement(stmt);
     }
-    builder->CreateBr(loopBlock);
+    if (!builder->GetInsertBlock()->getTerminator()) builder->CreateBr(loopBlock);
     
     builder->SetInsertPoint(loopEnd);
     
@@ -118,8 +120,8 @@ void Compiler::compileRepeatStatement(std::shared_ptr<AstStatement> stmt) {
 }
 
 // Translates a for loop to LLVM
-void Compiler::compileForStatement(std::shared_ptr<AstStatement> stmt) {
-    auto loop = std::static_pointer_cast<AstForStmt>(stmt);
+void Compiler::compileForStatement(AstStatement *stmt) {
+    auto loop = static_cast<AstForStmt *>(stmt);
     
     BasicBlock *loopBlock = BasicBlock::Create(*context, "loop_body" + std::to_string(blockCount), currentFunc);
     BasicBlock *loopInc = BasicBlock::Create(*context, "loop_inc" + std::to_string(blockCount), currentFunc);
@@ -137,17 +139,17 @@ void Compiler::compileForStatement(std::shared_ptr<AstStatement> stmt) {
     continueStack.push(loopCmp);
     
     // Create the induction variable and back up the symbol tables
-    std::map<std::string, AllocaInst *> symtableOld = symtable;
-    std::map<std::string, std::shared_ptr<AstDataType>> typeTableOld = typeTable;
+    std::unordered_map<SymbolId, AllocaInst *> symtableOld = symtable;
+    std::unordered_map<SymbolId, AstDataType *> typeTableOld = typeTable;
     Type *data_type = translateType(loop->data_type);
     
-    std::string indexName = loop->index->value;
-    AllocaInst *indexVar = builder->CreateAlloca(data_type);
+    SymbolId indexName = loop->index->id;
+    AllocaInst *indexVar = createEntryAlloca(data_type);
     symtable[indexName] = indexVar;
     typeTable[indexName] = loop->data_type;
     
     Value *startVal = compileValue(loop->start);
-    builder->CreateStore(startVal, indexVar);
+    createStore(startVal, indexVar);
     
     // Create the rest of the loop
     builder->CreateBr(loopCmp);
@@ -164,7 +166,7 @@ void Compiler::compileForStatement(std::shared_ptr<AstStatement> stmt) {
     indexVal = builder->CreateLoad(data_type, indexVar);
     Value *incVal = compileValue(loop->step);
     indexVal = builder->CreateAdd(indexVal, incVal);
-    builder->CreateStore(indexVal, indexVar);
+    createStore(indexVal, indexVar);
     
     builder->CreateBr(loopCmp);
 
@@ -173,7 +175,7 @@ void Compiler::compileForStatement(std::shared_ptr<AstStatement> stmt) {
     for (auto stmt : loop->block->getBlock()) {
         compileStatement(stmt);
     }
-    builder->CreateBr(loopInc);
+    if (!builder->GetInsertBlock()->getTerminator()) builder->CreateBr(loopInc);
     
     builder->SetInsertPoint(loopEnd);
     
@@ -185,8 +187,8 @@ void Compiler::compileForStatement(std::shared_ptr<AstStatement> stmt) {
 }
 
 // Translates a for-all loop to LLVM
-void Compiler::compileForAllStatement(std::shared_ptr<AstStatement> stmt) {
-    std::shared_ptr<AstForAllStmt> loop = std::static_pointer_cast<AstForAllStmt>(stmt);
+void Compiler::compileForAllStatement(AstStatement *stmt) {
+    AstForAllStmt *loop = static_cast<AstForAllStmt *>(stmt);
     
     // Setup the blocks
     BasicBlock *loopLoad = BasicBlock::Create(*context, "loop_load" + std::to_string(blockCount), currentFunc);
@@ -209,8 +211,8 @@ void Compiler::compileForAllStatement(std::shared_ptr<AstStatement> stmt) {
     //
     // Get the structure type for the array- will be needed later on
     //
-    std::string arrayName = loop->array->value;
-    std::string indexName = loop->index->value;
+    SymbolId arrayName = loop->array->id;
+    SymbolId indexName = loop->index->id;
     Type *indexType = translateType(loop->data_type);
     
     std::string strTypeName = structVarTable[arrayName];
@@ -221,17 +223,17 @@ void Compiler::compileForAllStatement(std::shared_ptr<AstStatement> stmt) {
     ///
     // Create the induction variable, the max-size variable, and the element variables
     //
-    std::map<std::string, AllocaInst *> symtableOld = symtable;
-    std::map<std::string, std::shared_ptr<AstDataType>> typeTableOld = typeTable;
+    std::unordered_map<SymbolId, AllocaInst *> symtableOld = symtable;
+    std::unordered_map<SymbolId, AstDataType *> typeTableOld = typeTable;
     
     // The induction variable
-    AllocaInst *indexVar = builder->CreateAlloca(indexType);
+    AllocaInst *indexVar = createEntryAlloca(indexType);
     symtable[indexName] = indexVar;
     typeTable[indexName] = loop->data_type;
     
     Type *idxType = Type::getInt32Ty(*context);
-    AllocaInst *inductionVar = builder->CreateAlloca(idxType);
-    builder->CreateStore(builder->getInt32(0), inductionVar);
+    AllocaInst *inductionVar = createEntryAlloca(idxType);
+    createStore(builder->getInt32(0), inductionVar);
     
     // The size value
     AllocaInst *arrayPtr = symtable[arrayName];
@@ -240,7 +242,7 @@ void Compiler::compileForAllStatement(std::shared_ptr<AstStatement> stmt) {
     Value *ptr = builder->CreateLoad(strTypePtr, arrayPtr);
     
     Value *sizePtr = builder->CreateStructGEP(strType, ptr, 1);
-    Value *sizeVal = builder->CreateLoad(indexType, sizePtr);
+    Value *sizeVal = builder->CreateLoad(sizeType, sizePtr);
     
     ///
     // Create the loop comparison
@@ -248,7 +250,7 @@ void Compiler::compileForAllStatement(std::shared_ptr<AstStatement> stmt) {
     builder->CreateBr(loopCmp);
     builder->SetInsertPoint(loopCmp);
     
-    Value *inductionVarVal = builder->CreateLoad(indexType, inductionVar);
+    Value *inductionVarVal = builder->CreateLoad(idxType, inductionVar);
     Value *cond = builder->CreateICmpSLT(inductionVarVal, sizeVal);
     builder->CreateCondBr(cond, loopLoad, loopEnd);
     
@@ -257,9 +259,9 @@ void Compiler::compileForAllStatement(std::shared_ptr<AstStatement> stmt) {
     //
     builder->SetInsertPoint(loopInc);
     
-    inductionVarVal = builder->CreateLoad(indexType, inductionVar);
+    inductionVarVal = builder->CreateLoad(idxType, inductionVar);
     inductionVarVal = builder->CreateAdd(inductionVarVal, builder->getInt32(1));
-    builder->CreateStore(inductionVarVal, inductionVar);
+    createStore(inductionVarVal, inductionVar);
     
     builder->CreateBr(loopCmp);
     
@@ -268,13 +270,13 @@ void Compiler::compileForAllStatement(std::shared_ptr<AstStatement> stmt) {
     //
     builder->SetInsertPoint(loopLoad);
     
-    inductionVarVal = builder->CreateLoad(indexType, inductionVar);
+    inductionVarVal = builder->CreateLoad(idxType, inductionVar);
     
     Value *arrayStructPtr = builder->CreateStructGEP(strType, ptr, 0);
     Value *arrayLoad = builder->CreateLoad(elementType, arrayStructPtr);
     Value *ep = builder->CreateGEP(indexType, arrayLoad, inductionVarVal);
     Value *epLd = builder->CreateLoad(indexType, ep);
-    builder->CreateStore(epLd, indexVar);
+    createStore(epLd, indexVar);
     
     builder->CreateBr(loopBody);
     
@@ -285,7 +287,7 @@ void Compiler::compileForAllStatement(std::shared_ptr<AstStatement> stmt) {
     for (auto stmt : loop->block->getBlock()) {
         compileStatement(stmt);
     }
-    builder->CreateBr(loopInc);
+    if (!builder->GetInsertBlock()->getTerminator()) builder->CreateBr(loopInc);
     
     builder->SetInsertPoint(loopEnd);
     
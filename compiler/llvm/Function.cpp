@@ -10,12 +10,12 @@
 //
 // Compiles a function and its body
 //
-void Compiler::compileFunction(std::shared_ptr<AstStatement> global) {
+void Compiler::compileFunction(AstStatement *global) {
     symtable.clear();
     typeTable.clear();
     structVarTable.clear();
     
-    std::shared_ptr<AstFunction> astFunc = std::static_pointer_cast<AstFunction>(global);
+    AstFunction *astFunc = static_cast<AstFunction *>(global);
 
     std::vector<Var> astVarArgs = astFunc->args;
     FunctionType *FT;
@@ -37,7 +37,11 @@ void Compiler::compileFunction(std::shared_ptr<AstStatement> global) {
         FT = FunctionType::get(funcType, args, false);
     }
     
-    Function *func = Function::Create(FT, Function::ExternalLinkage, astFunc->name, mod.get());
+    // Private functions are never seen outside of their own object file
+    GlobalValue::LinkageTypes linkage = Function::ExternalLinkage;
+    if (astFunc->attr == Attr::Private) linkage = Function::InternalLinkage;
+    
+    Function *func = Function::Create(FT, linkage, astFunc->name, mod.get());
     currentFunc = func;
 
     BasicBlock *mainBlock = BasicBlock::Create(*context, "entry", func);
@@ -51,19 +55,19 @@ void Compiler::compileFunction(std::shared_ptr<AstStatement> global) {
             // Build the alloca for the local var
             Type *type = translateType(var.type);
             if (var.type->type == V_AstType::Struct) {
-                symtable[var.name] = (AllocaInst *)func->getArg(i);
-                typeTable[var.name] = var.type;
-                structVarTable[var.name] = std::static_pointer_cast<AstStructType>(var.type)->name;
+                symtable[var.id] = (AllocaInst *)func->getArg(i);
+                typeTable[var.id] = var.type;
+                structVarTable[var.id] = static_cast<AstStructType *>(var.type)->name;
                 continue;
             }
             
             AllocaInst *alloca = builder->CreateAlloca(type);
-            symtable[var.name] = alloca;
-            typeTable[var.name] = var.type;
+            symtable[var.id] = alloca;
+            typeTable[var.id] = var.type;
             
             // Store the variable
             Value *param = func->getArg(i);
-            builder->CreateStore(param, alloca);
+            createStore(param, alloca, var.type->is_unsigned);
         }
     }
 
@@ -75,8 +79,8 @@ void Compiler::compileFunction(std::shared_ptr<AstStatement> global) {
 //
 // Compiles an extern function declaration
 //
-void Compiler::compileExternFunction(std::shared_ptr<AstStatement> global) {
-    std::shared_ptr<AstExternFunction> astFunc = std::static_pointer_cast<AstExternFunction>(global);
+void Compiler::compileExternFunction(AstStatement *global) {
+    AstExternFunction *astFunc = static_cast<AstExternFunction *>(global);
     
     std::vector<Var> astVarArgs = astFunc->args;
     FunctionType *FT;
@@ -104,15 +108,15 @@ void Compiler::compileExternFunction(std::shared_ptr<AstStatement> global) {
 //
 // // TODO: We should not do error handeling in the compiler. Check for invalid functions in the AST level
 //
-void Compiler::compileFuncCallStatement(std::shared_ptr<AstStatement> stmt) {
-    std::shared_ptr<AstFuncCallStmt> fc = std::static_pointer_cast<AstFuncCallStmt>(stmt);
+void Compiler::compileFuncCallStatement(AstStatement *stmt) {
+    AstFuncCallStmt *fc = static_cast<AstFuncCallStmt *>(stmt);
     std::vector<Value *> args;
     
     /*for (auto stmt : stmt->getExpressions()) {
         Value *val = compileValue(stmt);
         args.push_back(val);
     }*/
-    std::shared_ptr<AstExprList> list = std::static_pointer_cast<AstExprList>(fc->expression);
+    AstExprList *list = static_cast<AstExprList *>(fc->expression);
     for (auto arg : list->list) {
         Value *val = compileValue(arg);
         args.push_back(val);
@@ -120,6 +124,7 @@ void Compiler::compileFuncCallStatement(std::shared_ptr<AstStatement> stmt) {
     
     Function *callee = mod->getFunction(fc->name);
     if (!callee) std::cerr << "Invalid function call statement: " << fc->name << std::endl;
+    convertArgs(callee, args, list);
     builder->CreateCall(callee, args);
 }
 
@@ -127,17 +132,18 @@ void Compiler::compileFuncCallStatement(std::shared_ptr<AstStatement> stmt) {
 // Compiles a return statement
 // TODO: We may want to rethink this some
 //
-void Compiler::compileReturnStatement(std::shared_ptr<AstStatement> stmt) {
+void Compiler::compileReturnStatement(AstStatement *stmt) {
     if (!stmt->hasExpression()) {
         builder->CreateRetVoid();
     } else if (stmt->hasExpression()) {
         Value *val = compileValue(stmt->expression);
         if (currentFuncType->type == V_AstType::Struct) {
-            std::shared_ptr<AstStructType> sType = std::static_pointer_cast<AstStructType>(currentFuncType);
+            AstStructType *sType = static_cast<AstStructType *>(currentFuncType);
             StructType *type = structTable[sType->name];
             Value *ld = builder->CreateLoad(type, val);
             builder->CreateRet(ld);
         } else {
+            val = convertValue(val, currentFunc->getReturnType(), isUnsigned(stmt->expression));
             builder->CreateRet(val);
         }
     } else {
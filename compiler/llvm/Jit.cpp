@@ -0,0 +1,193 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#include "llvm/ExecutionEngine/Orc/ExecutionUtils.h"
+#include "llvm/IR/Verifier.h"
+#include "llvm/Support/DynamicLibrary.h"
+#include "llvm/Support/TargetSelect.h"
+
+using namespace llvm;
+
+#include <mutex>
+
+#include "Jit.hpp"
+
+static std::once_flag jitTargetFlag;
+
+//
+// Sets up a JIT for the host
+//
+std::unique_ptr<Jit> Jit::create(std::string &error) {
+    std::call_once(jitTargetFlag, []() {
+        InitializeNativeTarget();
+        InitializeNativeTargetAsmPrinter();
+    });
+    
+    auto jit = orc::LLJITBuilder().create();
+    if (!jit) {
+        error = toString(jit.takeError());
+        return nullptr;
+    }
+    
+    auto result = std::make_unique<Jit>();
+    result->jit = std::move(*jit);
+    return result;
+}
+
+//
+// Runtime libraries for the modules compiled after this
+//
+void Jit::addArchive(std::string path) {
+    archives.push_back(path);
+}
+
+void Jit::addSymbol(std::string name, void *address) {
+    symbols[name] = address;
+}
+
+//
+// Loads a shared library into the process, so its symbols can be found
+//
+bool Jit::loadLibrary(std::string path) {
+    std::string message;
+    if (sys::DynamicLibrary::LoadLibraryPermanently(path.c_str(), &message)) {
+        error = message;
+        return false;
+    }
+    
+    return true;
+}
+
+//
+// Adds the compiler's module in a library of its own, and returns the address
+// of the given function from it. If anything goes wrong, null is returned and
+// the reason is left in the error string.
+//
+void *Jit::compile(Compiler *compiler, std::string name) {
+    orc::ThreadSafeModule module = compiler->takeModule();
+    if (!module) {
+        error = "The module is not valid.";
+        return nullptr;
+    }
+    
+    module.withModuleDo([this](Module &mod) {
+        mod.setDataLayout(jit->getDataLayout());
+    });
+    
+    auto library = jit->createJITDylib("module" + std::to_string(libraries++));
+    if (!library) {
+        error = toString(library.takeError());
+        return nullptr;
+    }
+    
+    if (!symbols.empty()) {
+        orc::SymbolMap map;
+        for (auto const &symbol : symbols) {
+            map[jit->mangleAndIntern(symbol.first)] = JITEvaluatedSymbol(
+                pointerToJITTargetAddress(symbol.second), JITSymbolFlags::Exported);
+        }
+        
+        if (auto err = library->define(orc::absoluteSymbols(std::move(map)))) {
+            error = toString(std::move(err));
+            return nullptr;
+        }
+    }
+    
+    for (auto const &path : archives) {
+        auto archive = orc::StaticLibraryDefinitionGenerator::Load(jit->getObjLinkingLayer(), path.c_str());
+        if (!archive) {
+            error = toString(archive.takeError());
+            return nullptr;
+        }
+        
+        library->addGenerator(std::move(*archive));
+    }
+    
+    auto generator = orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(jit->getDataLayout().getGlobalPrefix());
+    if (!generator) {
+        error = toString(generator.takeError());
+        return nullptr;
+    }
+    
+    library->addGenerator(std::move(*generator));
+    
+    if (auto err = jit->addIRModule(*library, std::move(module))) {
+        error = toString(std::move(err));
+        return nullptr;
+    }
+    
+    auto symbol = jit->lookup(*library, name);
+    if (!symbol) {
+        error = toString(symbol.takeError());
+        return nullptr;
+    }
+    
+    return (void *)symbol->getAddress();
+}
+
+//
+// Builds an entry point for calling a function from outside of compiled code
+//
+// The entry point takes an array of arguments and a place for the result, all
+// as 64-bit slots. Integers are sign-extended, and floats are passed as the bits
+// of a double. This gives every function the same signature, no matter what its
+// own arguments are.
+//
+void Compiler::compileJitEntry(AstFunction *astFunc) {
+    Function *callee = mod->getFunction(astFunc->name);
+    if (!callee) return;
+    
+    Type *i64 = Type::getInt64Ty(*context);
+    Type *f64 = Type::getDoubleTy(*context);
+    Type *ptr = PointerType::getUnqual(i64);
+    
+    FunctionType *FT = FunctionType::get(Type::getVoidTy(*context), { ptr, ptr }, false);
+    Function *func = Function::Create(FT, Function::ExternalLinkage, astFunc->name + ".entry", mod.get());
+    
+    BasicBlock *mainBlock = BasicBlock::Create(*context, "entry", func);
+    builder->SetInsertPoint(mainBlock);
+    
+    std::vector<Value *> args;
+    for (int i = 0; i<callee->arg_size(); i++) {
+        Type *type = callee->getFunctionType()->getParamType(i);
+        Value *slot = builder->CreateConstGEP1_64(i64, func->getArg(0), i);
+        Value *arg = builder->CreateLoad(i64, slot);
+        
+        if (type->isFloatingPointTy()) {
+            arg = builder->CreateBitCast(arg, f64);
+            arg = builder->CreateFPCast(arg, type);
+        } else {
+            arg = builder->CreateIntCast(arg, type, true);
+        }
+        
+        args.push_back(arg);
+    }
+    
+    Value *result = builder->CreateCall(callee, args);
+    Type *retType = callee->getReturnType();
+    
+    if (retType->isFloatingPointTy()) {
+        result = builder->CreateFPCast(result, f64);
+        builder->CreateStore(builder->CreateBitCast(result, i64), func->getArg(1));
+    } else if (retType->isIntegerTy()) {
+        bool isSigned = !retType->isIntegerTy(1);
+        builder->CreateStore(builder->CreateIntCast(result, i64, isSigned), func->getArg(1));
+    }
+    
+    builder->CreateRetVoid();
+}
+
+//
+// Hands the module over to the JIT
+// A module that fails the verifier is never optimized or handed over; the
+// caller gets an empty module back instead.
+//
+orc::ThreadSafeModule Compiler::takeModule() {
+    if (verifyModule(*mod)) return orc::ThreadSafeModule();
+    if (!getTargetMachine()) return orc::ThreadSafeModule();
+    
+    return orc::ThreadSafeModule(std::move(mod), std::move(context));
+}
+
@@ -0,0 +1,45 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#pragma once
+
+#include "llvm/ExecutionEngine/Orc/LLJIT.h"
+
+using namespace llvm;
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <map>
+
+#include "Compiler.hpp"
+
+//
+// Runs code from the compiler in-process, through ORC's LLJIT
+//
+// Every module goes into a library of its own, so the same function can be
+// compiled more than once (for instance, as part of two different groups of
+// hot functions) without the definitions clashing.
+//
+// Symbols that a module doesn't define come from, in order: the symbols given
+// with addSymbol, the static archives given with addArchive (only the members
+// that are needed are loaded, the same as with ld), and the running process.
+//
+class Jit {
+public:
+    static std::unique_ptr<Jit> create(std::string &error);
+    void addArchive(std::string path);
+    void addSymbol(std::string name, void *address);
+    bool loadLibrary(std::string path);
+    void *compile(Compiler *compiler, std::string name);
+    std::string getError() { return error; }
+private:
+    std::unique_ptr<orc::LLJIT> jit;
+    std::vector<std::string> archives;
+    std::map<std::string, void *> symbols;
+    int libraries = 0;
+    std::string error;
+};
+
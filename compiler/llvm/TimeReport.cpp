@@ -0,0 +1,256 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#include <sys/resource.h>
+#include <time.h>
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "TimeReport.hpp"
+
+struct PhaseRecord {
+    std::string name;
+    std::string detail;
+    int depth;
+    int thread;
+    double start;
+    double wall;
+    double cpu;
+    long rss;
+};
+
+static bool reportEnabled = false;
+static bool printEnabled = false;
+static std::string traceFile = "";
+static std::chrono::steady_clock::time_point origin;
+
+static std::mutex reportMutex;
+static std::vector<PhaseRecord> records;
+static std::map<V_AstType, size_t> nodeCounts;
+static std::map<std::thread::id, int> threadIds;
+
+static thread_local int phaseDepth = 0;
+
+// Milliseconds since the report was turned on
+static double getTime() {
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - origin;
+    return elapsed.count();
+}
+
+static double getThreadCpu() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static double getCpu(int who) {
+    struct rusage usage;
+    getrusage(who, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0
+        + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+}
+
+// The high-water mark of the whole process, in kilobytes
+static long getPeakRss() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+static std::string escape(std::string input) {
+    std::string output = "";
+    for (char c : input) {
+        if (c == '"' || c == '\\') output += '\\';
+        if (c == '\n') { output += "\\n"; continue; }
+        output += c;
+    }
+    return output;
+}
+
+//
+// Turns the report on
+// The table goes to stderr when the compile finishes, and if a trace path
+// is given, the phases are written there as a Chrome trace as well.
+//
+void TimeReport::enable(bool printReport, std::string tracePath) {
+    if (!printReport && tracePath == "") return;
+    
+    reportEnabled = true;
+    printEnabled = printReport;
+    traceFile = tracePath;
+    origin = std::chrono::steady_clock::now();
+    
+    // The thread that turns the report on is the main one
+    threadIds[std::this_thread::get_id()] = 0;
+}
+
+bool TimeReport::isEnabled() {
+    return reportEnabled;
+}
+
+//
+// Adds the nodes of a finished tree to the counts
+//
+void TimeReport::countNodes(std::shared_ptr<AstTree> tree) {
+    if (!reportEnabled) return;
+    
+    auto counts = tree->countNodes();
+    
+    std::lock_guard<std::mutex> lock(reportMutex);
+    for (auto const &count : counts) nodeCounts[count.first] += count.second;
+}
+
+//
+// Prints the report and writes out the trace
+//
+void TimeReport::finish() {
+    if (!reportEnabled) return;
+    
+    std::lock_guard<std::mutex> lock(reportMutex);
+    std::sort(records.begin(), records.end(), [](const PhaseRecord &a, const PhaseRecord &b) {
+        return a.start < b.start;
+    });
+    
+    double totalWall = getTime();
+    double totalCpu = getCpu(RUSAGE_SELF) + getCpu(RUSAGE_CHILDREN);
+    long totalRss = getPeakRss();
+    
+    if (printEnabled) {
+        std::cerr << "===--- Time report ---===" << std::endl;
+        std::cerr << std::fixed << std::setprecision(2);
+        std::cerr << "  " << std::left << std::setw(44) << "Phase" << std::right;
+        std::cerr << std::setw(12) << "Wall (ms)" << std::setw(12) << "CPU (ms)";
+        std::cerr << std::setw(12) << "RSS (MB)" << std::endl;
+        
+        for (auto const &record : records) {
+            std::string name = std::string(record.depth * 2, ' ') + record.name;
+            if (record.detail != "") {
+                name += " (" + record.detail.substr(record.detail.find_last_of('/') + 1) + ")";
+            }
+            if (threadIds.size() > 1) name += " [" + std::to_string(record.thread) + "]";
+            
+            std::cerr << "  " << std::left << std::setw(44) << name << std::right;
+            std::cerr << std::setw(12) << record.wall << std::setw(12) << record.cpu;
+            std::cerr << std::setw(12) << record.rss / 1024.0 << std::endl;
+        }
+        
+        std::cerr << "  " << std::left << std::setw(44) << "Total" << std::right;
+        std::cerr << std::setw(12) << totalWall << std::setw(12) << totalCpu;
+        std::cerr << std::setw(12) << totalRss / 1024.0 << std::endl;
+        
+        if (!nodeCounts.empty()) {
+            size_t total = 0;
+            
+            std::cerr << std::endl << "===--- AST nodes ---===" << std::endl;
+            for (auto const &count : nodeCounts) {
+                std::cerr << "  " << std::left << std::setw(44) << getAstTypeName(count.first) << std::right;
+                std::cerr << std::setw(12) << count.second << std::endl;
+                total += count.second;
+            }
+            
+            std::cerr << "  " << std::left << std::setw(44) << "Total" << std::right;
+            std::cerr << std::setw(12) << total << std::endl;
+        }
+    }
+    
+    if (traceFile != "") {
+        std::ostringstream trace;
+        trace << std::fixed << std::setprecision(3);
+        trace << "{\"traceEvents\":[\n";
+        
+        for (auto const &thread : threadIds) {
+            trace << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.second;
+            trace << ",\"args\":{\"name\":\"" << (thread.second == 0 ? "main" : "worker") << "\"}},\n";
+        }
+        
+        for (auto const &record : records) {
+            trace << "{\"name\":\"" << escape(record.name) << "\",\"cat\":\"phase\",\"ph\":\"X\",\"pid\":1";
+            trace << ",\"tid\":" << record.thread;
+            trace << ",\"ts\":" << record.start * 1000.0 << ",\"dur\":" << record.wall * 1000.0;
+            trace << ",\"args\":{\"detail\":\"" << escape(record.detail) << "\",\"cpu_ms\":" << record.cpu;
+            trace << ",\"rss_kb\":" << record.rss << "}},\n";
+            
+            trace << "{\"name\":\"Peak RSS\",\"ph\":\"C\",\"pid\":1";
+            trace << ",\"ts\":" << (record.start + record.wall) * 1000.0;
+            trace << ",\"args\":{\"kb\":" << record.rss << "}},\n";
+        }
+        
+        trace << "{\"name\":\"Total\",\"cat\":\"phase\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":0";
+        trace << ",\"dur\":" << totalWall * 1000.0 << ",\"args\":{\"cpu_ms\":" << totalCpu;
+        trace << ",\"rss_kb\":" << totalRss << "}}\n";
+        trace << "],\n\"displayTimeUnit\":\"ms\",\n\"otherData\":{";
+        
+        bool first = true;
+        for (auto const &count : nodeCounts) {
+            if (!first) trace << ",";
+            trace << "\"ast." << getAstTypeName(count.first) << "\":" << count.second;
+            first = false;
+        }
+        trace << "}}\n";
+        
+        std::ofstream writer(traceFile);
+        if (!writer) {
+            std::cerr << "Unable to write the trace to " << traceFile << std::endl;
+            return;
+        }
+        writer << trace.str();
+    }
+}
+
+//
+// TimePhase
+//
+TimePhase::TimePhase(std::string name, std::string detail) {
+    if (!reportEnabled) return;
+    
+    this->name = name;
+    this->detail = detail;
+    running = true;
+    depth = phaseDepth++;
+    start = getTime();
+    startCpu = getThreadCpu();
+    startChildCpu = getCpu(RUSAGE_CHILDREN);
+}
+
+TimePhase::~TimePhase() {
+    stop();
+}
+
+//
+// Ends the phase early
+//
+void TimePhase::stop() {
+    if (!running) return;
+    running = false;
+    --phaseDepth;
+    
+    PhaseRecord record;
+    record.name = name;
+    record.detail = detail;
+    record.depth = depth;
+    record.start = start;
+    record.wall = getTime() - start;
+    record.cpu = (getThreadCpu() - startCpu) + (getCpu(RUSAGE_CHILDREN) - startChildCpu);
+    record.rss = getPeakRss();
+    
+    std::lock_guard<std::mutex> lock(reportMutex);
+    auto id = threadIds.find(std::this_thread::get_id());
+    if (id == threadIds.end()) {
+        id = threadIds.insert({ std::this_thread::get_id(), (int)threadIds.size() }).first;
+    }
+    
+    record.thread = id->second;
+    records.push_back(record);
+}
+
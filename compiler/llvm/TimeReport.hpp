@@ -0,0 +1,47 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#pragma once
+
+#include <string>
+#include <memory>
+
+#include <ast/ast.hpp>
+
+//
+// Keeps track of where the time goes in a compile
+//
+// Each phase records its wall time, the CPU time of the thread it ran on
+// (plus any child processes, such as the linker), and the peak RSS of the
+// process when it finished. Phases can nest and can run on several threads
+// at once. Nothing is recorded unless the report has been turned on, so the
+// phases can stay in the code for good.
+//
+class TimeReport {
+public:
+    static void enable(bool printReport, std::string tracePath);
+    static bool isEnabled();
+    static void countNodes(std::shared_ptr<AstTree> tree);
+    static void finish();
+};
+
+//
+// Times everything from its creation until it goes out of scope
+//
+class TimePhase {
+public:
+    explicit TimePhase(std::string name, std::string detail = "");
+    ~TimePhase();
+    void stop();
+private:
+    bool running = false;
+    std::string name;
+    std::string detail;
+    int depth = 0;
+    double start = 0;
+    double startCpu = 0;
+    double startChildCpu = 0;
+};
+
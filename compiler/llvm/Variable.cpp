@@ -10,18 +10,18 @@
 #include <ast/ast_builder.hpp>
 
 // Compiles a structure declaration
-void Compiler::compileStructDeclaration(std::shared_ptr<AstStatement> stmt) {
-    std::shared_ptr<AstStructDec> sd = std::static_pointer_cast<AstStructDec>(stmt);
+void Compiler::compileStructDeclaration(AstStatement *stmt) {
+    AstStructDec *sd = static_cast<AstStructDec *>(stmt);
     StructType *type1 = structTable[sd->struct_name];
     PointerType *type = PointerType::getUnqual(type1);
     
-    AllocaInst *var = builder->CreateAlloca(type);
-    symtable[sd->var_name] = var;
-    typeTable[sd->var_name] = AstBuilder::buildStructType(sd->struct_name);
-    structVarTable[sd->var_name] = sd->struct_name;
+    AllocaInst *var = createEntryAlloca(type);
+    symtable[sd->var_id] = var;
+    typeTable[sd->var_id] = AstBuilder::buildStructType(sd->struct_name);
+    structVarTable[sd->var_id] = sd->struct_name;
     
     // Find the corresponding AST structure
-    std::shared_ptr<AstStruct> str = nullptr;
+    AstStruct *str = nullptr;
     for (auto const &s : tree->structs) {
         if (s->name == sd->struct_name) {
             str = s;
@@ -30,17 +30,23 @@ void Compiler::compileStructDeclaration(std::shared_ptr<AstStatement> stmt) {
     }
     if (str == nullptr) return;
     
-    // Create a malloc call
-    std::vector<Value *> args;
-    args.push_back(builder->getInt32(str->size));
-    
-    std::string malloc_call = "malloc";
-    if (cflags.use_memgc) malloc_call = "gc_alloc";
-    
-    Function *callee = mod->getFunction(malloc_call);
-    if (!callee) std::cerr << "Unable to allocate structure." << std::endl;
-    Value *ptr = builder->CreateCall(callee, args);
-    builder->CreateStore(ptr, var);
+    // Structures that don't escape live in the frame. Otherwise, create a
+    // malloc call
+    Value *ptr = nullptr;
+    if (sd->on_stack) {
+        ptr = createEntryAlloca(type1);
+    } else {
+        std::vector<Value *> args;
+        args.push_back(builder->getInt32(str->size));
+        
+        std::string malloc_call = "malloc";
+        if (cflags.use_memgc) malloc_call = "gc_alloc";
+        
+        Function *callee = mod->getFunction(malloc_call);
+        if (!callee) std::cerr << "Unable to allocate structure." << std::endl;
+        ptr = builder->CreateCall(callee, args);
+    }
+    createStore(ptr, var);
     
     // Init the elements
     if (!sd->no_init) {
@@ -48,11 +54,11 @@ void Compiler::compileStructDeclaration(std::shared_ptr<AstStatement> stmt) {
         ptr = builder->CreateLoad(type, var);
         
         for (Var member : str->items) {
-            std::shared_ptr<AstExpression> defaultExpr = str->default_expressions[member.name];
+            AstExpression *defaultExpr = str->default_expressions[member.name];
             Value *defaultVal = compileValue(defaultExpr);
             
             Value *ep = builder->CreateStructGEP(type1, ptr, index);
-            builder->CreateStore(defaultVal, ep);
+            createStore(defaultVal, ep, isUnsigned(defaultExpr));
             
             ++index;
        }
@@ -60,12 +66,12 @@ void Compiler::compileStructDeclaration(std::shared_ptr<AstStatement> stmt) {
 }
 
 // Compiles a structure access expression
-Value *Compiler::compileStructAccess(std::shared_ptr<AstExpression> expr, bool isAssign) {
-    std::shared_ptr<AstStructAccess> sa = std::static_pointer_cast<AstStructAccess>(expr);
-    Value *ptr = symtable[sa->var];
-    int pos = getStructIndex(sa->var, sa->member);
+Value *Compiler::compileStructAccess(AstExpression *expr, bool isAssign) {
+    AstStructAccess *sa = static_cast<AstStructAccess *>(expr);
+    Value *ptr = symtable[sa->var_id];
+    int pos = getStructIndex(sa->var_id, sa->member);
     
-    std::string strTypeName = structVarTable[sa->var];
+    std::string strTypeName = structVarTable[sa->var_id];
     StructType *strType = structTable[strTypeName];
     Type *elementType = structElementTypeTable[strTypeName][pos];
     
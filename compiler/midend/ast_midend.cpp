@@ -13,10 +13,11 @@ AstMidend::AstMidend(std::shared_ptr<AstTree> tree) {
 // Called to run any midend
 //
 void AstMidend::run() {
+    AstArena::Scope scope(tree->arena);
     it_process_block(tree->block);
 }
 
-void AstMidend::it_process_block(std::shared_ptr<AstBlock> block) {
+void AstMidend::it_process_block(AstBlock *block) {
     // Call the public function
     process_block(block);
 
@@ -27,19 +28,19 @@ void AstMidend::it_process_block(std::shared_ptr<AstBlock> block) {
     }
 }
 
-void AstMidend::it_process_statement(std::shared_ptr<AstStatement> stmt, std::shared_ptr<AstBlock> block, int pos) {
+void AstMidend::it_process_statement(AstStatement *stmt, AstBlock *block, int pos) {
     // Call the public function
     process_statement(stmt, block);
     
     // Continue processing, and call all public functions
     switch (stmt->type) {
         case V_AstType::ExternFunc: {
-            auto stmt2 = std::static_pointer_cast<AstExternFunction>(stmt);
+            auto stmt2 = static_cast<AstExternFunction *>(stmt);
             process_extern_function(stmt2, block);
         } break;
         
         case V_AstType::Func: {
-            auto stmt2 = std::static_pointer_cast<AstFunction>(stmt);
+            auto stmt2 = static_cast<AstFunction *>(stmt);
             process_function(stmt2, block);
             
             // Internal processing
@@ -48,39 +49,39 @@ void AstMidend::it_process_statement(std::shared_ptr<AstStatement> stmt, std::sh
         } break;
         
         case V_AstType::BlockStmt: {
-            auto stmt2 = std::static_pointer_cast<AstBlockStmt>(stmt);
+            auto stmt2 = static_cast<AstBlockStmt *>(stmt);
             process_block_statement(stmt2, block, pos);
             
             it_process_block(stmt2->block);
         } break;
         
         case V_AstType::Return: {
-            auto stmt2 = std::static_pointer_cast<AstReturnStmt>(stmt);
+            auto stmt2 = static_cast<AstReturnStmt *>(stmt);
             process_return(stmt2, block);
         } break;
         
         case V_AstType::ExprStmt: {
-            auto stmt2 = std::static_pointer_cast<AstExprStatement>(stmt);
+            auto stmt2 = static_cast<AstExprStatement *>(stmt);
             process_expr_statement(stmt2, block);
         } break;
         
         case V_AstType::FuncCallStmt: {
-            auto stmt2 = std::static_pointer_cast<AstFuncCallStmt>(stmt);
+            auto stmt2 = static_cast<AstFuncCallStmt *>(stmt);
             process_function_call(stmt2, block);
         } break;
         
         case V_AstType::VarDec: {
-            auto stmt2 = std::static_pointer_cast<AstVarDec>(stmt);
+            auto stmt2 = static_cast<AstVarDec *>(stmt);
             process_var_decl(stmt2, block);
         } break;
         
         case V_AstType::StructDec: {
-            auto stmt2 = std::static_pointer_cast<AstStructDec>(stmt);
+            auto stmt2 = static_cast<AstStructDec *>(stmt);
             process_struct_decl(stmt2, block);
         } break;
         
         case V_AstType::If: {
-            auto stmt2 = std::static_pointer_cast<AstIfStmt>(stmt);
+            auto stmt2 = static_cast<AstIfStmt *>(stmt);
             process_conditional(stmt2, block);
             
             it_process_block(stmt2->true_block);
@@ -88,21 +89,21 @@ void AstMidend::it_process_statement(std::shared_ptr<AstStatement> stmt, std::sh
         } break;
         
         case V_AstType::While: {
-            auto stmt2 = std::static_pointer_cast<AstWhileStmt>(stmt);
+            auto stmt2 = static_cast<AstWhileStmt *>(stmt);
             process_while(stmt2, block);
             
             it_process_block(stmt2->block);
         } break;
         
         case V_AstType::Repeat: {
-            auto stmt2 = std::static_pointer_cast<AstRepeatStmt>(stmt);
+            auto stmt2 = static_cast<AstRepeatStmt *>(stmt);
             process_repeat(stmt2, block);
             
             it_process_block(stmt2->block);
         } break;
         
         case V_AstType::For: {
-            auto stmt2 = std::static_pointer_cast<AstForStmt>(stmt);
+            auto stmt2 = static_cast<AstForStmt *>(stmt);
             process_for(stmt2, block);
             
             //it_process_expression(stmt2->index, block);
@@ -114,7 +115,7 @@ void AstMidend::it_process_statement(std::shared_ptr<AstStatement> stmt, std::sh
         } break;
         
         case V_AstType::ForAll: {
-            auto stmt2 = std::static_pointer_cast<AstForAllStmt>(stmt);
+            auto stmt2 = static_cast<AstForAllStmt *>(stmt);
             process_forall(stmt2, block);
             
             //it_process_expression(stmt2->index, block);
@@ -124,12 +125,12 @@ void AstMidend::it_process_statement(std::shared_ptr<AstStatement> stmt, std::sh
         } break;
         
         case V_AstType::Break: {
-            auto stmt2 = std::static_pointer_cast<AstBreak>(stmt);
+            auto stmt2 = static_cast<AstBreak *>(stmt);
             process_break(stmt2, block);
         } break;
         
         case V_AstType::Continue: {
-            auto stmt2 = std::static_pointer_cast<AstContinue>(stmt);
+            auto stmt2 = static_cast<AstContinue *>(stmt);
             process_continue(stmt2, block);
         } break;
         
@@ -143,7 +144,7 @@ void AstMidend::it_process_statement(std::shared_ptr<AstStatement> stmt, std::sh
     }
 }
 
-void AstMidend::it_process_expression(std::shared_ptr<AstExpression> &expr, std::shared_ptr<AstBlock> block) {
+void AstMidend::it_process_expression(AstExpression *&expr, AstBlock *block) {
     if (expr == nullptr) return;
 
     // Call the public function
@@ -173,53 +174,53 @@ void AstMidend::it_process_expression(std::shared_ptr<AstExpression> &expr, std:
         case V_AstType::LTE:
         case V_AstType::LogicalAnd:
         case V_AstType::LogicalOr: {
-            auto binary_op = std::static_pointer_cast<AstBinaryOp>(expr);
+            auto binary_op = static_cast<AstBinaryOp *>(expr);
             it_process_expression(binary_op->lval, block);
             it_process_expression(binary_op->rval, block);
-            std::shared_ptr<AstExpression> expr2 = process_binary_op(binary_op, block);
+            AstExpression *expr2 = process_binary_op(binary_op, block);
             if (expr2) {
                 expr = expr2;
                 return;
             }
             
             if (expr->type == V_AstType::Assign)
-                expr2 = process_assign_op(std::static_pointer_cast<AstAssignOp>(expr), block);
+                expr2 = process_assign_op(static_cast<AstAssignOp *>(expr), block);
             else if (expr->type == V_AstType::Add)
-                expr2 = process_add_op(std::static_pointer_cast<AstAddOp>(expr), block);
+                expr2 = process_add_op(static_cast<AstAddOp *>(expr), block);
             else if (expr->type == V_AstType::Sub)
-                expr2 = process_sub_op(std::static_pointer_cast<AstSubOp>(expr), block);
+                expr2 = process_sub_op(static_cast<AstSubOp *>(expr), block);
             else if (expr->type == V_AstType::Mul)
-                expr2 = process_mul_op(std::static_pointer_cast<AstMulOp>(expr), block);
+                expr2 = process_mul_op(static_cast<AstMulOp *>(expr), block);
             else if (expr->type == V_AstType::Div)
-                expr2 = process_div_op(std::static_pointer_cast<AstDivOp>(expr), block);
+                expr2 = process_div_op(static_cast<AstDivOp *>(expr), block);
             else if (expr->type == V_AstType::Mod)
-                expr2 = process_mod_op(std::static_pointer_cast<AstModOp>(expr), block);
+                expr2 = process_mod_op(static_cast<AstModOp *>(expr), block);
             else if (expr->type == V_AstType::And)
-                expr2 = process_and_op(std::static_pointer_cast<AstAndOp>(expr), block);
+                expr2 = process_and_op(static_cast<AstAndOp *>(expr), block);
             else if (expr->type == V_AstType::Or)
-                expr2 = process_or_op(std::static_pointer_cast<AstOrOp>(expr), block);
+                expr2 = process_or_op(static_cast<AstOrOp *>(expr), block);
             else if (expr->type == V_AstType::Xor)
-                expr2 = process_xor_op(std::static_pointer_cast<AstXorOp>(expr), block);
+                expr2 = process_xor_op(static_cast<AstXorOp *>(expr), block);
             else if (expr->type == V_AstType::Lsh)
-                expr2 = process_lsh_op(std::static_pointer_cast<AstLshOp>(expr), block);
+                expr2 = process_lsh_op(static_cast<AstLshOp *>(expr), block);
             else if (expr->type == V_AstType::Rsh)
-                expr2 = process_rsh_op(std::static_pointer_cast<AstRshOp>(expr), block);
+                expr2 = process_rsh_op(static_cast<AstRshOp *>(expr), block);
             else if (expr->type == V_AstType::EQ)
-                expr2 = process_eq_op(std::static_pointer_cast<AstEQOp>(expr), block);
+                expr2 = process_eq_op(static_cast<AstEQOp *>(expr), block);
             else if (expr->type == V_AstType::NEQ)
-                expr2 = process_neq_op(std::static_pointer_cast<AstNEQOp>(expr), block);
+                expr2 = process_neq_op(static_cast<AstNEQOp *>(expr), block);
             else if (expr->type == V_AstType::GT)
-                expr2 = process_gt_op(std::static_pointer_cast<AstGTOp>(expr), block);
+                expr2 = process_gt_op(static_cast<AstGTOp *>(expr), block);
             else if (expr->type == V_AstType::LT)
-                expr2 = process_lt_op(std::static_pointer_cast<AstLTOp>(expr), block);
+                expr2 = process_lt_op(static_cast<AstLTOp *>(expr), block);
             else if (expr->type == V_AstType::GTE)
-                expr2 = process_gte_op(std::static_pointer_cast<AstGTEOp>(expr), block);
+                expr2 = process_gte_op(static_cast<AstGTEOp *>(expr), block);
             else if (expr->type == V_AstType::LTE)
-                expr2 = process_lte_op(std::static_pointer_cast<AstLTEOp>(expr), block);
+                expr2 = process_lte_op(static_cast<AstLTEOp *>(expr), block);
             else if (expr->type == V_AstType::LogicalAnd)
-                expr2 = process_logical_and_op(std::static_pointer_cast<AstLogicalAndOp>(expr), block);
+                expr2 = process_logical_and_op(static_cast<AstLogicalAndOp *>(expr), block);
             else if (expr->type == V_AstType::LogicalOr)
-                expr2 = process_logical_or_op(std::static_pointer_cast<AstLogicalOrOp>(expr), block);
+                expr2 = process_logical_or_op(static_cast<AstLogicalOrOp *>(expr), block);
             
             if (expr2) {
                 expr = expr2;
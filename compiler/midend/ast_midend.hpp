@@ -20,59 +20,59 @@ public:
     // Public-facing processing statements
     //
     // Blocks
-    virtual void process_block(std::shared_ptr<AstBlock> block) {}
+    virtual void process_block(AstBlock *block) {}
     
     // Statements
-    virtual void process_statement(std::shared_ptr<AstStatement> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_block_statement(std::shared_ptr<AstBlockStmt> stmt, std::shared_ptr<AstBlock> block, int pos) {}
-    virtual void process_extern_function(std::shared_ptr<AstExternFunction> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_function(std::shared_ptr<AstFunction> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_expr_statement(std::shared_ptr<AstExprStatement> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_function_call(std::shared_ptr<AstFuncCallStmt> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_return(std::shared_ptr<AstReturnStmt> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_var_decl(std::shared_ptr<AstVarDec> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_struct_decl(std::shared_ptr<AstStructDec> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_conditional(std::shared_ptr<AstIfStmt> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_while(std::shared_ptr<AstWhileStmt> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_repeat(std::shared_ptr<AstRepeatStmt> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_for(std::shared_ptr<AstForStmt> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_forall(std::shared_ptr<AstForAllStmt> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_break(std::shared_ptr<AstBreak> stmt, std::shared_ptr<AstBlock> block) {}
-    virtual void process_continue(std::shared_ptr<AstContinue> stmt, std::shared_ptr<AstBlock> block) {}
+    virtual void process_statement(AstStatement *stmt, AstBlock *block) {}
+    virtual void process_block_statement(AstBlockStmt *stmt, AstBlock *block, int pos) {}
+    virtual void process_extern_function(AstExternFunction *stmt, AstBlock *block) {}
+    virtual void process_function(AstFunction *stmt, AstBlock *block) {}
+    virtual void process_expr_statement(AstExprStatement *stmt, AstBlock *block) {}
+    virtual void process_function_call(AstFuncCallStmt *stmt, AstBlock *block) {}
+    virtual void process_return(AstReturnStmt *stmt, AstBlock *block) {}
+    virtual void process_var_decl(AstVarDec *stmt, AstBlock *block) {}
+    virtual void process_struct_decl(AstStructDec *stmt, AstBlock *block) {}
+    virtual void process_conditional(AstIfStmt *stmt, AstBlock *block) {}
+    virtual void process_while(AstWhileStmt *stmt, AstBlock *block) {}
+    virtual void process_repeat(AstRepeatStmt *stmt, AstBlock *block) {}
+    virtual void process_for(AstForStmt *stmt, AstBlock *block) {}
+    virtual void process_forall(AstForAllStmt *stmt, AstBlock *block) {}
+    virtual void process_break(AstBreak *stmt, AstBlock *block) {}
+    virtual void process_continue(AstContinue *stmt, AstBlock *block) {}
     
     // Expressions
-    virtual std::shared_ptr<AstExpression> process_expression(std::shared_ptr<AstExpression> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_expression_list(std::shared_ptr<AstExprList> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_op(std::shared_ptr<AstOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_unary_op(std::shared_ptr<AstUnaryOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_neg_op(std::shared_ptr<AstNegOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_binary_op(std::shared_ptr<AstBinaryOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_assign_op(std::shared_ptr<AstAssignOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_add_op(std::shared_ptr<AstAddOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_sub_op(std::shared_ptr<AstSubOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_mul_op(std::shared_ptr<AstMulOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_div_op(std::shared_ptr<AstDivOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_mod_op(std::shared_ptr<AstModOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_and_op(std::shared_ptr<AstAndOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_or_op(std::shared_ptr<AstOrOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_xor_op(std::shared_ptr<AstXorOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_lsh_op(std::shared_ptr<AstLshOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_rsh_op(std::shared_ptr<AstRshOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_eq_op(std::shared_ptr<AstEQOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_neq_op(std::shared_ptr<AstNEQOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_gt_op(std::shared_ptr<AstGTOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_lt_op(std::shared_ptr<AstLTOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_gte_op(std::shared_ptr<AstGTEOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_lte_op(std::shared_ptr<AstLTEOp> expr, std::shared_ptr<AstBlock> block) { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_logical_and_op(std::shared_ptr<AstLogicalAndOp> expr, std::shared_ptr<AstBlock> block)
+    virtual AstExpression *process_expression(AstExpression *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_expression_list(AstExprList *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_op(AstOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_unary_op(AstUnaryOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_neg_op(AstNegOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_binary_op(AstBinaryOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_assign_op(AstAssignOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_add_op(AstAddOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_sub_op(AstSubOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_mul_op(AstMulOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_div_op(AstDivOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_mod_op(AstModOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_and_op(AstAndOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_or_op(AstOrOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_xor_op(AstXorOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_lsh_op(AstLshOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_rsh_op(AstRshOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_eq_op(AstEQOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_neq_op(AstNEQOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_gt_op(AstGTOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_lt_op(AstLTOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_gte_op(AstGTEOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_lte_op(AstLTEOp *expr, AstBlock *block) { return nullptr; }
+    virtual AstExpression *process_logical_and_op(AstLogicalAndOp *expr, AstBlock *block)
         { return nullptr; }
-    virtual std::shared_ptr<AstExpression> process_logical_or_op(std::shared_ptr<AstLogicalOrOp> expr, std::shared_ptr<AstBlock> block)
+    virtual AstExpression *process_logical_or_op(AstLogicalOrOp *expr, AstBlock *block)
         { return nullptr; }
     // TODO: Finish
 private:
     // Functions
-    void it_process_block(std::shared_ptr<AstBlock> block);
-    void it_process_statement(std::shared_ptr<AstStatement> stmt, std::shared_ptr<AstBlock> block, int pos);
-    void it_process_expression(std::shared_ptr<AstExpression> &expr, std::shared_ptr<AstBlock> block);
+    void it_process_block(AstBlock *block);
+    void it_process_statement(AstStatement *stmt, AstBlock *block, int pos);
+    void it_process_expression(AstExpression *&expr, AstBlock *block);
 };
 
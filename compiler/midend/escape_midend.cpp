@@ -0,0 +1,95 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#include "escape_midend.hpp"
+
+void EscapeMidend::run() {
+    AstMidend::run();
+    finish_function();
+}
+
+void EscapeMidend::process_statement(AstStatement *stmt, AstBlock *block) {
+    find_escapes(stmt->expression);
+}
+
+//
+// Functions can't be nested, so a new one means the last one is done
+//
+void EscapeMidend::process_function(AstFunction *stmt, AstBlock *block) {
+    finish_function();
+}
+
+void EscapeMidend::process_struct_decl(AstStructDec *stmt, AstBlock *block) {
+    decs.push_back(stmt);
+}
+
+void EscapeMidend::process_for(AstForStmt *stmt, AstBlock *block) {
+    find_escapes(stmt->start);
+    find_escapes(stmt->end);
+    find_escapes(stmt->step);
+}
+
+//
+// Marks the declarations of the function that didn't escape
+// Variables are matched by name, so if a function declares the same name
+// twice and either one escapes, both stay on the heap.
+//
+void EscapeMidend::finish_function() {
+    for (auto dec : decs) {
+        if (escaped.find(dec->var_id) == escaped.end()) dec->on_stack = true;
+    }
+    
+    decs.clear();
+    escaped.clear();
+}
+
+void EscapeMidend::find_escapes(AstExpression *expr) {
+    if (expr == nullptr) return;
+    
+    switch (expr->type) {
+        // Any bare use of the variable gives away its address
+        case V_AstType::ID: escaped.insert(static_cast<AstID *>(expr)->id); break;
+        case V_AstType::Ref: escaped.insert(static_cast<AstRef *>(expr)->id); break;
+        case V_AstType::PtrTo: escaped.insert(static_cast<AstPtrTo *>(expr)->id); break;
+        
+        // Accesses only load from or store to the structure itself
+        case V_AstType::ArrayAccess: find_escapes(static_cast<AstArrayAccess *>(expr)->index); break;
+        case V_AstType::StructAccess: find_escapes(static_cast<AstStructAccess *>(expr)->access_expression); break;
+        case V_AstType::Sizeof: break;
+        
+        case V_AstType::ExprList: {
+            for (auto item : static_cast<AstExprList *>(expr)->list) find_escapes(item);
+        } break;
+        
+        case V_AstType::FuncCallExpr: find_escapes(static_cast<AstFuncCallExpr *>(expr)->args); break;
+        case V_AstType::Neg: find_escapes(static_cast<AstUnaryOp *>(expr)->value); break;
+        
+        case V_AstType::Assign:
+        case V_AstType::Add:
+        case V_AstType::Sub:
+        case V_AstType::Mul:
+        case V_AstType::Div:
+        case V_AstType::Mod:
+        case V_AstType::And:
+        case V_AstType::Or:
+        case V_AstType::Xor:
+        case V_AstType::Lsh:
+        case V_AstType::Rsh:
+        case V_AstType::EQ:
+        case V_AstType::NEQ:
+        case V_AstType::GT:
+        case V_AstType::LT:
+        case V_AstType::GTE:
+        case V_AstType::LTE:
+        case V_AstType::LogicalAnd:
+        case V_AstType::LogicalOr: {
+            auto op = static_cast<AstBinaryOp *>(expr);
+            find_escapes(op->lval);
+            find_escapes(op->rval);
+        } break;
+        
+        default: {}
+    }
+}
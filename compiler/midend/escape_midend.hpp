@@ -0,0 +1,38 @@
+//
+// This software is licensed under BSD0 (public domain).
+// Therefore, this software belongs to humanity.
+// See COPYING for more info.
+//
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <set>
+
+#include <ast/ast.hpp>
+#include <midend/ast_midend.hpp>
+
+//
+// Finds the structure declarations that never leave their function
+// A structure escapes if its variable is used anywhere other than to access
+// one of its members or elements- that is, if it is returned, assigned, or
+// passed to a function (which includes class constructors and methods). The
+// ones that don't escape are marked so the backend can put them on the stack.
+//
+class EscapeMidend : public AstMidend {
+public:
+    explicit EscapeMidend(std::shared_ptr<AstTree> tree) : AstMidend(tree) {}
+    void run();
+    
+    void process_statement(AstStatement *stmt, AstBlock *block) override;
+    void process_function(AstFunction *stmt, AstBlock *block) override;
+    void process_struct_decl(AstStructDec *stmt, AstBlock *block) override;
+    void process_for(AstForStmt *stmt, AstBlock *block) override;
+private:
+    // The declarations and escaping variables of the current function
+    std::vector<AstStructDec *> decs;
+    std::set<SymbolId> escaped;
+    
+    void finish_function();
+    void find_escapes(AstExpression *expr);
+};
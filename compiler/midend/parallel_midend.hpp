@@ -16,9 +16,10 @@ public:
 private:
     std::shared_ptr<AstTree> parse_tree;
     int index = 0;
+    int outlined_count = 0;
     
-    void it_process_block(std::shared_ptr<AstBlock> &block, std::shared_ptr<AstBlock> &new_block);
-    void process_block_statement(std::shared_ptr<AstBlockStmt> &stmt, std::shared_ptr<AstBlock> &block);
-    void build_omp_parallel_for(std::shared_ptr<AstFunction> func, std::shared_ptr<AstStatement> first);
+    void it_process_block(AstBlock *&block, AstBlock *&new_block);
+    void process_block_statement(AstBlockStmt *&stmt, AstBlock *&block);
+    void build_omp_parallel_for(AstFunction *func, AstStatement *first);
 };
 
@@ -1,12 +1,21 @@
 #pragma once
 
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+#include <ast/symbol.hpp>
+
 struct BaseLex {
+    virtual ~BaseLex() {}
     virtual void unget(int t) {}
     virtual int get_next() { return 0; }
     virtual void debug_token(int t) {}
     
-    std::string value = "";
-    int i_value = 0;
+    std::string_view value;     // Points into the source, valid until the next token
+    SymbolId id = 0;            // Set for identifiers
+    uint64_t i_value = 0;
+    bool i_overflow = false;    // Set when an integer literal doesn't fit in 64 bits
     double f_value = 0.0;
     int line_number = 0;
 };
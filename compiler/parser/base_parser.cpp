@@ -9,35 +9,38 @@
 
 //
 // Basic initialisation for the parser
+// A parser for an import is given the arena of the file importing it, since
+// its nodes get moved over into that file's tree.
 //
-BaseParser::BaseParser(std::string input) {
+BaseParser::BaseParser(std::string input, std::shared_ptr<AstArena> arena) {
     this->input = input;
-    this->tree = std::make_shared<AstTree>(input);
+    this->tree = std::make_shared<AstTree>(input, arena);
     this->syntax = std::make_shared<ErrorManager>();
+    this->arenaScope = std::make_unique<AstArena::Scope>(tree->arena);
 }
 
 // This is meant mainly for literals; it checks to make sure all the types in
 // the expression agree in type. LLVM will have a problem if not
-std::shared_ptr<AstExpression> BaseParser::checkExpression(std::shared_ptr<AstExpression> expr, std::shared_ptr<AstDataType> varType) {
+AstExpression *BaseParser::checkExpression(AstExpression *expr, AstDataType *varType) {
     if (!varType) return expr;
 
     switch (expr->type) {
         case V_AstType::IntL: {
             // Change to byte literals
             if (varType->type == V_AstType::Int8) {
-                std::shared_ptr<AstInt> i32 = std::static_pointer_cast<AstInt>(expr);
+                AstInt *i32 = static_cast<AstInt *>(expr);
                 i32->size = 8;
                 expr = i32;
                 
             // Change to word literals
             } else if (varType->type == V_AstType::Int16) {
-                std::shared_ptr<AstInt> i32 = std::static_pointer_cast<AstInt>(expr);
+                AstInt *i32 = static_cast<AstInt *>(expr);
                 i32->size = 16;
                 expr = i32;
                 
             // Change to qword literals
             } else if (varType->type == V_AstType::Int64) {
-                std::shared_ptr<AstInt> i32 = std::static_pointer_cast<AstInt>(expr);
+                AstInt *i32 = static_cast<AstInt *>(expr);
                 i32->size = 64;
                 expr = i32;
             }
@@ -55,17 +58,17 @@ bool BaseParser::applyHigherPred(std::shared_ptr<ExprContext> ctx) {
         syntax->addError(0, "Invalid expression: No RVAL");
         return false;
     }
-    std::shared_ptr<AstExpression> rval = checkExpression(ctx->output.top(), ctx->varType);
+    AstExpression *rval = checkExpression(ctx->output.top(), ctx->varType);
     ctx->output.pop();
     
     if (ctx->output.empty()) {
         syntax->addError(0, "Invalid expression: No LVAL");
         return false;
     }
-    std::shared_ptr<AstExpression> lval = checkExpression(ctx->output.top(), ctx->varType);
+    AstExpression *lval = checkExpression(ctx->output.top(), ctx->varType);
     ctx->output.pop();
     
-    std::shared_ptr<AstBinaryOp> op = std::static_pointer_cast<AstBinaryOp>(ctx->opStack.top());
+    AstBinaryOp *op = static_cast<AstBinaryOp *>(ctx->opStack.top());
     ctx->opStack.pop();
     
     op->lval = lval;
@@ -83,21 +86,21 @@ bool BaseParser::applyAssoc(std::shared_ptr<ExprContext> ctx) {
             syntax->addError(0, "Invalid expression: No RVAL");
             return false;
         }
-        std::shared_ptr<AstExpression> rval = checkExpression(ctx->output.top(), ctx->varType);
+        AstExpression *rval = checkExpression(ctx->output.top(), ctx->varType);
         ctx->output.pop();
         
         if (ctx->output.empty()) {
             syntax->addError(0, "Invalid expression: No LVAL");
             return false;
         }
-        std::shared_ptr<AstExpression> lval = checkExpression(ctx->output.top(), ctx->varType);
+        AstExpression *lval = checkExpression(ctx->output.top(), ctx->varType);
         ctx->output.pop();
         
-        std::shared_ptr<AstBinaryOp> op = std::static_pointer_cast<AstBinaryOp>(ctx->opStack.top());
+        AstBinaryOp *op = static_cast<AstBinaryOp *>(ctx->opStack.top());
         ctx->opStack.pop();
         
         if (op->type == lastOp) {
-            std::shared_ptr<AstBinaryOp> op2 = std::static_pointer_cast<AstBinaryOp>(rval);
+            AstBinaryOp *op2 = static_cast<AstBinaryOp *>(rval);
             
             rval = op2->rval;
             op2->rval = op2->lval;
@@ -120,12 +123,12 @@ bool BaseParser::applyAssoc(std::shared_ptr<ExprContext> ctx) {
 // Runs post-processing on operators after they are built
 //
 void BaseParser::post_process_operator(std::shared_ptr<ExprContext> ctx,
-                                       std::shared_ptr<AstBinaryOp> op, std::shared_ptr<AstUnaryOp> op1,
+                                       AstBinaryOp *op, AstUnaryOp *op1,
                                        bool is_unary) {
     if (ctx->opStack.size() > 0 && is_unary == false) {
-        std::shared_ptr<AstOp> top = ctx->opStack.top();
+        AstOp *top = ctx->opStack.top();
             if (top->is_binary) {
-            std::shared_ptr<AstBinaryOp> op2 = std::static_pointer_cast<AstBinaryOp>(top);
+            AstBinaryOp *op2 = static_cast<AstBinaryOp *>(top);
             if (op->precedence > op2->precedence) {
                 if (!applyHigherPred(ctx)) return;
             }
@@ -139,20 +142,21 @@ void BaseParser::post_process_operator(std::shared_ptr<ExprContext> ctx,
 
 // Our new expression builder
 // This should be universal
-std::shared_ptr<AstExpression> BaseParser::buildExpression(std::shared_ptr<AstBlock> block, std::shared_ptr<AstDataType> currentType,
+AstExpression *BaseParser::buildExpression(AstBlock *block, AstDataType *currentType,
                                                         int stopToken, bool isConst, bool buildList) {
     std::shared_ptr<ExprContext> ctx = std::make_shared<ExprContext>();
     if (currentType) ctx->varType = currentType;
     else ctx->varType = AstBuilder::buildVoidType();
     
-    std::shared_ptr<AstExprList> list = std::make_shared<AstExprList>();
+    AstExprList *list = AstArena::make<AstExprList>();
     bool isList = buildList;
     
     int tk = lex->get_next();
     while (tk != 0 && tk != stopToken) {
         if  (is_constant(tk)) {
             ctx->lastWasOp = false;
-            std::shared_ptr<AstExpression> expr = build_constant(tk);
+            AstExpression *expr = build_constant(tk);
+            if (!expr) return nullptr;
             ctx->output.push(expr);
         } else if (is_id(tk)) {
             if (!build_identifier(block, tk, ctx)) return nullptr;
@@ -161,7 +165,7 @@ std::shared_ptr<AstExpression> BaseParser::buildExpression(std::shared_ptr<AstBl
                 return nullptr;
             }
         } else if (is_sub_expr_start(tk)) {
-            std::shared_ptr<AstExpression> subExpr = buildExpression(block, ctx->varType, get_sub_expr_end(), false, isList);
+            AstExpression *subExpr = buildExpression(block, ctx->varType, get_sub_expr_end(), false, isList);
             if (!subExpr) {
                 return nullptr;
             }
@@ -171,7 +175,7 @@ std::shared_ptr<AstExpression> BaseParser::buildExpression(std::shared_ptr<AstBl
             // Do nothing
         } else if (is_list_delim(tk)) {
             applyAssoc(ctx);
-            std::shared_ptr<AstExpression> expr = checkExpression(ctx->output.top(), ctx->varType);
+            AstExpression *expr = checkExpression(ctx->output.top(), ctx->varType);
             list->add_expression(expr);
             while (ctx->output.size() > 0) ctx->output.pop();
             while (ctx->opStack.size() > 0) ctx->opStack.pop();
@@ -186,10 +190,10 @@ std::shared_ptr<AstExpression> BaseParser::buildExpression(std::shared_ptr<AstBl
         
         if (!ctx->lastWasOp && ctx->opStack.size() > 0) {
             if (ctx->opStack.top()->type == V_AstType::Neg) {
-                std::shared_ptr<AstExpression> val = checkExpression(ctx->output.top(), ctx->varType);
+                AstExpression *val = checkExpression(ctx->output.top(), ctx->varType);
                 ctx->output.pop();
                 
-                std::shared_ptr<AstNegOp> op = std::static_pointer_cast<AstNegOp>(ctx->opStack.top());
+                AstNegOp *op = static_cast<AstNegOp *>(ctx->opStack.top());
                 ctx->opStack.pop();
                 op->value = val;
                 ctx->output.push(op);
@@ -213,7 +217,7 @@ std::shared_ptr<AstExpression> BaseParser::buildExpression(std::shared_ptr<AstBl
     }
     
     // Type check the top
-    std::shared_ptr<AstExpression> expr = checkExpression(ctx->output.top(), ctx->varType);
+    AstExpression *expr = checkExpression(ctx->output.top(), ctx->varType);
     
     if (isList) {
         list->add_expression(expr);
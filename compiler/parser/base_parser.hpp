@@ -13,9 +13,9 @@
 #include <parser/base_lex.hpp>
 
 struct ExprContext {
-    std::stack<std::shared_ptr<AstExpression>> output;
-    std::stack<std::shared_ptr<AstOp>> opStack;
-    std::shared_ptr<AstDataType> varType;
+    std::stack<AstExpression *> output;
+    std::stack<AstOp *> opStack;
+    AstDataType *varType = nullptr;
     bool lastWasOp = true;
 };
 
@@ -24,7 +24,7 @@ struct ExprContext {
 //
 class BaseParser {
 public:
-    explicit BaseParser(std::string input);
+    explicit BaseParser(std::string input, std::shared_ptr<AstArena> arena = nullptr);
     
     virtual bool parse() { return false; }
     
@@ -39,17 +39,17 @@ public:
     virtual int get_sub_expr_end() { return 0; }
     virtual bool is_list_delim(int tk) { return false; }
     virtual bool build_operator(int tk, std::shared_ptr<ExprContext> ctx) { return false; }
-    virtual bool build_identifier(std::shared_ptr<AstBlock> block, int tk, std::shared_ptr<ExprContext> ctx) { return false; }
-    virtual std::shared_ptr<AstExpression> build_constant(int tk) { return nullptr; }
+    virtual bool build_identifier(AstBlock *block, int tk, std::shared_ptr<ExprContext> ctx) { return false; }
+    virtual AstExpression *build_constant(int tk) { return nullptr; }
     virtual bool build_other_token(int tk, bool is_const, std::shared_ptr<ExprContext> ctx) { return false; }
     
     // Expression parsers
-    std::shared_ptr<AstExpression> checkExpression(std::shared_ptr<AstExpression> expr, std::shared_ptr<AstDataType> varType);
+    AstExpression *checkExpression(AstExpression *expr, AstDataType *varType);
     bool applyHigherPred(std::shared_ptr<ExprContext> ctx);
     bool applyAssoc(std::shared_ptr<ExprContext> ctx);
-    void post_process_operator(std::shared_ptr<ExprContext> ctx, std::shared_ptr<AstBinaryOp> op, std::shared_ptr<AstUnaryOp> op1, bool is_unary);
-    std::shared_ptr<AstExpression> buildExpression(
-                        std::shared_ptr<AstBlock> block, std::shared_ptr<AstDataType> currentType,
+    void post_process_operator(std::shared_ptr<ExprContext> ctx, AstBinaryOp *op, AstUnaryOp *op1, bool is_unary);
+    AstExpression *buildExpression(
+                        AstBlock *block, AstDataType *currentType,
                         int stopToken,
                         bool isConst = false, bool buildList = false);
 protected:
@@ -57,5 +57,8 @@ protected:
     std::shared_ptr<AstTree> tree;
     std::shared_ptr<ErrorManager> syntax;
     std::unique_ptr<BaseLex> lex;
+    
+    // New nodes go into the tree's arena for as long as the parser lives
+    std::unique_ptr<AstArena::Scope> arenaScope;
 };
 
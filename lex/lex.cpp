@@ -1,16 +1,54 @@
 #include <iostream>
 #include <cctype>
+#include <charconv>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "lex.hpp"
 
 //
 // Setups the lexical analyzer
+// Regular files are mapped straight into memory. Anything that can't be
+// mapped (such as a pipe) is read into a buffer in one go instead.
 //
 Lex::Lex(std::string input) {
-    reader = std::ifstream(input);
-    if (!reader.is_open()) {
-        // TODO
+    int fd = open(input.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error: Unable to open file: " << input << std::endl;
+        return;
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        void *data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            map = (char *)data;
+            map_size = info.st_size;
+        }
+    }
+    
+    if (map) {
+        pos = map;
+        end = map + map_size;
+    } else {
+        char chunk[8192];
+        ssize_t size;
+        while ((size = read(fd, chunk, sizeof(chunk))) > 0) {
+            contents.append(chunk, size);
+        }
+        
+        pos = contents.data();
+        end = contents.data() + contents.size();
     }
+    
+    close(fd);
+}
+
+Lex::~Lex() {
+    if (map) munmap(map, map_size);
 }
 
 //
@@ -22,6 +60,7 @@ void Lex::unget(int t) {
 
 //
 // Get the next token in the stream
+// Identifiers, keywords, and numbers are views straight into the file.
 //
 int Lex::get_next() {
     if (!token_stack.empty()) {
@@ -30,112 +69,154 @@ int Lex::get_next() {
         return t;
     }
 
-    if (reader.eof()) {
-        return t_eof;
-    }
+    // The start of the token we are in the middle of, if any
+    const char *start = nullptr;
     
-    while (!reader.eof()) {
-        char c = reader.get();
-        if (!reader.eof()) raw_buffer += c;
+    while (true) {
+        const char *current = pos;
+        char c = ' ';
         
-        if (c == '#') {
-            c = reader.get();
-            raw_buffer += c;
-            while (c != '\n' && !reader.eof()) {
-                c = reader.get();
-                raw_buffer += c;
-            }
-            ++line_number;
-        }
+        // The end of the file also ends the last token
+        if (pos < end) c = *pos++;
+        else if (start == nullptr) return t_eof;
         
-        if (c == '\"') {
-            value = "";
-            
-            c = reader.get();
-            raw_buffer += c;
-            while (c != '\"' && !reader.eof()) {
-                if (c == '\\') {
-                    c = reader.get();
-                    if (c == 'n') {
-                        value += '\n';
-                    } else {
-                        value += '\\';
-                        value += c;
-                    }
-                } else {
-                    value += c;
-                }
-                c = reader.get();   
-            }
-            
-            return t_string_literal;
+        // The newline at the end of a comment is counted below
+        if (c == '#') {
+            while (pos < end && *pos != '\n') ++pos;
+            if (pos < end) ++pos;
+            c = '\n';
         }
         
-        if (c == '\'') {
-            c = reader.get();
-            if (c == '\\') {
-                c = reader.get();
-                if (c == 'n') {
-                    c = '\n';
-                }
+        if (c == '\"' || c == '\'') {
+            // A literal ends whatever token came right before it
+            if (start != nullptr) {
+                pos = current;
+                c = ' ';
+            } else if (c == '\"') {
+                return get_string_literal();
+            } else {
+                return get_char_literal();
             }
-            
-            token t = t_char_literal;
-            i_value = (char)c;
-            value = "";
-            value += c;
-            
-            reader.get();
-            return t;
         }
         
-        
-        if (c == ' ' || c == '\n' || is_symbol(c)) {
-            if (c == '\n') ++line_number;
+        if (c == ' ' || c == '\n' || c == '\t' || c == '\r' || is_symbol(c)) {
+            // A token is returned before the newline after it is counted
+            if (c == '\n' && start != nullptr) pos = current;
+            else if (c == '\n') ++line_number;
         
             if (is_symbol(c)) {
                 token sym = get_symbol(c);
-                if (buffer == "") {
+                if (start == nullptr) {
                     return sym;
                 }
                 token_stack.push(sym);
             }
             
-            if (buffer == "") continue;
+            if (start == nullptr) continue;
+            buffer = std::string_view(start, current - start);
             
-            token t = t_none;
-            ///LEX_KEYWORD_CHECK
-            else if (is_integer()) {
+            token t = get_keyword();
+            if (t != t_none) {
+                return t;
+            } else if (is_integer()) {
                 t = t_int_literal;
                 value = buffer;
-                i_value = std::stoi(buffer);
+                i_value = 0;
+                auto result = std::from_chars(buffer.data(), buffer.data() + buffer.size(), i_value);
+                i_overflow = result.ec != std::errc();
             } else if (is_hex()) {
                 t = t_int_literal;
                 value = buffer;
-                i_value = std::stoi(buffer, 0, 16);
+                i_value = 0;
+                auto result = std::from_chars(buffer.data() + 2, buffer.data() + buffer.size(), i_value, 16);
+                i_overflow = result.ec != std::errc();
             } else if (is_float()) {
                 t = t_float_literal;
                 value = buffer;
-                f_value = std::stod(buffer);
+                f_value = 0;
+                std::from_chars(buffer.data(), buffer.data() + buffer.size(), f_value);
             } else {
                 t = t_id;
                 value = buffer;
+                id = Symbol::intern(buffer);
             }
             
-            buffer = "";
             return t;
-        } else {
-            buffer += c;
+        } else if (start == nullptr) {
+            start = current;
         }
     }
     
     return t_eof;
 }
 
-std::string Lex::get_raw_buffer() {
-    std::string ret = raw_buffer;
-    raw_buffer = "";
-    return ret;
+//
+// Scans a string literal; the opening quote has already been read
+// Only literals with escapes need to be copied out of the file.
+//
+token Lex::get_string_literal() {
+    const char *start = pos;
+    while (pos < end && *pos != '\"' && *pos != '\\') ++pos;
+    
+    if (pos >= end || *pos == '\"') {
+        value = std::string_view(start, pos - start);
+        if (pos < end) ++pos;
+        return t_string_literal;
+    }
+    
+    literal.assign(start, pos - start);
+    while (pos < end && *pos != '\"') {
+        char c = *pos++;
+        if (c == '\\' && pos < end) {
+            c = *pos++;
+            if (c == 'n') {
+                literal += '\n';
+            } else {
+                literal += '\\';
+                literal += c;
+            }
+        } else {
+            literal += c;
+        }
+    }
+    
+    if (pos < end) ++pos;
+    value = literal;
+    return t_string_literal;
+}
+
+//
+// Scans a character literal; the opening quote has already been read
+//
+token Lex::get_char_literal() {
+    char c = 0;
+    if (pos < end) c = *pos++;
+    
+    if (c == '\\' && pos < end) {
+        c = *pos++;
+        if (c == 'n') {
+            c = '\n';
+        }
+    }
+    
+    // Skip the closing quote
+    if (pos < end) ++pos;
+    
+    i_value = (char)c;
+    literal = c;
+    value = literal;
+    return t_char_literal;
+}
+
+//
+// Returns the token for a keyword, or t_none if the buffer isn't one
+// The lookup is a switch on the length and then on each character, so it
+// takes the same time no matter how many keywords there are.
+//
+token Lex::get_keyword() {
+    ///LEX_KEYWORD_CHECK
+    
+    return t_none;
 }
 
 bool Lex::is_symbol(char c) {
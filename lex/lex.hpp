@@ -1,7 +1,7 @@
 #pragma once
 
 #include <string>
-#include <fstream>
+#include <string_view>
 #include <stack>
 
 #include <parser/base_lex.hpp>
@@ -29,18 +29,27 @@ enum token {
 //
 struct Lex : BaseLex {
     explicit Lex(std::string input);
+    ~Lex();
     void unget(int t) override;
     int get_next() override;
     void debug_token(int t) override;
-    
-    std::string get_raw_buffer();
 private:
-    std::ifstream reader;
-    std::string buffer = "";
-    std::string raw_buffer = "";
+    // The whole file is mapped into memory (or read in, if it can't be
+    // mapped), and the lexer walks through it with a pointer.
+    char *map = nullptr;
+    size_t map_size = 0;
+    std::string contents = "";
+    const char *pos = nullptr;
+    const char *end = nullptr;
+    
+    std::string_view buffer;
+    std::string literal = "";
     std::stack<token> token_stack;
     
     // Internal functions
+    token get_string_literal();
+    token get_char_literal();
+    token get_keyword();
     bool is_symbol(char c);
     token get_symbol(char c);
     bool is_integer();
@@ -20,15 +20,267 @@ for item in config.symbols:
 
 base_path = sys.argv[1]
 
+##
+## Writes a switch on each character in turn for a group of keywords that
+## all have the same length. Once only one keyword is left, the rest of it
+## is checked with one comparison.
+##
+def write_keyword_trie(writer, words, index, indent):
+	tabs = "\t" * indent
+	if len(words) == 1:
+		name = words[0][0]
+		keyword = words[0][1]
+		if index == len(keyword):
+			writer.write(tabs + "return " + name + ";\n")
+		else:
+			writer.write(tabs + "if (buffer == \"" + keyword + "\") return " + name + ";\n")
+			writer.write(tabs + "return t_none;\n")
+		return
+	
+	groups = dict()
+	for item in words:
+		key = item[1][index]
+		if key in groups:
+			groups[key].append(item)
+		else:
+			groups[key] = [item]
+	
+	writer.write(tabs + "switch (buffer[" + str(index) + "]) {\n")
+	for key in sorted(groups.keys()):
+		writer.write(tabs + "\tcase \'" + key + "\': {\n")
+		write_keyword_trie(writer, groups[key], index + 1, indent + 2)
+		writer.write(tabs + "\t}\n")
+	writer.write(tabs + "\tdefault: return t_none;\n")
+	writer.write(tabs + "}\n")
+
 #copyfile(base_path + "/lex.cpp", "./lex.cpp")
 #copyfile(base_path + "/lex.hpp", "./lex.hpp")
 
+# With --dfa, the scanner is generated as a set of DFA tables instead of
+# being filled into the hand-written template
+dfa_mode = "--dfa" in sys.argv[2:]
+
+##
+## DFA generation
+## The config is turned into a DFA over bytes, which is then minimized and
+## written out as a character class map plus a dense transition table.
+##
+class State:
+	def __init__(self, action = "a_none", token = "t_none"):
+		self.edges = [None] * 256		# None is the dead state
+		self.action = action
+		self.token = token
+	
+	def set(self, chars, target):
+		for c in chars:
+			self.edges[ord(c) if isinstance(c, str) else c] = target
+
+def build_dfa():
+	comment = getattr(config, "comment", "#")
+	whitespace = [ " ", "\t", "\r" ]
+	digits = [ chr(c) for c in range(ord("0"), ord("9") + 1) ]
+	hex_digits = digits + [ chr(c) for c in range(ord("a"), ord("f") + 1) ] + [ chr(c) for c in range(ord("A"), ord("F") + 1) ]
+	
+	# Anything that isn't whitespace, a symbol, or the start of a literal or
+	# comment is part of a word
+	stops = set(whitespace + [ "\n", comment, "\"", "\'" ] + [ sym[1][0] for sym in config.symbols ])
+	word_chars = [ c for c in range(256) if chr(c) not in stops ]
+	
+	states = []
+	def new_state(action = "a_none", token = "t_none"):
+		state = State(action, token)
+		states.append(state)
+		return state
+	
+	start = new_state()
+	
+	# Whitespace, newlines, and comments
+	space = new_state("a_skip")
+	start.set(whitespace, space)
+	space.set(whitespace, space)
+	
+	start.set([ "\n" ], new_state("a_newline"))
+	
+	in_comment = new_state("a_skip")
+	start.set([ comment ], in_comment)
+	in_comment.set(range(256), in_comment)
+	in_comment.set([ "\n" ], None)
+	
+	# String literals; only a closed literal is accepted
+	in_string = new_state()
+	string_escape = new_state()
+	start.set([ "\"" ], in_string)
+	in_string.set(range(256), in_string)
+	in_string.set([ "\\" ], string_escape)
+	in_string.set([ "\"" ], new_state("a_string"))
+	string_escape.set(range(256), in_string)
+	
+	# Character literals: a quote, one character (or an escape), and one more
+	char_start = new_state()
+	char_escape = new_state()
+	char_value = new_state()
+	start.set([ "\'" ], char_start)
+	char_start.set(range(256), char_value)
+	char_start.set([ "\\" ], char_escape)
+	char_escape.set(range(256), char_value)
+	char_value.set(range(256), new_state("a_char"))
+	
+	# Symbols; a prefix that isn't a symbol on its own gives t_none
+	for name, value in config.symbols:
+		state = start
+		for i, c in enumerate(value):
+			target = state.edges[ord(c)]
+			if target == None:
+				target = new_state("a_token") if i == 0 else new_state()
+				state.set([ c ], target)
+			state = target
+		state.action = "a_token"
+		state.token = name
+	
+	# Identifiers
+	identifier = new_state("a_id")
+	identifier.set(word_chars, identifier)
+	
+	def word_state(action = "a_id", token = "t_none"):
+		state = new_state(action, token)
+		state.set(word_chars, identifier)
+		return state
+	
+	# Numbers: decimal, hex, and floats (if a dot can be part of a word)
+	integer = word_state("a_int")
+	zero = word_state("a_int")
+	hex_prefix = word_state()
+	hex_number = word_state("a_hex")
+	
+	start.set([ "0" ], zero)
+	start.set(digits[1:], integer)
+	integer.set(digits, integer)
+	zero.set(digits, integer)
+	zero.set([ "x" ], hex_prefix)
+	hex_prefix.set(hex_digits, hex_number)
+	hex_number.set(hex_digits, hex_number)
+	
+	if ord(".") in word_chars:
+		float_dot = word_state("a_float")
+		float_number = word_state("a_float")
+		integer.set([ "." ], float_dot)
+		zero.set([ "." ], float_dot)
+		float_dot.set(digits, float_number)
+		float_number.set(digits, float_number)
+	
+	# Keywords are a trie on top of the identifier states
+	for c in word_chars:
+		if start.edges[c] == None:
+			start.edges[c] = identifier
+	
+	for name, keyword in keywords:
+		state = start
+		for c in keyword:
+			target = state.edges[ord(c)]
+			if target == None or target == identifier:
+				target = word_state()
+				state.set([ c ], target)
+			state = target
+		state.action = "a_token"
+		state.token = name
+	
+	return states
+
+##
+## Merges equivalent states until there are none left
+## This is Moore's algorithm: states start out split by what they accept,
+## and groups are split until every state in a group goes to the same groups.
+##
+def minimize(states):
+	index = { id(state): i + 1 for i, state in enumerate(states) }
+	rows = [ [ 0 ] * 256 ] + [ [ index[id(t)] if t != None else 0 for t in state.edges ] for state in states ]
+	accepts = [ ("dead", "") ] + [ (state.action, state.token) for state in states ]
+	
+	groups = dict()
+	block = [ groups.setdefault(accept, len(groups)) for accept in accepts ]
+	
+	while True:
+		groups = dict()
+		new_block = []
+		for i in range(len(rows)):
+			key = (block[i], tuple(block[t] for t in rows[i]))
+			new_block.append(groups.setdefault(key, len(groups)))
+		
+		if len(groups) == len(set(block)):
+			break
+		block = new_block
+	
+	# Renumber so the dead state is 0 and the start state is 1
+	order = [ block[0], block[1] ]
+	for b in block:
+		if b not in order:
+			order.append(b)
+	number = { b: i for i, b in enumerate(order) }
+	
+	table = [ None ] * len(order)
+	actions = [ None ] * len(order)
+	for i in range(len(rows)):
+		n = number[block[i]]
+		if table[n] == None:
+			table[n] = [ number[block[t]] for t in rows[i] ]
+			actions[n] = accepts[i] if i != 0 else ("a_none", "t_none")
+	
+	return table, actions
+
+##
+## Groups bytes that every state treats the same way into one class
+##
+def char_classes(table):
+	classes = dict()
+	class_map = []
+	for c in range(256):
+		column = tuple(row[c] for row in table)
+		class_map.append(classes.setdefault(column, len(classes)))
+	
+	class_table = []
+	for row in table:
+		class_row = [ 0 ] * len(classes)
+		for c in range(256):
+			class_row[class_map[c]] = row[c]
+		class_table.append(class_row)
+	
+	return class_map, class_table
+
+def write_dfa_tables(writer):
+	table, actions = minimize(build_dfa())
+	class_map, class_table = char_classes(table)
+	state_type = "uint8_t" if len(table) <= 256 else "uint16_t"
+	
+	writer.write("static constexpr int LEX_STATES = " + str(len(table)) + ";\n")
+	writer.write("static constexpr int LEX_CLASSES = " + str(len(class_table[0])) + ";\n\n")
+	
+	writer.write("static constexpr uint8_t lex_classes[256] = {\n")
+	for i in range(0, 256, 16):
+		writer.write("\t" + ", ".join(str(c) for c in class_map[i:i+16]) + ",\n")
+	writer.write("};\n\n")
+	
+	writer.write("static constexpr " + state_type + " lex_transitions[LEX_STATES][LEX_CLASSES] = {\n")
+	for row in class_table:
+		writer.write("\t{ " + ", ".join(str(t) for t in row) + " },\n")
+	writer.write("};\n\n")
+	
+	writer.write("static constexpr lex_action lex_actions[LEX_STATES] = {\n")
+	for action, token in actions:
+		writer.write("\t" + action + ",\n")
+	writer.write("};\n\n")
+	
+	writer.write("static constexpr token lex_tokens[LEX_STATES] = {\n")
+	for action, token in actions:
+		writer.write("\t" + token + ",\n")
+	writer.write("};\n")
+
 ##
 ## Generate the header file
 ##
 writer = open("./lex.hpp", "w")
+template = "/lex_dfa" if dfa_mode else "/lex"
 
-with open(base_path + "/lex.hpp", "r") as reader:
+with open(base_path + template + ".hpp", "r") as reader:
     for line in reader:
         ln = line.strip()
         
@@ -50,21 +302,31 @@ writer.close()
 ##
 writer = open("./lex.cpp", "w")
 
-with open(base_path + "/lex.cpp", "r") as reader:
+with open(base_path + template + ".cpp", "r") as reader:
     for line in reader:
         ln = line.strip()
         
-        # Keyword if-else block
-        if ln == "///LEX_KEYWORD_CHECK":
-            first = True
+        # DFA tables
+        if ln == "///LEX_DFA_TABLES":
+            write_dfa_tables(writer)
+        
+        # Keyword lookup: switch on the length, and then on each character
+        elif ln == "///LEX_KEYWORD_CHECK":
+            lengths = dict()
             for keyword in keywords:
-                writer.write("\t\t\t")
-                if first:
-                    writer.write("if ")
-                    first = False
+                length = len(keyword[1])
+                if length in lengths:
+                    lengths[length].append(keyword)
                 else:
-                    writer.write("else if ")
-                writer.write("(buffer == \"" + keyword[1] + "\") t = " + keyword[0] + ";\n")
+                    lengths[length] = [keyword]
+            
+            writer.write("\tswitch (buffer.length()) {\n")
+            for length in sorted(lengths.keys()):
+                writer.write("\t\tcase " + str(length) + ": {\n")
+                write_keyword_trie(writer, lengths[length], 0, 3)
+                writer.write("\t\t}\n")
+            writer.write("\t\tdefault: {}\n")
+            writer.write("\t}\n")
         
         # Keyword debug section
         elif ln == "///LEX_KEYWORD_DEBUG":
@@ -88,7 +350,8 @@ with open(base_path + "/lex.cpp", "r") as reader:
                     writer.write("\t\tcase \'" + value + "\': return " + name_list[0][1] + ";\n")
                 else:
                     writer.write("\t\tcase \'" + value + "\': {\n")
-                    writer.write("\t\t\tchar c2 = reader.get();\n")
+                    writer.write("\t\t\tchar c2 = 0;\n")
+                    writer.write("\t\t\tif (pos < end) c2 = *pos;\n")
 
                     found_first = False
                     default_name = None
@@ -105,12 +368,11 @@ with open(base_path + "/lex.cpp", "r") as reader:
                             writer.write("\t\t\t} else ")
                         found_first = True
                         writer.write("\t\t\tif (c2 == \'" + symbol[1] + "\') {\n")
-                        writer.write("\t\t\t\traw_buffer += c2;\n")
+                        writer.write("\t\t\t\t++pos;\n")
                         writer.write("\t\t\t\treturn " + name + ";\n")
                         
                     # Final else statement
                     writer.write("\t\t\t} else {\n")
-                    writer.write("\t\t\t\treader.unget();\n")
                     if default_name != None:
                         writer.write("\t\t\t\treturn " + default_name + ";\n")
                     writer.write("\t\t\t}\n")
@@ -0,0 +1,237 @@
+#include <iostream>
+#include <cstdint>
+#include <charconv>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "lex.hpp"
+
+//
+// What the scanner does when it stops in an accepting state
+//
+enum lex_action : uint8_t {
+    a_none,         // Not an accepting state
+    a_token,        // A keyword or symbol; the token is in lex_tokens
+    a_id,
+    a_int,
+    a_hex,
+    a_float,
+    a_string,
+    a_char,
+    a_skip,         // Whitespace and comments
+    a_newline,
+};
+
+//
+// The DFA tables
+// State 0 is the dead state, and state 1 is where every token starts.
+//
+///LEX_DFA_TABLES
+
+//
+// Setups the lexical analyzer
+// Regular files are mapped straight into memory. Anything that can't be
+// mapped (such as a pipe) is read into a buffer in one go instead.
+//
+Lex::Lex(std::string input) {
+    int fd = open(input.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error: Unable to open file: " << input << std::endl;
+        return;
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        void *data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            map = (char *)data;
+            map_size = info.st_size;
+        }
+    }
+    
+    if (map) {
+        pos = map;
+        end = map + map_size;
+    } else {
+        char chunk[8192];
+        ssize_t size;
+        while ((size = read(fd, chunk, sizeof(chunk))) > 0) {
+            contents.append(chunk, size);
+        }
+        
+        pos = contents.data();
+        end = contents.data() + contents.size();
+    }
+    
+    close(fd);
+}
+
+Lex::~Lex() {
+    if (map) munmap(map, map_size);
+}
+
+//
+// Ungets the token from the stream
+//
+void Lex::unget(int t) {
+    token_stack.push((token)t);
+}
+
+//
+// Get the next token in the stream
+// The scanner follows the DFA for as long as it can, and then backs up to
+// the last accepting state it went through.
+//
+int Lex::get_next() {
+    if (!token_stack.empty()) {
+        auto t = token_stack.top();
+        token_stack.pop();
+        return t;
+    }
+    
+    while (pos < end) {
+        const char *start = pos;
+        const char *current = pos;
+        const char *accept_pos = nullptr;
+        int accept_state = 0;
+        int state = 1;
+        
+        while (current < end) {
+            state = lex_transitions[state][lex_classes[(unsigned char)*current]];
+            if (state == 0) break;
+            ++current;
+            
+            if (lex_actions[state] != a_none) {
+                accept_state = state;
+                accept_pos = current;
+            }
+        }
+        
+        // Nothing matched, so skip over the character
+        if (accept_pos == nullptr) {
+            pos = start + 1;
+            continue;
+        }
+        
+        pos = accept_pos;
+        std::string_view text(start, pos - start);
+        
+        switch (lex_actions[accept_state]) {
+            case a_token: return lex_tokens[accept_state];
+            
+            case a_id: {
+                value = text;
+                id = Symbol::intern(text);
+                return t_id;
+            }
+            
+            case a_int: {
+                value = text;
+                i_value = 0;
+                auto result = std::from_chars(text.data(), text.data() + text.size(), i_value);
+                i_overflow = result.ec != std::errc();
+                return t_int_literal;
+            }
+            
+            case a_hex: {
+                value = text;
+                i_value = 0;
+                auto result = std::from_chars(text.data() + 2, text.data() + text.size(), i_value, 16);
+                i_overflow = result.ec != std::errc();
+                return t_int_literal;
+            }
+            
+            case a_float: {
+                value = text;
+                f_value = 0;
+                std::from_chars(text.data(), text.data() + text.size(), f_value);
+                return t_float_literal;
+            }
+            
+            case a_string: return get_string_literal(text);
+            case a_char: return get_char_literal(text);
+            
+            case a_newline: ++line_number; break;
+            default: {}
+        }
+    }
+    
+    return t_eof;
+}
+
+//
+// Builds the value of a string literal from its text, quotes and all
+// Only literals with escapes need to be copied out of the file.
+//
+token Lex::get_string_literal(std::string_view text) {
+    text.remove_prefix(1);
+    text.remove_suffix(1);
+    
+    if (text.find('\\') == std::string_view::npos) {
+        value = text;
+        return t_string_literal;
+    }
+    
+    literal = "";
+    for (size_t i = 0; i<text.size(); i++) {
+        char c = text[i];
+        if (c == '\\' && i + 1 < text.size()) {
+            c = text[++i];
+            if (c == 'n') {
+                literal += '\n';
+            } else {
+                literal += '\\';
+                literal += c;
+            }
+        } else {
+            literal += c;
+        }
+    }
+    
+    value = literal;
+    return t_string_literal;
+}
+
+//
+// Builds the value of a character literal from its text, quotes and all
+//
+token Lex::get_char_literal(std::string_view text) {
+    char c = text[1];
+    if (c == '\\') {
+        c = text[2];
+        if (c == 'n') {
+            c = '\n';
+        }
+    }
+    
+    i_value = (char)c;
+    literal = c;
+    value = literal;
+    return t_char_literal;
+}
+
+//
+// A debug function for the lexical analyzer
+//
+void Lex::debug_token(int t) {
+    switch (t) {
+        case t_none: std::cout << "???" << std::endl; break;
+        case t_eof: std::cout << "EOF" << std::endl; break;
+        
+        ///LEX_KEYWORD_DEBUG
+        
+        ///LEX_SYMBOL_DEBUG
+        
+        case t_id: std::cout << "ID(" << value << ")" << std::endl; break;
+        case t_string_literal: std::cout << "STR(" << value << ")" << std::endl; break;
+        case t_char_literal: std::cout << "CHAR(" << value << ")" << std::endl; break;
+        case t_int_literal: std::cout << "INT(" << value << ")" << std::endl; break;
+        case t_float_literal: std::cout << "FL(" << value << ")" << std::endl; break;
+        
+        default: {}
+    }
+}
+
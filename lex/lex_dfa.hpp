@@ -0,0 +1,53 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <stack>
+
+#include <parser/base_lex.hpp>
+
+//
+// Represents token data
+//
+enum token {
+    t_eof = 0,
+    t_none,
+    
+    ///LEX_KEYWORDS
+    
+    ///LEX_SYMBOLS
+    
+    t_id,
+    t_int_literal,
+    t_string_literal,
+    t_char_literal,
+    t_float_literal,
+};
+
+//
+// The lexical analyzer
+// This version is driven by the DFA tables that lex.py generates from the
+// language config, so nothing in here is specific to one language.
+//
+struct Lex : BaseLex {
+    explicit Lex(std::string input);
+    ~Lex();
+    void unget(int t) override;
+    int get_next() override;
+    void debug_token(int t) override;
+private:
+    // The whole file is mapped into memory (or read in, if it can't be
+    // mapped), and the lexer walks through it with a pointer.
+    char *map = nullptr;
+    size_t map_size = 0;
+    std::string contents = "";
+    const char *pos = nullptr;
+    const char *end = nullptr;
+    
+    std::string literal = "";
+    std::stack<token> token_stack;
+    
+    // Internal functions
+    token get_string_literal(std::string_view text);
+    token get_char_literal(std::string_view text);
+};
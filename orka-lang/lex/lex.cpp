@@ -1,16 +1,681 @@
 #include <iostream>
-#include <cctype>
+#include <cstdint>
+#include <charconv>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "lex.hpp"
 
+//
+// What the scanner does when it stops in an accepting state
+//
+enum lex_action : uint8_t {
+    a_none,         // Not an accepting state
+    a_token,        // A keyword or symbol; the token is in lex_tokens
+    a_id,
+    a_int,
+    a_hex,
+    a_float,
+    a_string,
+    a_char,
+    a_skip,         // Whitespace and comments
+    a_newline,
+};
+
+//
+// The DFA tables
+// State 0 is the dead state, and state 1 is where every token starts.
+//
+static constexpr int LEX_STATES = 192;
+static constexpr int LEX_CLASSES = 56;
+
+static constexpr uint8_t lex_classes[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 3, 4, 5, 0, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 18, 18, 19, 18, 20, 18, 18, 18, 21, 22, 23, 24, 25, 0,
+	26, 27, 27, 27, 27, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 29, 30, 31, 0,
+	0, 32, 33, 34, 35, 36, 37, 0, 38, 39, 0, 40, 41, 42, 43, 44,
+	45, 0, 46, 47, 48, 49, 50, 51, 52, 53, 54, 0, 55, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static constexpr uint8_t lex_transitions[LEX_STATES][LEX_CLASSES] = {
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 40, 2, 3, 33, 5, 4, 23, 24, 8, 15, 16, 21, 19, 14, 20, 12, 22, 42, 41, 41, 41, 27, 13, 30, 32, 28, 39, 40, 17, 40, 18, 26, 72, 82, 77, 132, 45, 51, 40, 106, 40, 40, 40, 40, 157, 40, 63, 55, 128, 92, 69, 122, 40, 40, 40, 25 },
+	{ 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 },
+	{ 5, 5, 5, 5, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+	{ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10 },
+	{ 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10 },
+	{ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 41, 41, 41, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 41, 41, 41, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 43, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 44, 0, 40, 0, 0, 44, 44, 44, 44, 44, 44, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 44, 44, 44, 0, 0, 0, 0, 0, 0, 44, 0, 40, 0, 0, 44, 44, 44, 44, 44, 44, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 117, 40, 61, 40, 40, 40, 40, 40, 40, 40, 40, 46, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 47, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 48, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 181, 40, 40, 49, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 50, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 151, 40, 40, 40, 40, 40, 40, 40, 40, 184, 40, 40, 164, 40, 40, 40, 40, 52, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 53, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 54, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 97, 159, 40, 40, 40, 40, 40, 40, 40, 40, 56, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 169, 40, 40, 40, 40, 40, 40, 40, 40, 40, 57, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 58, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 59, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 60, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 62, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 175, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 64, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 171, 40, 40, 65, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 66, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 67, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 68, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 70, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 71, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 155, 40, 40, 73, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 74, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 75, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 76, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 86, 40, 40, 177, 40, 40, 78, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 79, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 80, 138, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 83, 40, 134, 40, 40, 40, 40, 40, 40, 89, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 84, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 85, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 87, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 88, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 90, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 91, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 93, 40, 40, 40, 40, 40, 109, 40, 40, 40, 40, 40, 40, 40, 101, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 94, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 95, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 96, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 98, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 99, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 100, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 102, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 103, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 104, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 105, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 116, 40, 40, 40, 40, 143, 107, 40, 40, 40, 127, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 108, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 112, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 110, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 111, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 114, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 113, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 115, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 118, 40, 40, 40, 40, 40, 40, 40, 120, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 119, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 121, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 123, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 124, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 125, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 126, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 129, 40, 40, 40, 40, 40, 40, 40, 148, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 130, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 131, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 133, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 188, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 135, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 136, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 137, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 139, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 140, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 141, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 142, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 144, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 145, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 146, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 147, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 149, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 150, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 152, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 153, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 154, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 156, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 158, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 160, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 161, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 162, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 163, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 165, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 166, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 167, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 168, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 170, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 172, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 173, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 174, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 176, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 178, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 179, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 180, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 182, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 183, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 185, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 186, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 187, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 189, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 190, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 191, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+	{ 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 40, 0, 40, 0, 0, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 0 },
+};
+
+static constexpr lex_action lex_actions[LEX_STATES] = {
+	a_none,
+	a_none,
+	a_skip,
+	a_newline,
+	a_skip,
+	a_none,
+	a_none,
+	a_string,
+	a_none,
+	a_none,
+	a_none,
+	a_char,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_id,
+	a_int,
+	a_int,
+	a_id,
+	a_hex,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+};
+
+static constexpr token lex_tokens[LEX_STATES] = {
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_dot,
+	t_semicolon,
+	t_comma,
+	t_lparen,
+	t_rparen,
+	t_lbracket,
+	t_rbracket,
+	t_plus,
+	t_minus,
+	t_mul,
+	t_div,
+	t_mod,
+	t_and,
+	t_or,
+	t_xor,
+	t_colon,
+	t_gt,
+	t_gte,
+	t_lt,
+	t_lte,
+	t_eq,
+	t_none,
+	t_neq,
+	t_assign,
+	t_arrow,
+	t_range,
+	t_scope,
+	t_annot,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_extern,
+	t_none,
+	t_none,
+	t_none,
+	t_func,
+	t_none,
+	t_none,
+	t_string,
+	t_none,
+	t_none,
+	t_struct,
+	t_none,
+	t_end,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_return,
+	t_none,
+	t_none,
+	t_var,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_array,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_const,
+	t_none,
+	t_none,
+	t_none,
+	t_bool,
+	t_none,
+	t_none,
+	t_char,
+	t_none,
+	t_none,
+	t_i8,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_u8,
+	t_none,
+	t_none,
+	t_none,
+	t_i16,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_u16,
+	t_none,
+	t_in,
+	t_i32,
+	t_none,
+	t_none,
+	t_u32,
+	t_none,
+	t_i64,
+	t_none,
+	t_u64,
+	t_if,
+	t_none,
+	t_none,
+	t_elif,
+	t_none,
+	t_else,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_while,
+	t_is,
+	t_none,
+	t_none,
+	t_none,
+	t_then,
+	t_none,
+	t_do,
+	t_none,
+	t_none,
+	t_none,
+	t_break,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_continue,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_import,
+	t_none,
+	t_none,
+	t_true,
+	t_none,
+	t_none,
+	t_none,
+	t_false,
+	t_none,
+	t_lgand,
+	t_none,
+	t_lgor,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_sizeof,
+	t_none,
+	t_for,
+	t_none,
+	t_none,
+	t_forall,
+	t_none,
+	t_step,
+	t_none,
+	t_none,
+	t_none,
+	t_repeat,
+	t_none,
+	t_enum,
+	t_none,
+	t_none,
+	t_none,
+	t_class,
+	t_none,
+	t_none,
+	t_extends,
+	t_none,
+	t_none,
+	t_none,
+	t_float,
+	t_none,
+	t_none,
+	t_none,
+	t_double,
+};
+
 //
 // Setups the lexical analyzer
+// Regular files are mapped straight into memory. Anything that can't be
+// mapped (such as a pipe) is read into a buffer in one go instead.
 //
 Lex::Lex(std::string input) {
-    reader = std::ifstream(input);
-    if (!reader.is_open()) {
-        // TODO
+    int fd = open(input.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error: Unable to open file: " << input << std::endl;
+        return;
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        void *data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            map = (char *)data;
+            map_size = info.st_size;
+        }
+    }
+    
+    if (map) {
+        pos = map;
+        end = map + map_size;
+    } else {
+        char chunk[8192];
+        ssize_t size;
+        while ((size = read(fd, chunk, sizeof(chunk))) > 0) {
+            contents.append(chunk, size);
+        }
+        
+        pos = contents.data();
+        end = contents.data() + contents.size();
     }
+    
+    close(fd);
+}
+
+Lex::~Lex() {
+    if (map) munmap(map, map_size);
 }
 
 //
@@ -22,6 +687,8 @@ void Lex::unget(int t) {
 
 //
 // Get the next token in the stream
+// The scanner follows the DFA for as long as it can, and then backs up to
+// the last accepting state it went through.
 //
 int Lex::get_next() {
     if (!token_stack.empty()) {
@@ -29,300 +696,126 @@ int Lex::get_next() {
         token_stack.pop();
         return t;
     }
-
-    if (reader.eof()) {
-        return t_eof;
-    }
     
-    while (!reader.eof()) {
-        char c = reader.get();
-        if (!reader.eof()) raw_buffer += c;
+    while (pos < end) {
+        const char *start = pos;
+        const char *current = pos;
+        const char *accept_pos = nullptr;
+        int accept_state = 0;
+        int state = 1;
         
-        if (c == '#') {
-            c = reader.get();
-            raw_buffer += c;
-            while (c != '\n' && !reader.eof()) {
-                c = reader.get();
-                raw_buffer += c;
-            }
-            ++line_number;
-        }
-        
-        if (c == '\"') {
-            value = "";
+        while (current < end) {
+            state = lex_transitions[state][lex_classes[(unsigned char)*current]];
+            if (state == 0) break;
+            ++current;
             
-            c = reader.get();
-            raw_buffer += c;
-            while (c != '\"' && !reader.eof()) {
-                if (c == '\\') {
-                    c = reader.get();
-                    if (c == 'n') {
-                        value += '\n';
-                    } else {
-                        value += '\\';
-                        value += c;
-                    }
-                } else {
-                    value += c;
-                }
-                c = reader.get();   
+            if (lex_actions[state] != a_none) {
+                accept_state = state;
+                accept_pos = current;
             }
-            
-            return t_string_literal;
         }
         
-        if (c == '\'') {
-            c = reader.get();
-            if (c == '\\') {
-                c = reader.get();
-                if (c == 'n') {
-                    c = '\n';
-                }
-            }
-            
-            token t = t_char_literal;
-            i_value = (char)c;
-            value = "";
-            value += c;
-            
-            reader.get();
-            return t;
+        // Nothing matched, so skip over the character
+        if (accept_pos == nullptr) {
+            pos = start + 1;
+            continue;
         }
         
+        pos = accept_pos;
+        std::string_view text(start, pos - start);
         
-        if (c == ' ' || c == '\n' || is_symbol(c)) {
-            if (c == '\n') ++line_number;
-        
-            if (is_symbol(c)) {
-                token sym = get_symbol(c);
-                if (buffer == "") {
-                    return sym;
-                }
-                token_stack.push(sym);
+        switch (lex_actions[accept_state]) {
+            case a_token: return lex_tokens[accept_state];
+            
+            case a_id: {
+                value = text;
+                id = Symbol::intern(text);
+                return t_id;
             }
             
-            if (buffer == "") continue;
+            case a_int: {
+                value = text;
+                i_value = 0;
+                auto result = std::from_chars(text.data(), text.data() + text.size(), i_value);
+                i_overflow = result.ec != std::errc();
+                return t_int_literal;
+            }
             
-            token t = t_none;
-			if (buffer == "extern") t = t_extern;
-			else if (buffer == "func") t = t_func;
-			else if (buffer == "struct") t = t_struct;
-			else if (buffer == "end") t = t_end;
-			else if (buffer == "return") t = t_return;
-			else if (buffer == "var") t = t_var;
-			else if (buffer == "array") t = t_array;
-			else if (buffer == "const") t = t_const;
-			else if (buffer == "bool") t = t_bool;
-			else if (buffer == "char") t = t_char;
-			else if (buffer == "str") t = t_string;
-			else if (buffer == "byte") t = t_i8;
-			else if (buffer == "ubyte") t = t_u8;
-			else if (buffer == "short") t = t_i16;
-			else if (buffer == "ushort") t = t_u16;
-			else if (buffer == "int") t = t_i32;
-			else if (buffer == "uint") t = t_u32;
-			else if (buffer == "int64") t = t_i64;
-			else if (buffer == "uint64") t = t_u64;
-			else if (buffer == "if") t = t_if;
-			else if (buffer == "elif") t = t_elif;
-			else if (buffer == "else") t = t_else;
-			else if (buffer == "while") t = t_while;
-			else if (buffer == "is") t = t_is;
-			else if (buffer == "then") t = t_then;
-			else if (buffer == "do") t = t_do;
-			else if (buffer == "break") t = t_break;
-			else if (buffer == "continue") t = t_continue;
-			else if (buffer == "import") t = t_import;
-			else if (buffer == "true") t = t_true;
-			else if (buffer == "false") t = t_false;
-			else if (buffer == "and") t = t_lgand;
-			else if (buffer == "or") t = t_lgor;
-			else if (buffer == "sizeof") t = t_sizeof;
-			else if (buffer == "for") t = t_for;
-			else if (buffer == "forall") t = t_forall;
-			else if (buffer == "in") t = t_in;
-			else if (buffer == "step") t = t_step;
-			else if (buffer == "repeat") t = t_repeat;
-			else if (buffer == "enum") t = t_enum;
-			else if (buffer == "class") t = t_class;
-			else if (buffer == "extends") t = t_extends;
-			else if (buffer == "float") t = t_float;
-			else if (buffer == "double") t = t_double;
-            else if (is_integer()) {
-                t = t_int_literal;
-                value = buffer;
-                i_value = std::stoi(buffer);
-            } else if (is_hex()) {
-                t = t_int_literal;
-                value = buffer;
-                i_value = std::stoi(buffer, 0, 16);
-            } else if (is_float()) {
-                t = t_float_literal;
-                value = buffer;
-                f_value = std::stod(buffer);
-            } else {
-                t = t_id;
-                value = buffer;
+            case a_hex: {
+                value = text;
+                i_value = 0;
+                auto result = std::from_chars(text.data() + 2, text.data() + text.size(), i_value, 16);
+                i_overflow = result.ec != std::errc();
+                return t_int_literal;
             }
             
-            buffer = "";
-            return t;
-        } else {
-            buffer += c;
+            case a_float: {
+                value = text;
+                f_value = 0;
+                std::from_chars(text.data(), text.data() + text.size(), f_value);
+                return t_float_literal;
+            }
+            
+            case a_string: return get_string_literal(text);
+            case a_char: return get_char_literal(text);
+            
+            case a_newline: ++line_number; break;
+            default: {}
         }
     }
     
     return t_eof;
 }
 
-std::string Lex::get_raw_buffer() {
-    std::string ret = raw_buffer;
-    raw_buffer = "";
-    return ret;
-}
-
-bool Lex::is_symbol(char c) {
-    switch (c) {
-		case '.': return true;
-		case ';': return true;
-		case ',': return true;
-		case '(': return true;
-		case ')': return true;
-		case '[': return true;
-		case ']': return true;
-		case '+': return true;
-		case '-': return true;
-		case '*': return true;
-		case '/': return true;
-		case '%': return true;
-		case '&': return true;
-		case '|': return true;
-		case '^': return true;
-		case ':': return true;
-		case '>': return true;
-		case '<': return true;
-		case '=': return true;
-		case '!': return true;
-		case '@': return true;
-        
-        default: return false;
-    }
-    return false;
-}
-
-token Lex::get_symbol(char c) {
-    switch (c) {
-		case '.': {
-			char c2 = reader.get();
-			if (c2 == '.') {
-				raw_buffer += c2;
-				return t_range;
-			} else {
-				reader.unget();
-				return t_dot;
-			}
-		} break;
-		case ';': return t_semicolon;
-		case ',': return t_comma;
-		case '(': return t_lparen;
-		case ')': return t_rparen;
-		case '[': return t_lbracket;
-		case ']': return t_rbracket;
-		case '+': return t_plus;
-		case '-': {
-			char c2 = reader.get();
-			if (c2 == '>') {
-				raw_buffer += c2;
-				return t_arrow;
-			} else {
-				reader.unget();
-				return t_minus;
-			}
-		} break;
-		case '*': return t_mul;
-		case '/': return t_div;
-		case '%': return t_mod;
-		case '&': return t_and;
-		case '|': return t_or;
-		case '^': return t_xor;
-		case ':': {
-			char c2 = reader.get();
-			if (c2 == '=') {
-				raw_buffer += c2;
-				return t_assign;
-			} else 			if (c2 == ':') {
-				raw_buffer += c2;
-				return t_scope;
-			} else {
-				reader.unget();
-				return t_colon;
-			}
-		} break;
-		case '>': {
-			char c2 = reader.get();
-			if (c2 == '=') {
-				raw_buffer += c2;
-				return t_gte;
-			} else {
-				reader.unget();
-				return t_gt;
-			}
-		} break;
-		case '<': {
-			char c2 = reader.get();
-			if (c2 == '=') {
-				raw_buffer += c2;
-				return t_lte;
-			} else {
-				reader.unget();
-				return t_lt;
-			}
-		} break;
-		case '=': return t_eq;
-		case '!': {
-			char c2 = reader.get();
-			if (c2 == '=') {
-				raw_buffer += c2;
-				return t_neq;
-			} else {
-				reader.unget();
-			}
-		} break;
-		case '@': return t_annot;
-        default: return t_none;
-    }
-    return t_none;
-}
-
-bool Lex::is_integer() {
-    for (char c : buffer) {
-        if (!isdigit(c)) return false;
+//
+// Builds the value of a string literal from its text, quotes and all
+// Only literals with escapes need to be copied out of the file.
+//
+token Lex::get_string_literal(std::string_view text) {
+    text.remove_prefix(1);
+    text.remove_suffix(1);
+    
+    if (text.find('\\') == std::string_view::npos) {
+        value = text;
+        return t_string_literal;
     }
-    return true;
-}
-
-bool Lex::is_hex() {
-    if (buffer.length() < 3) return false;
-    if (buffer[0] != '0' || buffer[1] != 'x') return false;
     
-    for (int i = 2; i<buffer.length(); i++) {
-        if (!isxdigit(buffer[i])) return false;
+    literal = "";
+    for (size_t i = 0; i<text.size(); i++) {
+        char c = text[i];
+        if (c == '\\' && i + 1 < text.size()) {
+            c = text[++i];
+            if (c == 'n') {
+                literal += '\n';
+            } else {
+                literal += '\\';
+                literal += c;
+            }
+        } else {
+            literal += c;
+        }
     }
-    return true;
+    
+    value = literal;
+    return t_string_literal;
 }
 
-bool Lex::is_float() {
-    bool foundDot = false;
-    for (char c : buffer) {
-        if (c == '.') {
-            if (foundDot) return false;
-            foundDot = true;
-        } else if (!isdigit(c)) {
-            return false;
+//
+// Builds the value of a character literal from its text, quotes and all
+//
+token Lex::get_char_literal(std::string_view text) {
+    char c = text[1];
+    if (c == '\\') {
+        c = text[2];
+        if (c == 'n') {
+            c = '\n';
         }
     }
-    if (!foundDot) return false;
-    return true;
+    
+    i_value = (char)c;
+    literal = c;
+    value = literal;
+    return t_char_literal;
 }
 
 //
@@ -17,7 +17,7 @@ int stringcmp(const char *str1, const char *str2)
 char *strcat_char(const char *str, char c)
 {
     int len = strlen(str);
-    char *new_str = malloc(len + 1);
+    char *new_str = malloc(len + 2);
     for (int i = 0; i<len; i++) new_str[i] = str[i];
     new_str[len] = c;
     new_str[len+1] = '\0';
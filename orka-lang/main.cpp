@@ -8,15 +8,24 @@
 #include <cstdio>
 #include <memory>
 #include <cstdlib>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <set>
 
 #include <parser/Parser.hpp>
 #include <ast/ast.hpp>
 #include <midend/midend.hpp>
 #include <midend/parallel_midend.hpp>
+#include <midend/escape_midend.hpp>
 
 #include <llvm/Compiler.hpp>
+#include <llvm/Jit.hpp>
+#include <llvm/TimeReport.hpp>
 
-bool isError = false;
+std::atomic<bool> isError{false};
 
 std::shared_ptr<AstTree> getAstTree(std::string input, bool testLex, bool printAst, bool emitDot) {
     std::unique_ptr<Parser> frontend = std::make_unique<Parser>(input);
@@ -28,22 +37,43 @@ std::shared_ptr<AstTree> getAstTree(std::string input, bool testLex, bool printA
         return nullptr;
     }
     
+    // The parser pulls tokens as it goes, so the lexer is timed on its own
+    if (TimeReport::isEnabled()) {
+        TimePhase phase("lex", input);
+        Lex lex(input);
+        while (lex.get_next() != t_eof) {}
+    }
+    
+    TimePhase parsePhase("parse", input);
     if (!frontend->parse()) {
         isError = true;
         return nullptr;
     }
     
     tree = frontend->getTree();
+    parsePhase.stop();
     
     // Run the general midend
+    TimePhase midendPhase("midend", input);
     auto midend1 = std::make_unique<Midend>(tree);
     midend1->run();
     tree = midend1->tree;
+    midendPhase.stop();
     
     // Run the parallel processing midend
+    TimePhase parallelPhase("parallel midend", input);
     auto midend2 = std::make_unique<ParallelMidend>(tree);
     midend2->run();
     tree = midend2->tree;
+    parallelPhase.stop();
+    
+    // Find the structures that can go on the stack
+    TimePhase escapePhase("escape midend", input);
+    auto midend3 = std::make_unique<EscapeMidend>(tree);
+    midend3->run();
+    escapePhase.stop();
+    
+    TimeReport::countNodes(tree);
     
     if (printAst) {
         tree->print();
@@ -58,11 +88,6 @@ std::shared_ptr<AstTree> getAstTree(std::string input, bool testLex, bool printA
     return tree;
 }
 
-void assemble(CFlags cflags) {
-    std::string cmd = "as /tmp/" + cflags.name + ".asm -o /tmp/" + cflags.name + ".o";
-    system(cmd.c_str());
-}
-
 #ifdef DEV_LINK_MODE
 
 #ifndef LINK_CORELIB_LOCATION
@@ -77,12 +102,12 @@ void assemble(CFlags cflags) {
 #define LINK_MEMGC_LOCATION = "."
 #endif
 
-void link(CFlags cflags) {
+void link(CFlags cflags, std::string object) {
     std::string cmd = "ld ";
     cmd += "/usr/lib/x86_64-linux-gnu/crt1.o ";
     cmd += "/usr/lib/x86_64-linux-gnu/crti.o ";
     cmd += "/usr/lib/x86_64-linux-gnu/crtn.o ";
-    cmd += "/tmp/" + cflags.name + ".o -o " + cflags.name;
+    cmd += object + " -o " + cflags.name;
     cmd += " -L" + std::string(LINK_MEMGC_LOCATION) + " -lmemgc ";
     //cmd += " -L" + std::string(LINK_STDLIB_LOCATION) + " -lstdlib ";
     cmd += " -L" + std::string(LINK_CORELIB_LOCATION) + " -lcorelib ";
@@ -94,22 +119,68 @@ void link(CFlags cflags) {
     //printf("LINK: %s\n", cmd.c_str());
 }
 
+//
+// Runs the program in-process, without writing or linking anything
+// The runtime comes from the same archives the linker would use. The memgc
+// archive supplies the real "main", which sets up the collector and then
+// calls the program's own main.
+//
+int runJit(std::shared_ptr<AstTree> tree, CFlags flags, std::string input) {
+    TimePhase irPhase("irgen", flags.name);
+    auto compiler = std::make_unique<Compiler>(tree, flags);
+    if (!compiler->compile()) return 1;
+    irPhase.stop();
+    
+    std::string error;
+    auto jit = Jit::create(error);
+    if (!jit) {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
+    }
+    
+    jit->addArchive(std::string(LINK_MEMGC_LOCATION) + "/libmemgc.a");
+    jit->addArchive(std::string(LINK_CORELIB_LOCATION) + "/libcorelib.a");
+    jit->loadLibrary("libomp5.so");
+    
+    TimePhase jitPhase("jit", flags.name);
+    auto entry = (int (*)(int, char **))jit->compile(compiler.get(), "main");
+    if (!entry) {
+        std::cerr << "Error: " << jit->getError() << std::endl;
+        return 1;
+    }
+    
+    jitPhase.stop();
+    
+    TimePhase runPhase("run", flags.name);
+    char *argv[] = { (char *)input.c_str(), nullptr };
+    int code = entry(1, argv);
+    fflush(stdout);
+    return code;
+}
+
 #else
 
-void link(CFlags cflags) {
+void link(CFlags cflags, std::string object) {
     /*std::string cmd = "ld ";
     cmd += "/usr/local/lib/tinylang/ti_start.o ";
-    cmd += "/tmp/" + cflags.name + ".o -o " + cflags.name;
+    cmd += object + " -o " + cflags.name;
     cmd += " -dynamic-linker /lib64/ld-linux-x86-64.so.2 ";
     cmd += "-ltinylang -lc";
     system(cmd.c_str());*/
 }
 
+int runJit(std::shared_ptr<AstTree> tree, CFlags flags, std::string input) {
+    std::cerr << "Error: --run needs the development runtime libraries." << std::endl;
+    return 1;
+}
+
 #endif
 
-int compileLLVM(std::shared_ptr<AstTree> tree, CFlags flags, bool printLLVM, bool emitLLVM) {
+int compileLLVM(std::shared_ptr<AstTree> tree, CFlags flags, bool printLLVM, bool emitLLVM, bool emitAsm, bool emitObject) {
+    TimePhase irPhase("irgen", flags.name);
     std::unique_ptr<Compiler> compiler = std::make_unique<Compiler>(tree, flags);
-    compiler->compile();
+    if (!compiler->compile()) return 1;
+    irPhase.stop();
         
     if (printLLVM) {
         compiler->debug();
@@ -125,11 +196,159 @@ int compileLLVM(std::shared_ptr<AstTree> tree, CFlags flags, bool printLLVM, boo
         compiler->emitLLVM(output);
         return 0;
     }
+    
+    if (emitAsm) {
+        std::string output = flags.name;
+        if (output == "a.out") {
+            output = "./out.s";
+        }
+        
+        if (!compiler->writeAssembly(output)) return 1;
+        return 0;
+    }
+    
+    if (emitObject) {
+        std::string output = flags.name;
+        if (output == "a.out") {
+            output = "./out.o";
+        }
+        
+        if (!compiler->writeObject(output)) return 1;
+        return 0;
+    }
+    
+    // The object goes straight from the code generator to the linker
+    std::string object = compiler->writeTempObject();
+    if (object == "") return 1;
+    
+    TimePhase linkPhase("link", flags.name);
+    link(flags, object);
+    linkPhase.stop();
+    
+    remove(object.c_str());
+    
+    return 0;
+}
+
+//
+// One input file in a multi-file build
+//
+struct BuildJob {
+    std::string input;
+    std::string object = "";
+    double ms = 0;
+    bool failed = false;
+};
+
+//
+// The file name without its directory or extension, which names the object
+//
+std::string getStem(std::string input) {
+    std::string stem = input.substr(0, input.find_last_of('.'));
+    return stem.substr(stem.find_last_of('/') + 1);
+}
+
+//
+// Parses and compiles a single file down to an object
+// The parser, midend, and LLVM context all belong to this job, so
+// separate jobs can run on separate threads.
+//
+void compileJob(BuildJob &job, CFlags flags, bool emitObject) {
+    auto start = std::chrono::steady_clock::now();
+    
+    std::string stem = getStem(job.input);
+    flags.name = stem;
+    
+    std::shared_ptr<AstTree> tree = getAstTree(job.input, false, false, false);
+    if (tree == nullptr) {
+        job.failed = true;
+    } else {
+        TimePhase irPhase("irgen", flags.name);
+        auto compiler = std::make_unique<Compiler>(tree, flags);
+        bool compiled = compiler->compile();
+        irPhase.stop();
+        
+        if (!compiled) {
+            job.failed = true;
+        } else if (emitObject) {
+            job.object = "./" + stem + ".o";
+            if (!compiler->writeObject(job.object)) job.failed = true;
+        } else {
+            job.object = compiler->writeTempObject();
+            if (job.object == "") job.failed = true;
+        }
+    }
+    
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    job.ms = elapsed.count();
+}
+
+//
+// Compiles several files at once on a pool of worker threads, and then
+// links all the objects together in one step.
+//
+int compileMultiple(std::vector<std::string> inputs, CFlags flags, bool emitObject, int threadCount, bool printTime) {
+    auto start = std::chrono::steady_clock::now();
+    
+    std::vector<BuildJob> jobs;
+    for (auto const &input : inputs) {
+        BuildJob job;
+        job.input = input;
+        jobs.push_back(job);
+    }
+    
+    if (threadCount <= 0) threadCount = std::thread::hardware_concurrency();
+    if (threadCount <= 0) threadCount = 1;
+    if (threadCount > (int)jobs.size()) threadCount = jobs.size();
+    
+    // Each worker pulls the next file off the list until there are none left
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < jobs.size(); i = next++) {
+            compileJob(jobs[i], flags, emitObject);
+        }
+    };
+    
+    std::vector<std::thread> threads;
+    for (int i = 0; i<threadCount; i++) {
+        threads.emplace_back(worker);
+    }
+    
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    
+    bool failed = false;
+    std::string objects = "";
+    for (auto const &job : jobs) {
+        if (job.failed) failed = true;
+        if (job.object != "") objects += job.object + " ";
+    }
+    
+    if (!failed && !emitObject) {
+        TimePhase linkPhase("link", flags.name);
+        link(flags, objects);
+    }
+    
+    // Temporary objects are cleaned up whether or not the link happened
+    if (!emitObject) {
+        for (auto const &job : jobs) {
+            if (job.object != "") remove(job.object.c_str());
+        }
+    }
+    
+    if (printTime) {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
         
-    compiler->writeAssembly();
-    assemble(flags);
-    link(flags);
+        std::cerr << std::fixed << std::setprecision(2);
+        for (auto const &job : jobs) {
+            std::cerr << "[time] " << job.input << ": " << job.ms << " ms" << std::endl;
+        }
+        std::cerr << "[time] total: " << elapsed.count() << " ms (" << jobs.size() << " files, ";
+        std::cerr << threadCount << " threads)" << std::endl;
+    }
     
+    if (failed) return 1;
     return 0;
 }
 
@@ -145,13 +364,20 @@ int main(int argc, char **argv) {
     flags.use_memgc = true;
     
     // Other flags
-    std::string input = "";
+    std::vector<std::string> inputs;
     bool emitPreproc = false;
     bool testLex = false;
     bool printAst = false;
     bool emitDot = false;
     bool printLLVM = false;
     bool emitLLVM = false;
+    bool emitAsm = false;
+    bool emitObject = false;
+    bool printTime = false;
+    bool timeReport = false;
+    std::string timeTrace = "";
+    bool runProgram = false;
+    int threadCount = 0;
     
     for (int i = 1; i<argc; i++) {
         std::string arg = argv[i];
@@ -168,24 +394,111 @@ int main(int argc, char **argv) {
             printLLVM = true;
         } else if (arg == "--emit-llvm") {
             emitLLVM = true;
+        } else if (arg == "-S") {
+            emitAsm = true;
+        } else if (arg == "-c") {
+            emitObject = true;
         } else if (arg == "-o") {
             flags.name = argv[i+1];
             i += 1;
+        } else if (arg == "-O0" || arg == "-O1" || arg == "-O2" || arg == "-O3") {
+            flags.opt_level = arg[2] - '0';
+        } else if (arg == "-O") {
+            flags.opt_level = 2;
+        } else if (arg == "--codegen-threads") {
+            if (i + 1 == argc) {
+                std::cerr << "Error: --codegen-threads needs a thread count." << std::endl;
+                return 1;
+            }
+            flags.codegen_threads = atoi(argv[i+1]);
+            i += 1;
+        } else if (arg == "-j") {
+            if (i + 1 == argc) {
+                std::cerr << "Error: -j needs a thread count." << std::endl;
+                return 1;
+            }
+            
+            char *end = nullptr;
+            threadCount = strtol(argv[i+1], &end, 10);
+            if (end == argv[i+1] || *end != '\0') {
+                std::cerr << "Error: Invalid thread count: " << argv[i+1] << std::endl;
+                return 1;
+            }
+            i += 1;
+        } else if (arg == "--time") {
+            printTime = true;
+        } else if (arg == "--time-report") {
+            timeReport = true;
+        } else if (arg == "--time-trace") {
+            if (i + 1 == argc) {
+                std::cerr << "Error: --time-trace needs a file." << std::endl;
+                return 1;
+            }
+            timeTrace = argv[i+1];
+            i += 1;
+        } else if (arg == "--run") {
+            runProgram = true;
         } else if (arg[0] == '-') {
             std::cerr << "Invalid option: " << arg << std::endl;
             return 1;
         } else {
-            input = arg;
+            inputs.push_back(arg);
+        }
+    }
+    
+    if (inputs.size() == 0) {
+        std::cerr << "Error: No input file specified." << std::endl;
+        return 1;
+    }
+    
+    TimeReport::enable(timeReport, timeTrace);
+    
+    // Multiple files are built in parallel, and linked together at the end
+    if (inputs.size() > 1) {
+        if (testLex || printAst || emitDot || printLLVM || emitLLVM || emitAsm || runProgram) {
+            std::cerr << "Error: Only one input file is allowed with this option." << std::endl;
+            return 1;
         }
+        
+        if (emitObject && flags.name != "a.out") {
+            std::cerr << "Error: Cannot use -o with -c and multiple input files." << std::endl;
+            return 1;
+        }
+        
+        // With -c, each object is written next to us under the file's name,
+        // so two files with the same name would write over each other
+        if (emitObject) {
+            std::set<std::string> stems;
+            for (auto const &input : inputs) {
+                if (!stems.insert(getStem(input)).second) {
+                    std::cerr << "Error: More than one input file would be compiled to " << getStem(input) << ".o" << std::endl;
+                    return 1;
+                }
+            }
+        }
+        
+        int result = compileMultiple(inputs, flags, emitObject, threadCount, printTime);
+        TimeReport::finish();
+        return result;
     }
     
+    std::string input = inputs[0];
     std::shared_ptr<AstTree> tree = getAstTree(input, testLex, printAst, emitDot);
     if (tree == nullptr) {
         if (isError) return 1;
         return 0;
     }
 
-    // Compile
-    return compileLLVM(tree, flags, printLLVM, emitLLVM);
+    int result = 0;
+    if (runProgram) {
+        // Compile and run in-process
+        result = runJit(tree, flags, input);
+    } else {
+        // Compile
+        result = compileLLVM(tree, flags, printLLVM, emitLLVM, emitAsm, emitObject);
+    }
+    
+    TimeReport::finish();
+    return result;
 }
 
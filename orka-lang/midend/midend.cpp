@@ -10,7 +10,7 @@
 //
 // Process binary operation for strings
 //
-std::shared_ptr<AstExpression> Midend::process_binary_op(std::shared_ptr<AstBinaryOp> expr, std::shared_ptr<AstBlock> block) {
+AstExpression *Midend::process_binary_op(AstBinaryOp *expr, AstBlock *block) {
     auto lval = expr->lval;
     auto rval = expr->rval;
     
@@ -23,11 +23,11 @@ std::shared_ptr<AstExpression> Midend::process_binary_op(std::shared_ptr<AstBina
     } else if (lval->type == V_AstType::StringL && rval->type == V_AstType::CharL) {
         string_op = true;
     } else if (lval->type == V_AstType::ID && rval->type == V_AstType::CharL) {
-        std::shared_ptr<AstID> lvalID = std::static_pointer_cast<AstID>(lval);
+        AstID *lvalID = static_cast<AstID *>(lval);
         if (block->getDataType(lvalID->value)->type == V_AstType::String) string_op = true;
     } else if (lval->type == V_AstType::ID && rval->type == V_AstType::ID) {
-        std::shared_ptr<AstID> lvalID = std::static_pointer_cast<AstID>(lval);
-        std::shared_ptr<AstID> rvalID = std::static_pointer_cast<AstID>(rval);
+        AstID *lvalID = static_cast<AstID *>(lval);
+        AstID *rvalID = static_cast<AstID *>(rval);
         
         if (block->getDataType(lvalID->value)->type == V_AstType::String) string_op = true;
         if (block->getDataType(rvalID->value)->type == V_AstType::String) {
@@ -44,26 +44,26 @@ std::shared_ptr<AstExpression> Midend::process_binary_op(std::shared_ptr<AstBina
         return nullptr;
     }
     
-    auto args = std::make_shared<AstExprList>();
+    auto args = AstArena::make<AstExprList>();
     args->add_expression(lval);
     args->add_expression(rval);
 
     if (expr->type == V_AstType::EQ || expr->type == V_AstType::NEQ) {
-        auto fc = std::make_shared<AstFuncCallExpr>("stringcmp");
+        auto fc = AstArena::make<AstFuncCallExpr>("stringcmp");
         fc->args = args;
         expr->lval = fc;
         
         if (expr->type == V_AstType::NEQ)
-            expr->rval = std::make_shared<AstInt>(0);
+            expr->rval = AstArena::make<AstInt>(0);
         else
-            expr->rval = std::make_shared<AstInt>(1);
+            expr->rval = AstArena::make<AstInt>(1);
     } else if (expr->type == V_AstType::Add) {
         if (rval_str) {
-            auto fc = std::make_shared<AstFuncCallExpr>("strcat_str");
+            auto fc = AstArena::make<AstFuncCallExpr>("strcat_str");
             fc->args = args;
             return fc;
         } else {
-            auto fc = std::make_shared<AstFuncCallExpr>("strcat_char");
+            auto fc = AstArena::make<AstFuncCallExpr>("strcat_char");
             fc->args = args;
             return fc;
         }
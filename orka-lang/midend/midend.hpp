@@ -16,6 +16,6 @@
 class Midend : public AstMidend {
 public:
     explicit Midend(std::shared_ptr<AstTree> tree) : AstMidend(tree) {}
-    std::shared_ptr<AstExpression> process_binary_op(std::shared_ptr<AstBinaryOp> expr, std::shared_ptr<AstBlock> block) override;
+    AstExpression *process_binary_op(AstBinaryOp *expr, AstBlock *block) override;
 };
 
@@ -12,13 +12,18 @@
 #include <lex/lex.hpp>
 
 // Builds a constant expression value
-std::shared_ptr<AstExpression> Parser::build_constant(int tk) {
+AstExpression *Parser::build_constant(int tk) {
     switch (tk) {
-        case t_true: return std::make_shared<AstInt>(1);
-        case t_false: return std::make_shared<AstInt>(0);
-        case t_char_literal: return std::make_shared<AstChar>((char)lex->i_value);
+        case t_true: return AstArena::make<AstInt>(1);
+        case t_false: return AstArena::make<AstInt>(0);
+        case t_char_literal: return AstArena::make<AstChar>((char)lex->i_value);
         case t_int_literal: {
-            int value = lex->i_value;
+            if (lex->i_overflow) {
+                syntax->addError(lex->line_number, "Integer literal is too large.");
+                return nullptr;
+            }
+            
+            uint64_t value = lex->i_value;
             int tk_next = lex->get_next();
             if (tk_next == t_dot) {
                 tk_next = lex->get_next();
@@ -27,16 +32,16 @@ std::shared_ptr<AstExpression> Parser::build_constant(int tk) {
                     return nullptr;
                 }
                 
-                int value2 = lex->i_value;
+                uint64_t value2 = lex->i_value;
                 std::string buffer = std::to_string(value) + "." + std::to_string(value2);
                 double f_value = std::stod(buffer);
-                return std::make_shared<AstFloat>(f_value);
+                return AstArena::make<AstFloat>(f_value);
             }
             lex->unget(tk_next);
-            return std::make_shared<AstInt>(value);
+            return AstArena::make<AstInt>(value);
         }
-        case t_float_literal: return std::make_shared<AstFloat>(lex->f_value);
-        case t_string_literal: return std::make_shared<AstString>(lex->value);
+        case t_float_literal: return AstArena::make<AstFloat>(lex->f_value);
+        case t_string_literal: return AstArena::make<AstString>(std::string(lex->value));
         
         default: {}
     }
@@ -64,32 +69,32 @@ bool Parser::build_operator(int tk, std::shared_ptr<ExprContext> ctx) {
         case t_lte:
         case t_lgand:
         case t_lgor: {
-            std::shared_ptr<AstBinaryOp> op = std::make_shared<AstBinaryOp>();
-            std::shared_ptr<AstUnaryOp> op1 = std::make_shared<AstUnaryOp>();
+            AstBinaryOp *op = AstArena::make<AstBinaryOp>();
+            AstUnaryOp *op1 = AstArena::make<AstUnaryOp>();
             bool useUnary = false;
             switch (tk) {
-                case t_assign: op = std::make_shared<AstAssignOp>(); break;
-                case t_plus: op = std::make_shared<AstAddOp>(); break;
-                case t_mul: op = std::make_shared<AstMulOp>(); break;
-                case t_div: op = std::make_shared<AstDivOp>(); break;
-                case t_mod: op = std::make_shared<AstModOp>(); break;
-                case t_and: op = std::make_shared<AstAndOp>(); break;
-                case t_or: op = std::make_shared<AstOrOp>(); break;
-                case t_xor: op = std::make_shared<AstXorOp>(); break;
-                case t_eq: op = std::make_shared<AstEQOp>(); break;
-                case t_neq: op = std::make_shared<AstNEQOp>(); break;
-                case t_gt: op = std::make_shared<AstGTOp>(); break;
-                case t_lt: op = std::make_shared<AstLTOp>(); break;
-                case t_gte: op = std::make_shared<AstGTEOp>(); break;
-                case t_lte: op = std::make_shared<AstLTEOp>(); break;
-                case t_lgand: op = std::make_shared<AstLogicalAndOp>(); break;
-                case t_lgor: op = std::make_shared<AstLogicalOrOp>(); break;
+                case t_assign: op = AstArena::make<AstAssignOp>(); break;
+                case t_plus: op = AstArena::make<AstAddOp>(); break;
+                case t_mul: op = AstArena::make<AstMulOp>(); break;
+                case t_div: op = AstArena::make<AstDivOp>(); break;
+                case t_mod: op = AstArena::make<AstModOp>(); break;
+                case t_and: op = AstArena::make<AstAndOp>(); break;
+                case t_or: op = AstArena::make<AstOrOp>(); break;
+                case t_xor: op = AstArena::make<AstXorOp>(); break;
+                case t_eq: op = AstArena::make<AstEQOp>(); break;
+                case t_neq: op = AstArena::make<AstNEQOp>(); break;
+                case t_gt: op = AstArena::make<AstGTOp>(); break;
+                case t_lt: op = AstArena::make<AstLTOp>(); break;
+                case t_gte: op = AstArena::make<AstGTEOp>(); break;
+                case t_lte: op = AstArena::make<AstLTEOp>(); break;
+                case t_lgand: op = AstArena::make<AstLogicalAndOp>(); break;
+                case t_lgor: op = AstArena::make<AstLogicalOrOp>(); break;
                 case t_minus: {
                     if (ctx->lastWasOp) {
-                        op1 = std::make_shared<AstNegOp>();
+                        op1 = AstArena::make<AstNegOp>();
                         useUnary = true;
                     } else {
-                        op = std::make_shared<AstSubOp>();
+                        op = AstArena::make<AstSubOp>();
                     }
                 } break;
             }
@@ -103,31 +108,32 @@ bool Parser::build_operator(int tk, std::shared_ptr<ExprContext> ctx) {
     return true;        
 }
 
-bool Parser::build_identifier(std::shared_ptr<AstBlock> block, int tk, std::shared_ptr<ExprContext> ctx) {
+bool Parser::build_identifier(AstBlock *block, int tk, std::shared_ptr<ExprContext> ctx) {
     ctx->lastWasOp = false;
     int currentLine = 0;
 
-    std::string name = lex->value;
+    std::string name(lex->value);
+    SymbolId name_id = lex->id;
     if (ctx->varType && ctx->varType->type == V_AstType::Void) {
-        ctx->varType = block->getDataType(name);
+        ctx->varType = block->getDataType(name_id);
         if (ctx->varType && ctx->varType->type == V_AstType::Ptr)
-            ctx->varType = std::static_pointer_cast<AstPointerType>(ctx->varType)->base_type;
+            ctx->varType = static_cast<AstPointerType *>(ctx->varType)->base_type;
     }
     
     tk = lex->get_next();
     if (tk == t_lbracket) {
-        std::shared_ptr<AstExpression> index = buildExpression(block, AstBuilder::buildInt32Type(), t_rbracket);
+        AstExpression *index = buildExpression(block, AstBuilder::buildInt32Type(), t_rbracket);
         if (index == nullptr) {
             syntax->addError(0, "Invalid array reference.");
             return false;
         }
         
-        if (block->symbolTable[name]->type == V_AstType::String) {
-            std::shared_ptr<AstArrayAccess> acc = std::make_shared<AstArrayAccess>(name);
+        if (block->getDataType(name_id)->type == V_AstType::String) {
+            AstArrayAccess *acc = AstArena::make<AstArrayAccess>(name);
             acc->index = index;
             ctx->output.push(acc);
         } else {
-            std::shared_ptr<AstStructAccess> sa_acc = std::make_shared<AstStructAccess>(name, "ptr");
+            AstStructAccess *sa_acc = AstArena::make<AstStructAccess>(name, "ptr");
             sa_acc->access_expression = index;
             ctx->output.push(sa_acc);
         }
@@ -136,19 +142,19 @@ bool Parser::build_identifier(std::shared_ptr<AstBlock> block, int tk, std::shar
             syntax->addWarning(0, "Function call on newline- possible logic error.");
         }
         
-        if (!block->isFunc(name) && !java) {
+        if (!block->isFunc(name_id) && !java) {
             syntax->addError(0, "Unknown function call: " + name);
             return false;
         }
     
-        std::shared_ptr<AstFuncCallExpr> fc = std::make_shared<AstFuncCallExpr>(name);
-        std::shared_ptr<AstExpression> args = buildExpression(block, ctx->varType, t_rparen, false, true);
+        AstFuncCallExpr *fc = AstArena::make<AstFuncCallExpr>(name, name_id);
+        AstExpression *args = buildExpression(block, ctx->varType, t_rparen, false, true);
         fc->args = args;
         
         ctx->output.push(fc);
     } else if (tk == t_dot) {
         int idToken = lex->get_next();
-        std::string id_value = lex->value;
+        std::string id_value(lex->value);
         if (idToken != t_id) {
             syntax->addError(lex->line_number, "Expected identifier.");
             return false;
@@ -157,17 +163,17 @@ bool Parser::build_identifier(std::shared_ptr<AstBlock> block, int tk, std::shar
         tk = lex->get_next();
         if (tk == t_lparen) {
             std::string className = classMap[name];
-            std::string func_name = lex->value;
+            std::string func_name(lex->value);
             if (!java) {
-                func_name = className + "_" + lex->value;
+                func_name = className + "_" + std::string(lex->value);
             }
             
-            auto fc = std::make_shared<AstFuncCallExpr>(func_name);
-            auto id = std::make_shared<AstID>(name);
+            auto fc = AstArena::make<AstFuncCallExpr>(func_name);
+            auto id = AstArena::make<AstID>(name);
             fc->object_name = id->value;
             
-            std::shared_ptr<AstExpression> args2 = buildExpression(block, ctx->varType, t_rparen, false, true);
-            std::shared_ptr<AstExprList> args = std::static_pointer_cast<AstExprList>(args2);
+            AstExpression *args2 = buildExpression(block, ctx->varType, t_rparen, false, true);
+            AstExprList *args = static_cast<AstExprList *>(args2);
             if (!java) args->list.insert(args->list.begin(), id);
             fc->args = args;
             
@@ -175,7 +181,7 @@ bool Parser::build_identifier(std::shared_ptr<AstBlock> block, int tk, std::shar
         } else {
             lex->unget(tk);
             
-            std::shared_ptr<AstStructAccess> val = std::make_shared<AstStructAccess>(name, id_value);
+            AstStructAccess *val = AstArena::make<AstStructAccess>(name, id_value);
             ctx->output.push(val);
         }
         
@@ -192,21 +198,16 @@ bool Parser::build_identifier(std::shared_ptr<AstBlock> block, int tk, std::shar
         }
         
         AstEnum dec = enums[name];
-        std::shared_ptr<AstExpression> val = dec.values[lex->value];
+        AstExpression *val = dec.values[std::string(lex->value)];
         ctx->output.push(val);
     } else {
-        int constVal = block->isConstant(name);
+        int constVal = block->isConstant(name_id);
         if (constVal > 0) {
-            if (constVal == 1) {
-                std::shared_ptr<AstExpression> expr = block->globalConsts[name].second;
-                ctx->output.push(expr);
-            } else if (constVal == 2) {
-                std::shared_ptr<AstExpression> expr = block->localConsts[name].second;
-                ctx->output.push(expr);
-            }
+            AstExpression *expr = block->getConstant(name_id);
+            ctx->output.push(expr);
         } else {
-            if (block->isVar(name)) {
-                std::shared_ptr<AstID> id = std::make_shared<AstID>(name);
+            if (block->isVar(name_id)) {
+                AstID *id = AstArena::make<AstID>(name, name_id);
                 ctx->output.push(id);
             } else {
                 syntax->addError(lex->line_number, "Unknown variable: " + name);
@@ -292,11 +293,11 @@ bool Parser::build_other_token(int tk, bool is_const, std::shared_ptr<ExprContex
                 return false;
             }
             
-            std::string name = lex->value;
+            std::string name(lex->value);
             
             int token1 = lex->get_next();
             int token2 = lex->get_next();
-            std::string token2_value = lex->value;
+            std::string token2_value(lex->value);
             int token3 = lex->get_next();
             
             if (token1 != t_lparen || token2 != t_id || token3 != t_rparen) {
@@ -304,7 +305,7 @@ bool Parser::build_other_token(int tk, bool is_const, std::shared_ptr<ExprContex
                 return false;
             }
             
-            std::shared_ptr<AstStructAccess> val = std::make_shared<AstStructAccess>(token2_value, "size");
+            AstStructAccess *val = AstArena::make<AstStructAccess>(token2_value, "size");
             ctx->output.push(val);
             
             return true;
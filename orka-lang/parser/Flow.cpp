@@ -13,22 +13,22 @@
 // Called if a conditional statement has only one operand. If it does,
 // we have to expand to have two operands before we get down to the
 // compiler layer
-std::shared_ptr<AstExpression> Parser::checkCondExpression(std::shared_ptr<AstBlock> block, std::shared_ptr<AstExpression> toCheck) {
-    std::shared_ptr<AstExpression> expr = toCheck;
+AstExpression *Parser::checkCondExpression(AstBlock *block, AstExpression *toCheck) {
+    AstExpression *expr = toCheck;
     
     switch (toCheck->type) {
         case V_AstType::ID: {
-            std::shared_ptr<AstID> id = std::static_pointer_cast<AstID>(toCheck);
-            std::shared_ptr<AstDataType> dataType = block->getDataType(id->value);            
-            std::shared_ptr<AstEQOp> eq = std::make_shared<AstEQOp>();
+            AstID *id = static_cast<AstID *>(toCheck);
+            AstDataType *dataType = block->getDataType(id->value);            
+            AstEQOp *eq = AstArena::make<AstEQOp>();
             eq->lval = id;
             
             switch (dataType->type) {
-                case V_AstType::Bool: eq->rval = std::make_shared<AstInt>(1); break;
-                case V_AstType::Int8: eq->rval = std::make_shared<AstInt>(1, 8); break;
-                case V_AstType::Int16: eq->rval = std::make_shared<AstInt>(1, 16); break;
-                case V_AstType::Int32: eq->rval = std::make_shared<AstInt>(1); break;
-                case V_AstType::Int64: eq->rval = std::make_shared<AstInt>(1, 64); break;
+                case V_AstType::Bool: eq->rval = AstArena::make<AstInt>(1); break;
+                case V_AstType::Int8: eq->rval = AstArena::make<AstInt>(1, 8); break;
+                case V_AstType::Int16: eq->rval = AstArena::make<AstInt>(1, 16); break;
+                case V_AstType::Int32: eq->rval = AstArena::make<AstInt>(1); break;
+                case V_AstType::Int64: eq->rval = AstArena::make<AstInt>(1, 64); break;
                 
                 default: {}
             }
@@ -37,9 +37,9 @@ std::shared_ptr<AstExpression> Parser::checkCondExpression(std::shared_ptr<AstBl
         } break;
         
         case V_AstType::IntL: {
-            std::shared_ptr<AstEQOp> eq = std::make_shared<AstEQOp>();
+            AstEQOp *eq = AstArena::make<AstEQOp>();
             eq->lval = expr;
-            eq->rval = std::make_shared<AstInt>(1);
+            eq->rval = AstArena::make<AstInt>(1);
             expr = eq;
         } break;
         
@@ -50,22 +50,22 @@ std::shared_ptr<AstExpression> Parser::checkCondExpression(std::shared_ptr<AstBl
 }
 
 // Builds a conditional statement
-bool Parser::buildConditional(std::shared_ptr<AstBlock> block) {
-    std::shared_ptr<AstIfStmt> cond = std::make_shared<AstIfStmt>();
-    std::shared_ptr<AstExpression> arg = buildExpression(block, nullptr, t_then);
+bool Parser::buildConditional(AstBlock *block) {
+    AstIfStmt *cond = AstArena::make<AstIfStmt>();
+    AstExpression *arg = buildExpression(block, nullptr, t_then);
     if (!arg) return false;
     cond->expression = arg;
     block->addStatement(cond);
     
-    std::shared_ptr<AstExpression> expr = checkCondExpression(block, cond->expression);
+    AstExpression *expr = checkCondExpression(block, cond->expression);
     cond->expression = expr;
     
-    std::shared_ptr<AstBlock> true_block = std::make_shared<AstBlock>();
-    true_block->mergeSymbols(block);
+    AstBlock *true_block = AstArena::make<AstBlock>();
+    true_block->setParent(block);
     cond->true_block = true_block;
     
-    std::shared_ptr<AstBlock> false_block = std::make_shared<AstBlock>();
-    false_block->mergeSymbols(block);
+    AstBlock *false_block = AstArena::make<AstBlock>();
+    false_block->setParent(block);
     cond->false_block = false_block;
     buildBlock(true_block, cond);
     
@@ -73,18 +73,18 @@ bool Parser::buildConditional(std::shared_ptr<AstBlock> block) {
 }
 
 // Builds a while statement
-bool Parser::buildWhile(std::shared_ptr<AstBlock> block) {
-    std::shared_ptr<AstWhileStmt> loop = std::make_shared<AstWhileStmt>();
-    std::shared_ptr<AstExpression> arg = buildExpression(block, nullptr, t_do);
+bool Parser::buildWhile(AstBlock *block) {
+    AstWhileStmt *loop = AstArena::make<AstWhileStmt>();
+    AstExpression *arg = buildExpression(block, nullptr, t_do);
     if (!arg) return false;
     loop->expression = arg;
     block->addStatement(loop);
     
-    std::shared_ptr<AstExpression> expr = checkCondExpression(block, loop->expression);
+    AstExpression *expr = checkCondExpression(block, loop->expression);
     loop->expression = expr;
     
-    std::shared_ptr<AstBlock> block2 = std::make_shared<AstBlock>();
-    block2->mergeSymbols(block);
+    AstBlock *block2 = AstArena::make<AstBlock>();
+    block2->setParent(block);
     buildBlock(block2);
     loop->block = block2;
     
@@ -92,12 +92,12 @@ bool Parser::buildWhile(std::shared_ptr<AstBlock> block) {
 }
 
 // Builds an infinite loop statement
-bool Parser::buildRepeat(std::shared_ptr<AstBlock> block) {
-    std::shared_ptr<AstRepeatStmt> loop = std::make_shared<AstRepeatStmt>();
+bool Parser::buildRepeat(AstBlock *block) {
+    AstRepeatStmt *loop = AstArena::make<AstRepeatStmt>();
     block->addStatement(loop);
     
-    std::shared_ptr<AstBlock> block2 = std::make_shared<AstBlock>();
-    block2->mergeSymbols(block);
+    AstBlock *block2 = AstArena::make<AstBlock>();
+    block2->setParent(block);
     buildBlock(block2);
     loop->block = block2;
 
@@ -105,8 +105,8 @@ bool Parser::buildRepeat(std::shared_ptr<AstBlock> block) {
 }
 
 // Builds a for loop
-bool Parser::buildFor(std::shared_ptr<AstBlock> block) {
-    std::shared_ptr<AstForStmt> loop = std::make_shared<AstForStmt>();
+bool Parser::buildFor(AstBlock *block) {
+    AstForStmt *loop = AstArena::make<AstForStmt>();
     block->addStatement(loop);
     
     // Get the index
@@ -116,9 +116,9 @@ bool Parser::buildFor(std::shared_ptr<AstBlock> block) {
         return false;
     }
     
-    std::string idx_name = lex->value;
-    loop->index = std::make_shared<AstID>(idx_name);
-    std::shared_ptr<AstDataType> dataType = AstBuilder::buildInt32Type();
+    std::string idx_name(lex->value);
+    loop->index = AstArena::make<AstID>(idx_name);
+    AstDataType *dataType = AstBuilder::buildInt32Type();
     
     token = lex->get_next();
     if (token != t_in) {
@@ -126,17 +126,17 @@ bool Parser::buildFor(std::shared_ptr<AstBlock> block) {
         return false;
     }
     
-    std::shared_ptr<AstExpression> start = buildExpression(block, dataType, t_range);
-    std::shared_ptr<AstExpression> end = buildExpression(block, dataType, t_step);
-    std::shared_ptr<AstExpression> step = buildExpression(block, dataType, t_do);
+    AstExpression *start = buildExpression(block, dataType, t_range);
+    AstExpression *end = buildExpression(block, dataType, t_step);
+    AstExpression *step = buildExpression(block, dataType, t_do);
     
     loop->start = start;
     loop->end = end;
     loop->step = step;
     loop->data_type = dataType;
     
-    std::shared_ptr<AstBlock> block2 = std::make_shared<AstBlock>();
-    block2->mergeSymbols(block);
+    AstBlock *block2 = AstArena::make<AstBlock>();
+    block2->setParent(block);
     block2->addSymbol(idx_name, dataType);
     buildBlock(block2);
     loop->block = block2;
@@ -145,8 +145,8 @@ bool Parser::buildFor(std::shared_ptr<AstBlock> block) {
 }
 
 // Builds a forall loop
-bool Parser::buildForAll(std::shared_ptr<AstBlock> block) {
-    std::shared_ptr<AstForAllStmt> loop = std::make_shared<AstForAllStmt>();
+bool Parser::buildForAll(AstBlock *block) {
+    AstForAllStmt *loop = AstArena::make<AstForAllStmt>();
     block->addStatement(loop);
     
     // Get the index
@@ -156,8 +156,8 @@ bool Parser::buildForAll(std::shared_ptr<AstBlock> block) {
         return false;
     }
     
-    std::string idx_name = lex->value;
-    loop->index = std::make_shared<AstID>(idx_name);
+    std::string idx_name(lex->value);
+    loop->index = AstArena::make<AstID>(idx_name);
     
     token = lex->get_next();
     if (token != t_in) {
@@ -172,14 +172,14 @@ bool Parser::buildForAll(std::shared_ptr<AstBlock> block) {
         return false;
     }
     
-    std::string array_name = lex->value;
-    loop->array = std::make_shared<AstID>(array_name);
+    std::string array_name(lex->value);
+    loop->array = AstArena::make<AstID>(array_name);
     
-    auto ptrType = std::static_pointer_cast<AstStructType>(block->symbolTable[array_name]);
-    std::shared_ptr<AstDataType> dataType;
+    auto ptrType = static_cast<AstStructType *>(block->getDataType(array_name));
+    AstDataType *dataType = nullptr;
     for (auto const &s : tree->structs) {
         if (ptrType->name == s->name) {
-            dataType = std::static_pointer_cast<AstPointerType>(s->items[0].type)->base_type;
+            dataType = static_cast<AstPointerType *>(s->items[0].type)->base_type;
         }
     }
     loop->data_type = dataType;
@@ -191,8 +191,8 @@ bool Parser::buildForAll(std::shared_ptr<AstBlock> block) {
         return false;
     }
     
-    std::shared_ptr<AstBlock> block2 = std::make_shared<AstBlock>();
-    block2->mergeSymbols(block);
+    AstBlock *block2 = AstArena::make<AstBlock>();
+    block2->setParent(block);
     block2->addSymbol(idx_name, dataType);
     buildBlock(block2);
     loop->block = block2;
@@ -201,9 +201,9 @@ bool Parser::buildForAll(std::shared_ptr<AstBlock> block) {
 }
 
 // Builds a loop keyword
-bool Parser::buildLoopCtrl(std::shared_ptr<AstBlock> block, bool isBreak) {
-    if (isBreak) block->addStatement(std::make_shared<AstBreak>());
-    else block->addStatement(std::make_shared<AstContinue>());
+bool Parser::buildLoopCtrl(AstBlock *block, bool isBreak) {
+    if (isBreak) block->addStatement(AstArena::make<AstBreak>());
+    else block->addStatement(AstArena::make<AstContinue>());
     
     int tk = lex->get_next();
     if (tk != t_semicolon) {
@@ -12,13 +12,13 @@
 #include <lex/lex.hpp>
 
 // Returns the function arguments
-bool Parser::getFunctionArgs(std::shared_ptr<AstBlock> block, std::vector<Var> &args) {
+bool Parser::getFunctionArgs(AstBlock *block, std::vector<Var> &args) {
     int tk = lex->get_next();
     if (tk == t_lparen) {
         tk = lex->get_next();
         while (tk != t_eof && tk != t_rparen) {
             int t1 = tk;
-            std::string name = lex->value;
+            std::string name(lex->value);
             int t2 = lex->get_next();
             Var v;
             
@@ -34,6 +34,7 @@ bool Parser::getFunctionArgs(std::shared_ptr<AstBlock> block, std::vector<Var> &
             
             v.type = buildDataType();
             v.name = name;
+            v.id = Symbol::intern(name);
             
             tk = lex->get_next();
             if (tk == t_comma) {
@@ -62,7 +63,7 @@ bool Parser::buildFunction(int startToken, std::string className) {
 
     // Make sure we have a function name
     tk = lex->get_next();
-    std::string funcName = lex->value;
+    std::string funcName(lex->value);
     
     if (funcName == "main" && className == "" && !java) funcName = "__main";
     
@@ -73,14 +74,15 @@ bool Parser::buildFunction(int startToken, std::string className) {
     
     // Get arguments
     std::vector<Var> args;
-    std::shared_ptr<AstBlock> block = std::make_shared<AstBlock>();
+    AstBlock *block = AstArena::make<AstBlock>();
     if (className != "") {
         Var classV;
         classV.name = "this";
+        classV.id = Symbol::intern("this");
         classV.type = AstBuilder::buildStructType(className);
         args.push_back(classV);
         
-        block->symbolTable["this"] = classV.type;
+        block->addSymbol("this", classV.type);
     }
     
     if (!getFunctionArgs(block, args)) return false;
@@ -88,7 +90,7 @@ bool Parser::buildFunction(int startToken, std::string className) {
     // Check to see if there's any return type
     //std::string retName = "";       // TODO: Do we need this?
     tk = lex->get_next();
-    std::shared_ptr<AstDataType> dataType;
+    AstDataType *dataType = nullptr;
     if (tk == t_arrow) {
         dataType = buildDataType();
         tk = lex->get_next();
@@ -105,22 +107,22 @@ bool Parser::buildFunction(int startToken, std::string className) {
     }
 
     // Create the function object
-    tree->block->funcs.push_back(funcName);
+    tree->block->addFunc(funcName);
     
     if (isExtern) {
-        std::shared_ptr<AstExternFunction> ex = std::make_shared<AstExternFunction>(funcName);
+        AstExternFunction *ex = AstArena::make<AstExternFunction>(funcName);
         ex->args = args;
         ex->data_type = dataType;
         tree->addGlobalStatement(ex);
         return true;
     }
     
-    std::shared_ptr<AstFunction> func = std::make_shared<AstFunction>(funcName);
+    AstFunction *func = AstArena::make<AstFunction>(funcName);
     func->data_type = dataType;
     func->args = args;
     tree->addGlobalStatement(func);
-    func->block->mergeSymbols(tree->block);
-    func->block->mergeSymbols(block);
+    block->setParent(tree->block);
+    func->block->setParent(block);
     
     func->routine = true;
     func->attr = Attr::Public;
@@ -140,7 +142,7 @@ bool Parser::buildFunction(int startToken, std::string className) {
     // Make sure we end with a return statement
     V_AstType lastType = func->block->getBlock().back()->type;
     if (lastType == V_AstType::Return) {
-        std::shared_ptr<AstStatement> ret = func->block->getBlock().back();
+        AstStatement *ret = func->block->getBlock().back();
         if (func->data_type->type == V_AstType::Void && ret->hasExpression()) {
             syntax->addError(0, "Cannot return from void function.");
             return false;
@@ -150,7 +152,7 @@ bool Parser::buildFunction(int startToken, std::string className) {
         }
     } else {
         if (func->data_type->type == V_AstType::Void) {
-            func->addStatement(std::make_shared<AstReturnStmt>());
+            func->addStatement(AstArena::make<AstReturnStmt>());
         } else {
             syntax->addError(0, "Expected return statement.");
             return false;
@@ -158,12 +160,12 @@ bool Parser::buildFunction(int startToken, std::string className) {
     }
     
     if (className != "") {
-        auto func2 = std::make_shared<AstFunction>(funcName);
+        auto func2 = AstArena::make<AstFunction>(funcName);
         func2->data_type = dataType;
         func2->args = args;
         currentClass->addFunction(func2);
         
-        std::shared_ptr<AstBlock> block2 = func->block;
+        AstBlock *block2 = func->block;
         func2->block->addStatements(block2->getBlock());
     }
     
@@ -171,17 +173,17 @@ bool Parser::buildFunction(int startToken, std::string className) {
 }
 
 // Builds a function call
-bool Parser::buildFunctionCallStmt(std::shared_ptr<AstBlock> block, std::string value) {
+bool Parser::buildFunctionCallStmt(AstBlock *block, std::string value) {
     // Make sure the function exists
     if (!block->isFunc(value) && !java) {
         syntax->addError(lex->line_number, "Unknown function.");
         return false;
     }
 
-    std::shared_ptr<AstFuncCallStmt> fc = std::make_shared<AstFuncCallStmt>(value);
+    AstFuncCallStmt *fc = AstArena::make<AstFuncCallStmt>(value);
     block->addStatement(fc);
     
-    std::shared_ptr<AstExpression> args = buildExpression(block, nullptr, t_semicolon, false, true);
+    AstExpression *args = buildExpression(block, nullptr, t_semicolon, false, true);
     if (!args) return false;
     fc->expression = args;
     
@@ -189,11 +191,11 @@ bool Parser::buildFunctionCallStmt(std::shared_ptr<AstBlock> block, std::string
 }
 
 // Builds a return statement
-bool Parser::buildReturn(std::shared_ptr<AstBlock> block) {
-    std::shared_ptr<AstReturnStmt> stmt = std::make_shared<AstReturnStmt>();
+bool Parser::buildReturn(AstBlock *block) {
+    AstReturnStmt *stmt = AstArena::make<AstReturnStmt>();
     block->addStatement(stmt);
     
-    std::shared_ptr<AstExpression> arg = buildExpression(block, nullptr, t_semicolon);
+    AstExpression *arg = buildExpression(block, nullptr, t_semicolon);
     if (!arg) return false;
     stmt->expression = arg;
     
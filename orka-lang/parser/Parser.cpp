@@ -17,59 +17,59 @@ Parser::Parser(std::string input, bool java) : BaseParser(input) {
     this->java = java;
 }
 
-Parser::Parser(std::string input) : BaseParser(input) {
+Parser::Parser(std::string input, std::shared_ptr<AstArena> arena) : BaseParser(input, arena) {
     lex = std::make_unique<Lex>(input);
     
     // Add the built-in functions
     //string malloc(string)
-    tree->block->funcs.push_back("malloc");
-    std::shared_ptr<AstExternFunction> FT1 = std::make_shared<AstExternFunction>("malloc");
+    tree->block->addFunc("malloc");
+    AstExternFunction *FT1 = AstArena::make<AstExternFunction>("malloc");
     FT1->addArgument(Var(AstBuilder::buildInt32Type(), "size"));
     FT1->data_type = AstBuilder::buildStringType();
     tree->addGlobalStatement(FT1);
     
     //println(string)
-    tree->block->funcs.push_back("println");
-    std::shared_ptr<AstExternFunction> FT2 = std::make_shared<AstExternFunction>("println");
+    tree->block->addFunc("println");
+    AstExternFunction *FT2 = AstArena::make<AstExternFunction>("println");
     FT2->varargs = true;
     FT2->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT2->data_type = AstBuilder::buildVoidType();
     tree->addGlobalStatement(FT2);
     
     //print(string)
-    tree->block->funcs.push_back("print");
-    std::shared_ptr<AstExternFunction> FT3 = std::make_shared<AstExternFunction>("print");
+    tree->block->addFunc("print");
+    AstExternFunction *FT3 = AstArena::make<AstExternFunction>("print");
     FT3->varargs = true;
     FT3->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT3->data_type = AstBuilder::buildVoidType();
     tree->addGlobalStatement(FT3);
     
     //i32 strlen(string)
-    tree->block->funcs.push_back("strlen");
-    std::shared_ptr<AstExternFunction> FT4 = std::make_shared<AstExternFunction>("strlen");
+    tree->block->addFunc("strlen");
+    AstExternFunction *FT4 = AstArena::make<AstExternFunction>("strlen");
     FT4->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT4->data_type = AstBuilder::buildInt32Type();
     tree->addGlobalStatement(FT4);
     
     //i32 stringcmp(string, string)
-    tree->block->funcs.push_back("stringcmp");
-    std::shared_ptr<AstExternFunction> FT5 = std::make_shared<AstExternFunction>("stringcmp");
+    tree->block->addFunc("stringcmp");
+    AstExternFunction *FT5 = AstArena::make<AstExternFunction>("stringcmp");
     FT5->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT5->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT5->data_type = AstBuilder::buildInt32Type();
     tree->addGlobalStatement(FT5);
     
     //string strcat_str(string, string)
-    tree->block->funcs.push_back("strcat_str");
-    std::shared_ptr<AstExternFunction> FT6 = std::make_shared<AstExternFunction>("strcat_str");
+    tree->block->addFunc("strcat_str");
+    AstExternFunction *FT6 = AstArena::make<AstExternFunction>("strcat_str");
     FT6->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT6->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT6->data_type = AstBuilder::buildStringType();
     tree->addGlobalStatement(FT6);
     
     //string strcat_char(string, char)
-    tree->block->funcs.push_back("strcat_char");
-    std::shared_ptr<AstExternFunction> FT7 = std::make_shared<AstExternFunction>("strcat_char");
+    tree->block->addFunc("strcat_char");
+    AstExternFunction *FT7 = AstArena::make<AstExternFunction>("strcat_char");
     FT7->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT7->addArgument(Var(AstBuilder::buildCharType(), "c"));
     FT7->data_type = AstBuilder::buildStringType();
@@ -77,43 +77,43 @@ Parser::Parser(std::string input) : BaseParser(input) {
     
     // Create structures for the internal arrays
     // Int8
-    auto int8ArrayStruct = std::make_shared<AstStruct>("__int8_array");
+    auto int8ArrayStruct = AstArena::make<AstStruct>("__int8_array");
     int8ArrayStruct->addItem(Var(AstBuilder::buildPointerType(AstBuilder::buildInt8Type()), "ptr"), nullptr);
-    int8ArrayStruct->addItem(Var(AstBuilder::buildInt32Type(), "size"), std::make_shared<AstInt>(0));
+    int8ArrayStruct->addItem(Var(AstBuilder::buildInt32Type(), "size"), AstArena::make<AstInt>(0));
     tree->addStruct(int8ArrayStruct);
     
     // Int16
-    auto int16ArrayStruct = std::make_shared<AstStruct>("__int16_array");
+    auto int16ArrayStruct = AstArena::make<AstStruct>("__int16_array");
     int16ArrayStruct->addItem(Var(AstBuilder::buildPointerType(AstBuilder::buildInt16Type()), "ptr"), nullptr);
-    int16ArrayStruct->addItem(Var(AstBuilder::buildInt32Type(), "size"), std::make_shared<AstInt>(0));
+    int16ArrayStruct->addItem(Var(AstBuilder::buildInt32Type(), "size"), AstArena::make<AstInt>(0));
     tree->addStruct(int16ArrayStruct);
     
     // Int32
-    auto int32ArrayStruct = std::make_shared<AstStruct>("__int32_array");
+    auto int32ArrayStruct = AstArena::make<AstStruct>("__int32_array");
     int32ArrayStruct->addItem(Var(AstBuilder::buildPointerType(AstBuilder::buildInt32Type()), "ptr"), nullptr);
-    int32ArrayStruct->addItem(Var(AstBuilder::buildInt32Type(), "size"), std::make_shared<AstInt>(0));
+    int32ArrayStruct->addItem(Var(AstBuilder::buildInt32Type(), "size"), AstArena::make<AstInt>(0));
     tree->addStruct(int32ArrayStruct);
     
     // Int64
-    auto int64ArrayStruct = std::make_shared<AstStruct>("__int64_array");
+    auto int64ArrayStruct = AstArena::make<AstStruct>("__int64_array");
     int64ArrayStruct->addItem(Var(AstBuilder::buildPointerType(AstBuilder::buildInt64Type()), "ptr"), nullptr);
-    int64ArrayStruct->addItem(Var(AstBuilder::buildInt32Type(), "size"), std::make_shared<AstInt>(0));
+    int64ArrayStruct->addItem(Var(AstBuilder::buildInt32Type(), "size"), AstArena::make<AstInt>(0));
     tree->addStruct(int64ArrayStruct);
     
     //
     // OpenMP functions
     //
     // Add built-in functions
-    auto fc1 = std::make_shared<AstExternFunction>("printf");
+    auto fc1 = AstArena::make<AstExternFunction>("printf");
     fc1->data_type = AstBuilder::buildVoidType();
     fc1->varargs = true;
     fc1->addArgument(Var(AstBuilder::buildStringType(), "fmt"));
     tree->block->addStatement(fc1);
-    tree->block->funcs.push_back("printf");
+    tree->block->addFunc("printf");
     
     // void __kmpc_fork_call(int *global_id, int *bound_id, int *func)
-    tree->block->funcs.push_back("__kmpc_fork_call");
-    auto omp_fc1 = std::make_shared<AstExternFunction>("__kmpc_fork_call");
+    tree->block->addFunc("__kmpc_fork_call");
+    auto omp_fc1 = AstArena::make<AstExternFunction>("__kmpc_fork_call");
     omp_fc1->addArgument(Var(AstBuilder::buildInt32PointerType(), "global_id"));
     omp_fc1->addArgument(Var(AstBuilder::buildInt32PointerType(), "bound_id"));
     omp_fc1->varargs = true;
@@ -121,8 +121,8 @@ Parser::Parser(std::string input) : BaseParser(input) {
     tree->addGlobalStatement(omp_fc1);
     
     // void __kmpc_for_static_init_4(0, *global_id, 34, &last, &lower, &upper, &stride, 1, 1);
-    tree->block->funcs.push_back("__kmpc_for_static_init_4");
-    auto omp_fc2 = std::make_shared<AstExternFunction>("__kmpc_for_static_init_4");
+    tree->block->addFunc("__kmpc_for_static_init_4");
+    auto omp_fc2 = AstArena::make<AstExternFunction>("__kmpc_for_static_init_4");
     omp_fc2->addArgument(Var(AstBuilder::buildInt32PointerType(), "global_id"));
     omp_fc2->addArgument(Var(AstBuilder::buildInt32PointerType(), "bound_id"));
     omp_fc2->addArgument(Var(AstBuilder::buildInt32Type(), "schedule"));
@@ -131,8 +131,8 @@ Parser::Parser(std::string input) : BaseParser(input) {
     tree->addGlobalStatement(omp_fc2);
     
     // void __kmpc_for_static_fini(0, *global_id);
-    tree->block->funcs.push_back("__kmpc_for_static_fini");
-    auto omp_fc3 = std::make_shared<AstExternFunction>("__kmpc_for_static_fini");
+    tree->block->addFunc("__kmpc_for_static_fini");
+    auto omp_fc3 = AstArena::make<AstExternFunction>("__kmpc_for_static_fini");
     omp_fc3->addArgument(Var(AstBuilder::buildInt32PointerType(), "global_id"));
     omp_fc3->addArgument(Var(AstBuilder::buildInt32PointerType(), "bound_id"));
     omp_fc3->varargs = true;
@@ -144,20 +144,20 @@ Parser::Parser(std::string input) : BaseParser(input) {
     //
     
     // void gc_init()
-    tree->block->funcs.push_back("gc_init");
-    auto gc_func1 = std::make_shared<AstExternFunction>("gc_init");
+    tree->block->addFunc("gc_init");
+    auto gc_func1 = AstArena::make<AstExternFunction>("gc_init");
     gc_func1->data_type = AstBuilder::buildVoidType();
     tree->addGlobalStatement(gc_func1);
     
     // void gc_destroy()
-    tree->block->funcs.push_back("gc_destroy");
-    auto gc_func2 = std::make_shared<AstExternFunction>("gc_destroy");
+    tree->block->addFunc("gc_destroy");
+    auto gc_func2 = AstArena::make<AstExternFunction>("gc_destroy");
     gc_func2->data_type = AstBuilder::buildVoidType();
     tree->addGlobalStatement(gc_func2);
     
     // void *gc_alloc(int size)
-    tree->block->funcs.push_back("gc_alloc");
-    auto gc_func3 = std::make_shared<AstExternFunction>("gc_alloc");
+    tree->block->addFunc("gc_alloc");
+    auto gc_func3 = AstArena::make<AstExternFunction>("gc_alloc");
     gc_func3->addArgument(Var(AstBuilder::buildInt32Type(), "size"));
     gc_func3->data_type = AstBuilder::buildStringType();
     tree->addGlobalStatement(gc_func3);
@@ -234,7 +234,8 @@ bool Parser::build_import() {
 #endif
 
     // Invoke another parser to load the path
-    auto parser = std::make_unique<Parser>(path);
+    // Its nodes end up in our tree, so it builds them in our arena.
+    auto parser = std::make_unique<Parser>(path, tree->arena);
     parser->parse();
     auto tree2 = parser->tree;
     
@@ -250,7 +251,7 @@ bool Parser::build_import() {
 }
 
 // Builds a statement block
-bool Parser::buildBlock(std::shared_ptr<AstBlock> block, std::shared_ptr<AstNode> parent) {
+bool Parser::buildBlock(AstBlock *block, AstNode *parent) {
     int tk = lex->get_next();
     while (tk != t_end && tk != t_eof) {
         bool code = true;
@@ -265,7 +266,7 @@ bool Parser::buildBlock(std::shared_ptr<AstBlock> block, std::shared_ptr<AstNode
             
             case t_id: {
                 int idtoken = tk;
-                std::string value = lex->value;
+                std::string value(lex->value);
                 tk = lex->get_next();
                 
                 if (tk == t_assign || tk == t_lbracket || tk == t_dot) {
@@ -285,12 +286,12 @@ bool Parser::buildBlock(std::shared_ptr<AstBlock> block, std::shared_ptr<AstNode
             // Handle conditionals
             case t_if: code = buildConditional(block); break;
             case t_elif: {
-                std::shared_ptr<AstIfStmt> condParent = std::static_pointer_cast<AstIfStmt>(parent);
+                AstIfStmt *condParent = static_cast<AstIfStmt *>(parent);
                 code = buildConditional(condParent->false_block);
                 end = true;
             } break;
             case t_else: {
-                std::shared_ptr<AstIfStmt> condParent = std::static_pointer_cast<AstIfStmt>(parent);
+                AstIfStmt *condParent = static_cast<AstIfStmt *>(parent);
                 buildBlock(condParent->false_block);
                 end = true;
             } break;
@@ -307,9 +308,9 @@ bool Parser::buildBlock(std::shared_ptr<AstBlock> block, std::shared_ptr<AstNode
             // TODO: Put in function
             case t_annot: {
                 consume_token(t_id, "Expected block name.");
-                auto name = lex->value;
+                std::string name(lex->value);
                 
-                auto annot_block = std::make_shared<AstBlockStmt>(name);
+                auto annot_block = AstArena::make<AstBlockStmt>(name);
                 block->addStatement(annot_block);
                 
                 int t = lex->get_next();
@@ -319,7 +320,7 @@ bool Parser::buildBlock(std::shared_ptr<AstBlock> block, std::shared_ptr<AstNode
                         return false;
                     }
                     
-                    annot_block->clauses.push_back(lex->value);
+                    annot_block->clauses.push_back(std::string(lex->value));
                     t = lex->get_next();
                 }
                 
@@ -331,7 +332,7 @@ bool Parser::buildBlock(std::shared_ptr<AstBlock> block, std::shared_ptr<AstNode
                     return false;
                 }
                 
-                annot_block->block->mergeSymbols(block);
+                annot_block->block->setParent(block);
                 buildBlock(annot_block->block);
             } break;
             
@@ -363,9 +364,9 @@ void Parser::debugScanner() {
 //
 // Builds a data type from the token stream
 //
-std::shared_ptr<AstDataType> Parser::buildDataType(bool checkBrackets) {
+AstDataType *Parser::buildDataType(bool checkBrackets) {
     int tk = lex->get_next();
-    std::shared_ptr<AstDataType> dataType = nullptr;
+    AstDataType *dataType = nullptr;
     
     switch (tk) {
         case t_bool: dataType = AstBuilder::buildBoolType(); break;
@@ -393,9 +394,9 @@ std::shared_ptr<AstDataType> Parser::buildDataType(bool checkBrackets) {
                 
             if (isStruct) {
                 if (java) {
-                    dataType = AstBuilder::buildObjectType(lex->value);
+                    dataType = AstBuilder::buildObjectType(std::string(lex->value));
                 } else {
-                    dataType = AstBuilder::buildStructType(lex->value);
+                    dataType = AstBuilder::buildStructType(std::string(lex->value));
                 }
             }
         } break;
@@ -423,12 +424,12 @@ std::shared_ptr<AstDataType> Parser::buildDataType(bool checkBrackets) {
     return dataType;
 }
 
-std::string Parser::getArrayType(std::shared_ptr<AstDataType> dataType) {
+std::string Parser::getArrayType(AstDataType *dataType) {
     switch (dataType->type) {
         case V_AstType::Char:
         case V_AstType::Int8: return "__int8_array";
         case V_AstType::Int16: return "__int16_array";
-        //case V_AstType::String:
+        case V_AstType::String:
         case V_AstType::Int64: return "__int64_array";
         case V_AstType::Float32: return "__f32_array";
         case V_AstType::Float64: return "__f64_array";
@@ -20,7 +20,7 @@
 // It is also in charge of the error manager
 class Parser : public BaseParser {
 public:
-    explicit Parser(std::string input);
+    explicit Parser(std::string input, std::shared_ptr<AstArena> arena = nullptr);
     explicit Parser(std::string input, bool java);
     ~Parser();
     
@@ -31,32 +31,32 @@ public:
     void debugScanner();
 protected:
     // Function.cpp
-    bool getFunctionArgs(std::shared_ptr<AstBlock> block, std::vector<Var> &args);
+    bool getFunctionArgs(AstBlock *block, std::vector<Var> &args);
     bool buildFunction(int startToken, std::string className = "");
-    bool buildFunctionCallStmt(std::shared_ptr<AstBlock> block, std::string value);
-    bool buildReturn(std::shared_ptr<AstBlock> block);
+    bool buildFunctionCallStmt(AstBlock *block, std::string value);
+    bool buildReturn(AstBlock *block);
     
     // Variable.cpp
-    bool buildVariableDec(std::shared_ptr<AstBlock> block);
-    bool build_array_dec(std::shared_ptr<AstBlock> block);
-    bool buildVariableAssign(std::shared_ptr<AstBlock> block, std::string value);
-    bool buildConst(std::shared_ptr<AstBlock> block, bool isGlobal);
+    bool buildVariableDec(AstBlock *block);
+    bool build_array_dec(AstBlock *block);
+    bool buildVariableAssign(AstBlock *block, std::string value);
+    bool buildConst(AstBlock *block, bool isGlobal);
     
     // Flow.cpp
-    bool buildConditional(std::shared_ptr<AstBlock> block);
-    bool buildWhile(std::shared_ptr<AstBlock> block);
-    bool buildRepeat(std::shared_ptr<AstBlock> block);
-    bool buildFor(std::shared_ptr<AstBlock> block);
-    bool buildForAll(std::shared_ptr<AstBlock> block);
-    bool buildLoopCtrl(std::shared_ptr<AstBlock> block, bool isBreak);
+    bool buildConditional(AstBlock *block);
+    bool buildWhile(AstBlock *block);
+    bool buildRepeat(AstBlock *block);
+    bool buildFor(AstBlock *block);
+    bool buildForAll(AstBlock *block);
+    bool buildLoopCtrl(AstBlock *block, bool isBreak);
     
     // Structure.cpp
     bool buildEnum();
     bool buildStruct();
-    bool buildStructMember(std::shared_ptr<AstStruct> str, int tk);
-    bool buildStructDec(std::shared_ptr<AstBlock> block);
+    bool buildStructMember(AstStruct *str, int tk);
+    bool buildStructDec(AstBlock *block);
     bool buildClass();
-    bool buildClassDec(std::shared_ptr<AstBlock> block);
+    bool buildClassDec(AstBlock *block);
     
     // Expression.cpp
     bool is_constant(int tk) override;
@@ -68,21 +68,21 @@ protected:
     int get_sub_expr_end() override;
     
     bool build_operator(int tk, std::shared_ptr<ExprContext> ctx) override;
-    std::shared_ptr<AstExpression> build_constant(int tk) override;
-    bool build_identifier(std::shared_ptr<AstBlock> block, int tk, std::shared_ptr<ExprContext> ctx) override;
+    AstExpression *build_constant(int tk) override;
+    bool build_identifier(AstBlock *block, int tk, std::shared_ptr<ExprContext> ctx) override;
     bool build_other_token(int tk, bool is_const, std::shared_ptr<ExprContext> ctx) override;
     
     // Parser.cpp
     bool build_import();
-    bool buildBlock(std::shared_ptr<AstBlock> block, std::shared_ptr<AstNode> parent = nullptr);
-    std::shared_ptr<AstExpression> checkCondExpression(std::shared_ptr<AstBlock> block, std::shared_ptr<AstExpression> toCheck);
-    std::shared_ptr<AstDataType> buildDataType(bool checkBrackets = true);
-    std::string getArrayType(std::shared_ptr<AstDataType> dataType);
+    bool buildBlock(AstBlock *block, AstNode *parent = nullptr);
+    AstExpression *checkCondExpression(AstBlock *block, AstExpression *toCheck);
+    AstDataType *buildDataType(bool checkBrackets = true);
+    std::string getArrayType(AstDataType *dataType);
     void consume_token(token t, std::string message);
 private:
     std::map<std::string, AstEnum> enums;
     
-    std::shared_ptr<AstClass> currentClass = nullptr;
+    AstClass *currentClass = nullptr;
     std::map<std::string, std::string> classMap;
     
     bool java = false;
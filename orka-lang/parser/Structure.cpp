@@ -16,7 +16,7 @@
 // Parses and builds an enumeration
 bool Parser::buildEnum() {
     int token = lex->get_next();
-    std::string name = lex->value;
+    std::string name(lex->value);
     
     if (token != t_id) {
         syntax->addError(lex->line_number, "Expected enum name.");
@@ -25,7 +25,7 @@ bool Parser::buildEnum() {
     
     // See if we have a type for the enum. Default is int
     token = lex->get_next();
-    std::shared_ptr<AstDataType> dataType = AstBuilder::buildInt32Type();
+    AstDataType *dataType = AstBuilder::buildInt32Type();
     bool useDefault = false;
     
     switch (token) {
@@ -59,12 +59,12 @@ bool Parser::buildEnum() {
     }
     
     // Loop and get all the values
-    std::map<std::string, std::shared_ptr<AstExpression>> values;
+    std::map<std::string, AstExpression *> values;
     int index = 0;
     
     while (token != t_end && token != t_eof) {
         token = lex->get_next();
-        std::string valName = lex->value;
+        std::string valName(lex->value);
         
         if (token != t_id) {
             syntax->addError(lex->line_number, "Expected enum value.");
@@ -72,7 +72,7 @@ bool Parser::buildEnum() {
         }
         
         token = lex->get_next();
-        std::shared_ptr<AstExpression> value = nullptr;
+        AstExpression *value = nullptr;
         
         if (token == t_assign) {
         
@@ -82,7 +82,7 @@ bool Parser::buildEnum() {
         }
         
         if (value == nullptr) {
-            value = checkExpression(std::make_shared<AstInt>(index), dataType);
+            value = checkExpression(AstArena::make<AstInt>(index), dataType);
             ++index;
         }
         
@@ -102,7 +102,7 @@ bool Parser::buildEnum() {
 // Parses and builds a structure
 bool Parser::buildStruct() {
     int tk = lex->get_next();
-    std::string name = lex->value;
+    std::string name(lex->value);
     
     if (tk != t_id) {
         syntax->addError(lex->line_number, "Expected name for struct.");
@@ -116,7 +116,7 @@ bool Parser::buildStruct() {
     }
     
     // Builds the struct items
-    std::shared_ptr<AstStruct> str = std::make_shared<AstStruct>(name);
+    AstStruct *str = AstArena::make<AstStruct>(name);
     tk = lex->get_next();
     
     while (tk != t_end && tk != t_eof) {
@@ -129,8 +129,8 @@ bool Parser::buildStruct() {
     return true;
 }
 
-bool Parser::buildStructMember(std::shared_ptr<AstStruct> str, int tk) {
-    std::string valName = lex->value;
+bool Parser::buildStructMember(AstStruct *str, int tk) {
+    std::string valName(lex->value);
     
     if (tk != t_id) {
         syntax->addError(lex->line_number, "Expected id value.");
@@ -144,18 +144,16 @@ bool Parser::buildStructMember(std::shared_ptr<AstStruct> str, int tk) {
         return false;
     }
     
-    std::shared_ptr<AstDataType> dataType = buildDataType();
+    AstDataType *dataType = buildDataType();
         
     // If its an array, build that. Otherwise, build the default value
     tk = lex->get_next();
         
     if (tk == t_assign) {
-        std::shared_ptr<AstExpression> expr = buildExpression(nullptr, dataType, t_semicolon, true);
+        AstExpression *expr = buildExpression(nullptr, dataType, t_semicolon, true);
         if (!expr) return false;
                 
-        Var v;
-        v.name = valName;
-        v.type = dataType;
+        Var v(dataType, valName);
         str->addItem(v, expr);
     } else {
         syntax->addError(lex->line_number, "Expected default value.");
@@ -165,9 +163,9 @@ bool Parser::buildStructMember(std::shared_ptr<AstStruct> str, int tk) {
     return true;
 }
 
-bool Parser::buildStructDec(std::shared_ptr<AstBlock> block) {
+bool Parser::buildStructDec(AstBlock *block) {
     int tk = lex->get_next();
-    std::string name = lex->value;
+    std::string name(lex->value);
     
     if (tk != t_id) {
         syntax->addError(lex->line_number, "Expected structure name.");
@@ -181,7 +179,7 @@ bool Parser::buildStructDec(std::shared_ptr<AstBlock> block) {
     }
     
     tk = lex->get_next();
-    std::string structName = lex->value;
+    std::string structName(lex->value);
     
     if (tk != t_id) {
         syntax->addError(lex->line_number, "Expected structure type.");
@@ -189,7 +187,7 @@ bool Parser::buildStructDec(std::shared_ptr<AstBlock> block) {
     }
     
     // Make sure the given structure exists
-    std::shared_ptr<AstStruct> str = nullptr;
+    AstStruct *str = nullptr;
     
     for (auto s : tree->structs) {
         if (s->name == structName) {
@@ -205,7 +203,7 @@ bool Parser::buildStructDec(std::shared_ptr<AstBlock> block) {
     
     // Now build the declaration and push back
     block->addSymbol(name, AstBuilder::buildStructType(structName));
-    std::shared_ptr<AstStructDec> dec = std::make_shared<AstStructDec>(name, structName);
+    AstStructDec *dec = AstArena::make<AstStructDec>(name, structName);
     block->addStatement(dec);
     
     // Final syntax check
@@ -214,12 +212,12 @@ bool Parser::buildStructDec(std::shared_ptr<AstBlock> block) {
         return true;
     } else if (tk == t_assign) {
         dec->no_init = true;
-        std::shared_ptr<AstExprStatement> empty = std::make_shared<AstExprStatement>();
-        std::shared_ptr<AstExpression> arg = buildExpression(block, AstBuilder::buildStructType(structName), t_semicolon);
+        AstExprStatement *empty = AstArena::make<AstExprStatement>();
+        AstExpression *arg = buildExpression(block, AstBuilder::buildStructType(structName), t_semicolon);
         if (!arg) return false;
         
-        std::shared_ptr<AstID> id = std::make_shared<AstID>(name);
-        std::shared_ptr<AstAssignOp> assign = std::make_shared<AstAssignOp>(id, arg);
+        AstID *id = AstArena::make<AstID>(name);
+        AstAssignOp *assign = AstArena::make<AstAssignOp>(id, arg);
         
         empty->expression = assign;
         block->addStatement(empty);
@@ -236,7 +234,7 @@ bool Parser::buildStructDec(std::shared_ptr<AstBlock> block) {
 //
 bool Parser::buildClass() {
     int token = lex->get_next();
-    std::string name = lex->value;
+    std::string name(lex->value);
     std::string baseClass = "";
     
     if (token != t_id) {
@@ -264,15 +262,15 @@ bool Parser::buildClass() {
         return false;
     }
     
-    auto clazzStruct = std::make_shared<AstStruct>(name);
+    auto clazzStruct = AstArena::make<AstStruct>(name);
     tree->addStruct(clazzStruct);
     
-    auto clazz = std::make_shared<AstClass>(name);
+    auto clazz = AstArena::make<AstClass>(name);
     currentClass = clazz;
     
     if (baseClass != "") {
         // First, build the inherited structure
-        std::shared_ptr<AstStruct> baseStruct = nullptr;
+        AstStruct *baseStruct = nullptr;
         for (auto s : tree->structs) {
             if (s->name == baseClass) {
                 baseStruct = s;
@@ -290,7 +288,7 @@ bool Parser::buildClass() {
         }
         
         // Next, build the inherited class
-        std::shared_ptr<AstClass> baseAstClass = nullptr;
+        AstClass *baseAstClass = nullptr;
         for (auto c : tree->classes) {
             if (c->name == baseClass) {
                 baseAstClass = c;
@@ -311,12 +309,12 @@ bool Parser::buildClass() {
             std::string newName = name + "_" + func->name;
             
             // Copy it
-            auto func2 = std::make_shared<AstFunction>(newName);
+            auto func2 = AstArena::make<AstFunction>(newName);
             func2->data_type = func->data_type;
             func2->args = func->args;
             tree->addGlobalStatement(func2);
             
-            std::shared_ptr<AstBlock> block2 = func->block;
+            AstBlock *block2 = func->block;
             func2->block->addStatements(block2->getBlock());
         }
     }
@@ -352,9 +350,9 @@ bool Parser::buildClass() {
 // Builds a class declaration
 // A class declaration is basically a structure declaration with a function call
 //
-bool Parser::buildClassDec(std::shared_ptr<AstBlock> block) {
+bool Parser::buildClassDec(AstBlock *block) {
     int token = lex->get_next();
-    std::string name = lex->value;
+    std::string name(lex->value);
     
     if (token != t_id) {
         syntax->addError(lex->line_number, "Expected class name.");
@@ -368,7 +366,7 @@ bool Parser::buildClassDec(std::shared_ptr<AstBlock> block) {
     }
     
     token = lex->get_next();
-    std::string className = lex->value;
+    std::string className(lex->value);
     
     if (token != t_id) {
         syntax->addError(lex->line_number, "Expected class name.");
@@ -377,7 +375,7 @@ bool Parser::buildClassDec(std::shared_ptr<AstBlock> block) {
     
     // Make sure the structure exists, and names a class
     // TODO: Do the class check
-    std::shared_ptr<AstStruct> str = nullptr;
+    AstStruct *str = nullptr;
     
     for (auto s : tree->structs) {
         if (s->name == className) {
@@ -394,25 +392,25 @@ bool Parser::buildClassDec(std::shared_ptr<AstBlock> block) {
     // Build the structure declaration
     if (java) {
         auto data_type = AstBuilder::buildObjectType(className);
-        auto dec = std::make_shared<AstVarDec>(name, data_type);
+        auto dec = AstArena::make<AstVarDec>(name, data_type);
         dec->class_name = className;
         block->addStatement(dec);
         
         classMap[name] = className;
         
     } else {
-        auto dec = std::make_shared<AstStructDec>(name, className);
+        auto dec = AstArena::make<AstStructDec>(name, className);
         block->addStatement(dec);
         
         classMap[name] = className;
         
         // Call the constructor
-        auto classRef = std::make_shared<AstID>(name);
-        auto args = std::make_shared<AstExprList>();
+        auto classRef = AstArena::make<AstID>(name);
+        auto args = AstArena::make<AstExprList>();
         args->add_expression(classRef);
         
         std::string constructor = className + "_" + className;
-        auto fc = std::make_shared<AstFuncCallStmt>(constructor);
+        auto fc = AstArena::make<AstFuncCallStmt>(constructor);
         block->addStatement(fc);
         fc->expression = args;
     }
@@ -14,10 +14,10 @@
 #include <lex/lex.hpp>
 
 // Builds a variable declaration
-bool Parser::buildVariableDec(std::shared_ptr<AstBlock> block) {
+bool Parser::buildVariableDec(AstBlock *block) {
     int tk = lex->get_next();
     std::vector<std::string> toDeclare;
-    toDeclare.push_back(lex->value);
+    toDeclare.push_back(std::string(lex->value));
     
     if (tk != t_id) {
         syntax->addError(lex->line_number, "Expected variable name.");
@@ -35,7 +35,7 @@ bool Parser::buildVariableDec(std::shared_ptr<AstBlock> block) {
                 return false;
             }
             
-            toDeclare.push_back(lex->value);
+            toDeclare.push_back(std::string(lex->value));
         } else if (tk != t_colon) {
             syntax->addError(lex->line_number, "Invalt_id tk in variable declaration.");
             return false;
@@ -44,7 +44,7 @@ bool Parser::buildVariableDec(std::shared_ptr<AstBlock> block) {
         tk = lex->get_next();
     }
     
-    std::shared_ptr<AstDataType> dataType = buildDataType(false);
+    AstDataType *dataType = buildDataType(false);
     tk = lex->get_next();
     
     // We're at the end of the declaration
@@ -53,17 +53,17 @@ bool Parser::buildVariableDec(std::shared_ptr<AstBlock> block) {
         return false;
     }
     
-    std::shared_ptr<AstExpression> arg = buildExpression(block, dataType, t_semicolon);
+    AstExpression *arg = buildExpression(block, dataType, t_semicolon);
     if (!arg) return false;
 
     for (std::string name : toDeclare) {
-        std::shared_ptr<AstVarDec> vd = std::make_shared<AstVarDec>(name, dataType);
+        AstVarDec *vd = AstArena::make<AstVarDec>(name, dataType);
         block->addStatement(vd);
         
-        std::shared_ptr<AstID> id = std::make_shared<AstID>(name);
-        std::shared_ptr<AstAssignOp> assign = std::make_shared<AstAssignOp>(id, arg);
+        AstID *id = AstArena::make<AstID>(name);
+        AstAssignOp *assign = AstArena::make<AstAssignOp>(id, arg);
         
-        std::shared_ptr<AstExprStatement> va = std::make_shared<AstExprStatement>();
+        AstExprStatement *va = AstArena::make<AstExprStatement>();
         va->setDataType(dataType);
         va->expression = assign;
         block->addStatement(va);
@@ -78,16 +78,16 @@ bool Parser::buildVariableDec(std::shared_ptr<AstBlock> block) {
 //
 // Builds an array declaration
 //
-bool Parser::build_array_dec(std::shared_ptr<AstBlock> block) {
+bool Parser::build_array_dec(AstBlock *block) {
     // Get the array name
     consume_token(t_id, "Expected array name.");
-    std::string name = lex->value;
+    std::string name(lex->value);
     
     // Get the colon
     consume_token(t_colon, "Expected \':\'.");
     
     // Build the data type
-    std::shared_ptr<AstDataType> base_type = buildDataType(false);
+    AstDataType *base_type = buildDataType(false);
     
     // Get the bracket
     consume_token(t_lbracket, "Expected opening \'[\'.");
@@ -96,7 +96,7 @@ bool Parser::build_array_dec(std::shared_ptr<AstBlock> block) {
     std::string data_type_name = getArrayType(base_type);
     auto data_type = AstBuilder::buildStructType(data_type_name);
     
-    std::shared_ptr<AstExpression> size_arg = buildExpression(block, AstBuilder::buildInt32Type(), t_rbracket);
+    AstExpression *size_arg = buildExpression(block, AstBuilder::buildInt32Type(), t_rbracket);
     if (!size_arg) {
         syntax->addError(lex->line_number, "Invalid size argument in array declaration");
         return false;
@@ -105,38 +105,38 @@ bool Parser::build_array_dec(std::shared_ptr<AstBlock> block) {
     // Consume the semicolon
     consume_token(t_semicolon, "Expected \';\'");
     
-    std::shared_ptr<AstStructDec> dec = std::make_shared<AstStructDec>(name, data_type_name);
+    AstStructDec *dec = AstArena::make<AstStructDec>(name, data_type_name);
     dec->no_init = true;
     block->addStatement(dec);
     
     //
     // Malloc
     //
-    auto list = std::make_shared<AstExprList>();
+    auto list = AstArena::make<AstExprList>();
     
     // Get the size
-    //std::shared_ptr<AstI32> size = std::make_shared<AstI32>(4);
-    std::shared_ptr<AstInt> size;
-    if (base_type->type == V_AstType::Int32) size = std::make_shared<AstInt>(4);
-    else if (base_type->type == V_AstType::Int64) size = std::make_shared<AstInt>(8);
-    else if (base_type->type == V_AstType::String) size = std::make_shared<AstInt>(8);
-    else size = std::make_shared<AstInt>(1);
-    
-    auto mul_op = std::make_shared<AstMulOp>();
+    //AstI32 *size = AstArena::make<AstI32>(4);
+    AstInt *size = nullptr;
+    if (base_type->type == V_AstType::Int32) size = AstArena::make<AstInt>(4);
+    else if (base_type->type == V_AstType::Int64) size = AstArena::make<AstInt>(8);
+    else if (base_type->type == V_AstType::String) size = AstArena::make<AstInt>(8);
+    else size = AstArena::make<AstInt>(1);
+    
+    auto mul_op = AstArena::make<AstMulOp>();
     mul_op->lval = size;
     mul_op->rval = size_arg;
     list->add_expression(mul_op);
     
     // Create the malloc call
-    auto call_malloc = std::make_shared<AstFuncCallExpr>("gc_alloc");
+    auto call_malloc = AstArena::make<AstFuncCallExpr>("gc_alloc");
     call_malloc->args = list;
     
-    auto lval_alloc = std::make_shared<AstStructAccess>(name, "ptr");
-    auto op1 = std::make_shared<AstAssignOp>();
+    auto lval_alloc = AstArena::make<AstStructAccess>(name, "ptr");
+    auto op1 = AstArena::make<AstAssignOp>();
     op1->lval = lval_alloc;
     op1->rval = call_malloc;
     
-    auto va_ptr = std::make_shared<AstExprStatement>();
+    auto va_ptr = AstArena::make<AstExprStatement>();
     va_ptr->setDataType(data_type);
     va_ptr->expression = op1;
     block->addStatement(va_ptr);
@@ -145,13 +145,13 @@ bool Parser::build_array_dec(std::shared_ptr<AstBlock> block) {
     // Set the size
     //
     // expression
-    auto lval_size = std::make_shared<AstStructAccess>(name, "size");
-    auto op = std::make_shared<AstAssignOp>();
+    auto lval_size = AstArena::make<AstStructAccess>(name, "size");
+    auto op = AstArena::make<AstAssignOp>();
     op->lval = lval_size;
     op->rval = size_arg;
     
     // The statement
-    auto va_size = std::make_shared<AstExprStatement>();
+    auto va_size = AstArena::make<AstExprStatement>();
     va_size->setDataType(data_type);
     va_size->expression = op;
     block->addStatement(va_size);
@@ -162,20 +162,20 @@ bool Parser::build_array_dec(std::shared_ptr<AstBlock> block) {
 }
 
 // Builds a variable or an array assignment
-bool Parser::buildVariableAssign(std::shared_ptr<AstBlock> block, std::string value) {
-    std::shared_ptr<AstDataType> data_type = block->getDataType(value);
+bool Parser::buildVariableAssign(AstBlock *block, std::string value) {
+    AstDataType *data_type = block->getDataType(value);
     
-    std::shared_ptr<AstExpression> expr = buildExpression(block, data_type, t_semicolon);
+    AstExpression *expr = buildExpression(block, data_type, t_semicolon);
     if (!expr) return false;
     
     if (java && expr->type == V_AstType::FuncCallExpr) {
-        auto fc = std::static_pointer_cast<AstFuncCallExpr>(expr);
-        auto stmt = std::make_shared<AstFuncCallStmt>(fc->name);
+        auto fc = static_cast<AstFuncCallExpr *>(expr);
+        auto stmt = AstArena::make<AstFuncCallStmt>(fc->name);
         stmt->object_name = fc->object_name;
         //stmt->expression = fc->args;
         block->addStatement(stmt);
     } else {
-        auto stmt = std::make_shared<AstExprStatement>();
+        auto stmt = AstArena::make<AstExprStatement>();
         stmt->setDataType(data_type);
         stmt->expression = expr;
         block->addStatement(stmt);
@@ -185,30 +185,26 @@ bool Parser::buildVariableAssign(std::shared_ptr<AstBlock> block, std::string va
 }
 
 // Builds a constant variable
-bool Parser::buildConst(std::shared_ptr<AstBlock> block, bool isGlobal) {
+bool Parser::buildConst(AstBlock *block, bool isGlobal) {
     // Make sure we have a name for our constant
     consume_token(t_id, "Expected constant name.");
-    std::string name = lex->value;
+    std::string name(lex->value);
     
     // Syntax check
     consume_token(t_colon, "Expected \':\' in constant expression.");
     
     // Get the data type
-    std::shared_ptr<AstDataType> dataType = buildDataType(false);
+    AstDataType *dataType = buildDataType(false);
     
     // Final syntax check
     consume_token(t_assign, "Expected \'=\' after const assignment.");
     
     // Build the expression. We create a dummy statement for this
-    std::shared_ptr<AstExpression> expr = buildExpression(nullptr, dataType, t_semicolon, true);
+    AstExpression *expr = buildExpression(nullptr, dataType, t_semicolon, true);
     if (!expr) return false;
     
     // Put it all together
-    if (isGlobal) {
-        block->globalConsts[name] = std::pair<std::shared_ptr<AstDataType>, std::shared_ptr<AstExpression>>(dataType, expr);
-    } else {
-        block->localConsts[name] = std::pair<std::shared_ptr<AstDataType>, std::shared_ptr<AstExpression>>(dataType, expr);
-    }
+    block->addConstant(name, dataType, expr, isGlobal);
     
     return true;
 }
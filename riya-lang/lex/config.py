@@ -20,6 +20,8 @@ keywords = [
     ("t_u32", "u32"),
     ("t_i64", "i64"),
     ("t_u64", "u64"),
+    ("t_f32", "f32"),
+    ("t_f64", "f64"),
     ("t_if", "if"),
     ("t_elif", "elif"),
     ("t_else", "else"),
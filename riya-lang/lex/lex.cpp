@@ -1,16 +1,561 @@
 #include <iostream>
-#include <cctype>
+#include <cstdint>
+#include <charconv>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "lex.hpp"
 
+//
+// What the scanner does when it stops in an accepting state
+//
+enum lex_action : uint8_t {
+    a_none,         // Not an accepting state
+    a_token,        // A keyword or symbol; the token is in lex_tokens
+    a_id,
+    a_int,
+    a_hex,
+    a_float,
+    a_string,
+    a_char,
+    a_skip,         // Whitespace and comments
+    a_newline,
+};
+
+//
+// The DFA tables
+// State 0 is the dead state, and state 1 is where every token starts.
+//
+static constexpr int LEX_STATES = 152;
+static constexpr int LEX_CLASSES = 59;
+
+static constexpr uint8_t lex_classes[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 3, 4, 5, 0, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 22, 23, 22, 24, 22, 25, 26, 27, 28, 29, 0,
+	0, 30, 30, 30, 30, 30, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 32, 33, 34, 0,
+	0, 35, 36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 45, 46, 47, 48,
+	49, 0, 50, 51, 52, 53, 54, 55, 56, 57, 0, 0, 58, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static constexpr uint8_t lex_transitions[LEX_STATES][LEX_CLASSES] = {
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 37, 2, 3, 33, 5, 4, 23, 24, 8, 15, 16, 21, 19, 14, 20, 12, 22, 39, 38, 38, 38, 38, 38, 38, 38, 27, 13, 30, 32, 28, 37, 17, 37, 18, 26, 69, 79, 74, 125, 42, 48, 37, 37, 89, 37, 37, 37, 37, 150, 37, 60, 52, 121, 91, 66, 115, 37, 37, 25 },
+	{ 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 },
+	{ 5, 5, 5, 5, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+	{ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10 },
+	{ 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10 },
+	{ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 38, 38, 38, 38, 38, 38, 38, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 38, 38, 38, 38, 38, 38, 38, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 40, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 41, 41, 41, 41, 41, 41, 41, 0, 0, 0, 0, 0, 41, 0, 37, 0, 0, 41, 41, 41, 41, 41, 41, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 41, 41, 41, 41, 41, 41, 41, 0, 0, 0, 0, 0, 41, 0, 37, 0, 0, 41, 41, 41, 41, 41, 41, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 110, 37, 58, 37, 37, 37, 37, 37, 37, 37, 37, 43, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 44, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 45, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 46, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 47, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 105, 37, 37, 107, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 144, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 49, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 50, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 51, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 53, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 54, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 86, 37, 37, 37, 37, 37, 37, 37, 37, 37, 55, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 56, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 57, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 59, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 61, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 62, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 63, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 64, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 65, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 67, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 68, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 148, 37, 37, 70, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 71, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 72, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 73, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 83, 37, 37, 37, 37, 37, 75, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 76, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 77, 131, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 78, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 80, 37, 127, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 81, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 82, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 84, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 85, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 87, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 88, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 93, 37, 97, 37, 37, 101, 90, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 109, 37, 37, 37, 37, 37, 136, 37, 37, 37, 37, 120, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 95, 37, 99, 37, 37, 103, 92, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 94, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 96, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 98, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 100, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 102, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 104, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 106, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 108, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 111, 37, 37, 37, 37, 37, 37, 37, 113, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 112, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 114, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 116, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 117, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 118, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 119, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 122, 37, 37, 37, 37, 37, 37, 37, 141, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 123, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 124, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 126, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 128, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 129, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 130, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 132, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 133, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 134, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 135, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 137, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 138, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 139, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 140, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 142, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 143, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 145, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 146, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 147, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 149, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 151, 37, 37, 37, 37, 37, 37, 37, 0 },
+	{ 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 0, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0 },
+};
+
+static constexpr lex_action lex_actions[LEX_STATES] = {
+	a_none,
+	a_none,
+	a_skip,
+	a_newline,
+	a_skip,
+	a_none,
+	a_none,
+	a_string,
+	a_none,
+	a_none,
+	a_none,
+	a_char,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_token,
+	a_id,
+	a_int,
+	a_int,
+	a_id,
+	a_hex,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_id,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+	a_id,
+	a_token,
+};
+
+static constexpr token lex_tokens[LEX_STATES] = {
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_dot,
+	t_semicolon,
+	t_comma,
+	t_lparen,
+	t_rparen,
+	t_lbracket,
+	t_rbracket,
+	t_plus,
+	t_minus,
+	t_mul,
+	t_div,
+	t_mod,
+	t_and,
+	t_or,
+	t_xor,
+	t_colon,
+	t_gt,
+	t_gte,
+	t_lt,
+	t_lte,
+	t_eq,
+	t_none,
+	t_neq,
+	t_assign,
+	t_arrow,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_extern,
+	t_none,
+	t_none,
+	t_none,
+	t_func,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_struct,
+	t_none,
+	t_end,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_return,
+	t_none,
+	t_none,
+	t_var,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_array,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_const,
+	t_none,
+	t_none,
+	t_none,
+	t_bool,
+	t_none,
+	t_none,
+	t_char,
+	t_none,
+	t_none,
+	t_string,
+	t_none,
+	t_i8,
+	t_none,
+	t_u8,
+	t_none,
+	t_i16,
+	t_none,
+	t_u16,
+	t_none,
+	t_i32,
+	t_none,
+	t_u32,
+	t_none,
+	t_i64,
+	t_none,
+	t_u64,
+	t_none,
+	t_f32,
+	t_none,
+	t_f64,
+	t_if,
+	t_none,
+	t_none,
+	t_elif,
+	t_none,
+	t_else,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_while,
+	t_is,
+	t_none,
+	t_none,
+	t_none,
+	t_then,
+	t_none,
+	t_do,
+	t_none,
+	t_none,
+	t_none,
+	t_break,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_continue,
+	t_none,
+	t_none,
+	t_none,
+	t_none,
+	t_import,
+	t_none,
+	t_none,
+	t_true,
+	t_none,
+	t_none,
+	t_none,
+	t_false,
+	t_none,
+	t_lgand,
+	t_none,
+	t_lgor,
+};
+
 //
 // Setups the lexical analyzer
+// Regular files are mapped straight into memory. Anything that can't be
+// mapped (such as a pipe) is read into a buffer in one go instead.
 //
 Lex::Lex(std::string input) {
-    reader = std::ifstream(input);
-    if (!reader.is_open()) {
-        // TODO
+    int fd = open(input.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error: Unable to open file: " << input << std::endl;
+        return;
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        void *data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            map = (char *)data;
+            map_size = info.st_size;
+        }
+    }
+    
+    if (map) {
+        pos = map;
+        end = map + map_size;
+    } else {
+        char chunk[8192];
+        ssize_t size;
+        while ((size = read(fd, chunk, sizeof(chunk))) > 0) {
+            contents.append(chunk, size);
+        }
+        
+        pos = contents.data();
+        end = contents.data() + contents.size();
     }
+    
+    close(fd);
+}
+
+Lex::~Lex() {
+    if (map) munmap(map, map_size);
 }
 
 //
@@ -22,6 +567,8 @@ void Lex::unget(int t) {
 
 //
 // Get the next token in the stream
+// The scanner follows the DFA for as long as it can, and then backs up to
+// the last accepting state it went through.
 //
 int Lex::get_next() {
     if (!token_stack.empty()) {
@@ -29,275 +576,126 @@ int Lex::get_next() {
         token_stack.pop();
         return t;
     }
-
-    if (reader.eof()) {
-        return t_eof;
-    }
     
-    while (!reader.eof()) {
-        char c = reader.get();
-        if (!reader.eof()) raw_buffer += c;
+    while (pos < end) {
+        const char *start = pos;
+        const char *current = pos;
+        const char *accept_pos = nullptr;
+        int accept_state = 0;
+        int state = 1;
         
-        if (c == '#') {
-            c = reader.get();
-            raw_buffer += c;
-            while (c != '\n' && !reader.eof()) {
-                c = reader.get();
-                raw_buffer += c;
-            }
-            ++line_number;
-        }
-        
-        if (c == '\"') {
-            value = "";
+        while (current < end) {
+            state = lex_transitions[state][lex_classes[(unsigned char)*current]];
+            if (state == 0) break;
+            ++current;
             
-            c = reader.get();
-            raw_buffer += c;
-            while (c != '\"' && !reader.eof()) {
-                if (c == '\\') {
-                    c = reader.get();
-                    if (c == 'n') {
-                        value += '\n';
-                    } else {
-                        value += '\\';
-                        value += c;
-                    }
-                } else {
-                    value += c;
-                }
-                c = reader.get();   
+            if (lex_actions[state] != a_none) {
+                accept_state = state;
+                accept_pos = current;
             }
-            
-            return t_string_literal;
         }
         
-        if (c == '\'') {
-            c = reader.get();
-            if (c == '\\') {
-                c = reader.get();
-                if (c == 'n') {
-                    c = '\n';
-                }
-            }
-            
-            token t = t_char_literal;
-            i_value = (char)c;
-            value = "";
-            value += c;
-            
-            reader.get();
-            return t;
+        // Nothing matched, so skip over the character
+        if (accept_pos == nullptr) {
+            pos = start + 1;
+            continue;
         }
         
+        pos = accept_pos;
+        std::string_view text(start, pos - start);
         
-        if (c == ' ' || c == '\n' || is_symbol(c)) {
-            if (c == '\n') ++line_number;
-        
-            if (is_symbol(c)) {
-                token sym = get_symbol(c);
-                if (buffer == "") {
-                    return sym;
-                }
-                token_stack.push(sym);
+        switch (lex_actions[accept_state]) {
+            case a_token: return lex_tokens[accept_state];
+            
+            case a_id: {
+                value = text;
+                id = Symbol::intern(text);
+                return t_id;
             }
             
-            if (buffer == "") continue;
+            case a_int: {
+                value = text;
+                i_value = 0;
+                auto result = std::from_chars(text.data(), text.data() + text.size(), i_value);
+                i_overflow = result.ec != std::errc();
+                return t_int_literal;
+            }
             
-            token t = t_none;
-			if (buffer == "extern") t = t_extern;
-			else if (buffer == "func") t = t_func;
-			else if (buffer == "struct") t = t_struct;
-			else if (buffer == "end") t = t_end;
-			else if (buffer == "return") t = t_return;
-			else if (buffer == "var") t = t_var;
-			else if (buffer == "array") t = t_array;
-			else if (buffer == "const") t = t_const;
-			else if (buffer == "bool") t = t_bool;
-			else if (buffer == "char") t = t_char;
-			else if (buffer == "string") t = t_string;
-			else if (buffer == "i8") t = t_i8;
-			else if (buffer == "u8") t = t_u8;
-			else if (buffer == "i16") t = t_i16;
-			else if (buffer == "u16") t = t_u16;
-			else if (buffer == "i32") t = t_i32;
-			else if (buffer == "u32") t = t_u32;
-			else if (buffer == "i64") t = t_i64;
-			else if (buffer == "u64") t = t_u64;
-			else if (buffer == "if") t = t_if;
-			else if (buffer == "elif") t = t_elif;
-			else if (buffer == "else") t = t_else;
-			else if (buffer == "while") t = t_while;
-			else if (buffer == "is") t = t_is;
-			else if (buffer == "then") t = t_then;
-			else if (buffer == "do") t = t_do;
-			else if (buffer == "break") t = t_break;
-			else if (buffer == "continue") t = t_continue;
-			else if (buffer == "import") t = t_import;
-			else if (buffer == "true") t = t_true;
-			else if (buffer == "false") t = t_false;
-			else if (buffer == "and") t = t_lgand;
-			else if (buffer == "or") t = t_lgor;
-            else if (is_integer()) {
-                t = t_int_literal;
-                value = buffer;
-                i_value = std::stoi(buffer);
-            } else if (is_hex()) {
-                t = t_int_literal;
-                value = buffer;
-                i_value = std::stoi(buffer, 0, 16);
-            } else if (is_float()) {
-                t = t_float_literal;
-                value = buffer;
-                f_value = std::stod(buffer);
-            } else {
-                t = t_id;
-                value = buffer;
+            case a_hex: {
+                value = text;
+                i_value = 0;
+                auto result = std::from_chars(text.data() + 2, text.data() + text.size(), i_value, 16);
+                i_overflow = result.ec != std::errc();
+                return t_int_literal;
             }
             
-            buffer = "";
-            return t;
-        } else {
-            buffer += c;
+            case a_float: {
+                value = text;
+                f_value = 0;
+                std::from_chars(text.data(), text.data() + text.size(), f_value);
+                return t_float_literal;
+            }
+            
+            case a_string: return get_string_literal(text);
+            case a_char: return get_char_literal(text);
+            
+            case a_newline: ++line_number; break;
+            default: {}
         }
     }
     
     return t_eof;
 }
 
-std::string Lex::get_raw_buffer() {
-    std::string ret = raw_buffer;
-    raw_buffer = "";
-    return ret;
-}
-
-bool Lex::is_symbol(char c) {
-    switch (c) {
-		case '.': return true;
-		case ';': return true;
-		case ',': return true;
-		case '(': return true;
-		case ')': return true;
-		case '[': return true;
-		case ']': return true;
-		case '+': return true;
-		case '-': return true;
-		case '*': return true;
-		case '/': return true;
-		case '%': return true;
-		case '&': return true;
-		case '|': return true;
-		case '^': return true;
-		case ':': return true;
-		case '>': return true;
-		case '<': return true;
-		case '=': return true;
-		case '!': return true;
-        
-        default: return false;
-    }
-    return false;
-}
-
-token Lex::get_symbol(char c) {
-    switch (c) {
-		case '.': return t_dot;
-		case ';': return t_semicolon;
-		case ',': return t_comma;
-		case '(': return t_lparen;
-		case ')': return t_rparen;
-		case '[': return t_lbracket;
-		case ']': return t_rbracket;
-		case '+': return t_plus;
-		case '-': {
-			char c2 = reader.get();
-			if (c2 == '>') {
-				raw_buffer += c2;
-				return t_arrow;
-			} else {
-				reader.unget();
-				return t_minus;
-			}
-		} break;
-		case '*': return t_mul;
-		case '/': return t_div;
-		case '%': return t_mod;
-		case '&': return t_and;
-		case '|': return t_or;
-		case '^': return t_xor;
-		case ':': {
-			char c2 = reader.get();
-			if (c2 == '=') {
-				raw_buffer += c2;
-				return t_assign;
-			} else {
-				reader.unget();
-				return t_colon;
-			}
-		} break;
-		case '>': {
-			char c2 = reader.get();
-			if (c2 == '=') {
-				raw_buffer += c2;
-				return t_gte;
-			} else {
-				reader.unget();
-				return t_gt;
-			}
-		} break;
-		case '<': {
-			char c2 = reader.get();
-			if (c2 == '=') {
-				raw_buffer += c2;
-				return t_lte;
-			} else {
-				reader.unget();
-				return t_lt;
-			}
-		} break;
-		case '=': return t_eq;
-		case '!': {
-			char c2 = reader.get();
-			if (c2 == '=') {
-				raw_buffer += c2;
-				return t_neq;
-			} else {
-				reader.unget();
-			}
-		} break;
-        default: return t_none;
-    }
-    return t_none;
-}
-
-bool Lex::is_integer() {
-    for (char c : buffer) {
-        if (!isdigit(c)) return false;
+//
+// Builds the value of a string literal from its text, quotes and all
+// Only literals with escapes need to be copied out of the file.
+//
+token Lex::get_string_literal(std::string_view text) {
+    text.remove_prefix(1);
+    text.remove_suffix(1);
+    
+    if (text.find('\\') == std::string_view::npos) {
+        value = text;
+        return t_string_literal;
     }
-    return true;
-}
-
-bool Lex::is_hex() {
-    if (buffer.length() < 3) return false;
-    if (buffer[0] != '0' || buffer[1] != 'x') return false;
     
-    for (int i = 2; i<buffer.length(); i++) {
-        if (!isxdigit(buffer[i])) return false;
+    literal = "";
+    for (size_t i = 0; i<text.size(); i++) {
+        char c = text[i];
+        if (c == '\\' && i + 1 < text.size()) {
+            c = text[++i];
+            if (c == 'n') {
+                literal += '\n';
+            } else {
+                literal += '\\';
+                literal += c;
+            }
+        } else {
+            literal += c;
+        }
     }
-    return true;
+    
+    value = literal;
+    return t_string_literal;
 }
 
-bool Lex::is_float() {
-    bool foundDot = false;
-    for (char c : buffer) {
-        if (c == '.') {
-            if (foundDot) return false;
-            foundDot = true;
-        } else if (!isdigit(c)) {
-            return false;
+//
+// Builds the value of a character literal from its text, quotes and all
+//
+token Lex::get_char_literal(std::string_view text) {
+    char c = text[1];
+    if (c == '\\') {
+        c = text[2];
+        if (c == 'n') {
+            c = '\n';
         }
     }
-    if (!foundDot) return false;
-    return true;
+    
+    i_value = (char)c;
+    literal = c;
+    value = literal;
+    return t_char_literal;
 }
 
 //
@@ -327,6 +725,8 @@ void Lex::debug_token(int t) {
 		case t_u32: std::cout << "u32" << std::endl; break;
 		case t_i64: std::cout << "i64" << std::endl; break;
 		case t_u64: std::cout << "u64" << std::endl; break;
+		case t_f32: std::cout << "f32" << std::endl; break;
+		case t_f64: std::cout << "f64" << std::endl; break;
 		case t_if: std::cout << "if" << std::endl; break;
 		case t_elif: std::cout << "elif" << std::endl; break;
 		case t_else: std::cout << "else" << std::endl; break;
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <string>
-#include <fstream>
+#include <string_view>
 #include <stack>
 
 #include <parser/base_lex.hpp>
@@ -32,6 +32,8 @@ enum token {
 	t_u32,
 	t_i64,
 	t_u64,
+	t_f32,
+	t_f64,
 	t_if,
 	t_elif,
 	t_else,
@@ -81,25 +83,28 @@ enum token {
 
 //
 // The lexical analyzer
+// This version is driven by the DFA tables that lex.py generates from the
+// language config, so nothing in here is specific to one language.
 //
 struct Lex : BaseLex {
     explicit Lex(std::string input);
+    ~Lex();
     void unget(int t) override;
     int get_next() override;
     void debug_token(int t) override;
-    
-    std::string get_raw_buffer();
 private:
-    std::ifstream reader;
-    std::string buffer = "";
-    std::string raw_buffer = "";
+    // The whole file is mapped into memory (or read in, if it can't be
+    // mapped), and the lexer walks through it with a pointer.
+    char *map = nullptr;
+    size_t map_size = 0;
+    std::string contents = "";
+    const char *pos = nullptr;
+    const char *end = nullptr;
+    
+    std::string literal = "";
     std::stack<token> token_stack;
     
     // Internal functions
-    bool is_symbol(char c);
-    token get_symbol(char c);
-    bool is_integer();
-    bool is_hex();
-    bool is_float();
+    token get_string_literal(std::string_view text);
+    token get_char_literal(std::string_view text);
 };
-
@@ -8,12 +8,16 @@
 #include <cstdio>
 #include <memory>
 #include <cstdlib>
+#include <sys/mman.h>
 
 #include <parser/Parser.hpp>
 #include <ast/ast.hpp>
 #include <midend/midend.hpp>
+#include <midend/escape_midend.hpp>
 
 #include <llvm/Compiler.hpp>
+#include <llvm/Jit.hpp>
+#include <llvm/TimeReport.hpp>
 
 bool isError = false;
 
@@ -27,21 +31,40 @@ std::shared_ptr<AstTree> getAstTree(std::string input, bool testLex, bool printA
         return nullptr;
     }
     
+    // The parser pulls tokens as it goes, so the lexer is timed on its own
+    if (TimeReport::isEnabled()) {
+        TimePhase phase("lex", input);
+        Lex lex(input);
+        while (lex.get_next() != t_eof) {}
+    }
+    
+    TimePhase parsePhase("parse", input);
     if (!frontend->parse()) {
         isError = true;
         return nullptr;
     }
     
     tree = frontend->getTree();
+    parsePhase.stop();
     
     if (printAst1) {
         tree->print();
         return nullptr;
     }
     
+    TimePhase midendPhase("midend", input);
     std::unique_ptr<Midend> midend = std::make_unique<Midend>(tree);
     midend->run();
     tree = midend->tree;
+    midendPhase.stop();
+    
+    // Find the structures that can go on the stack
+    TimePhase escapePhase("escape midend", input);
+    std::unique_ptr<EscapeMidend> escape = std::make_unique<EscapeMidend>(tree);
+    escape->run();
+    escapePhase.stop();
+    
+    TimeReport::countNodes(tree);
     
     if (printAst) {
         tree->print();
@@ -56,42 +79,97 @@ std::shared_ptr<AstTree> getAstTree(std::string input, bool testLex, bool printA
     return tree;
 }
 
-void assemble(CFlags cflags) {
-    std::string cmd = "as /tmp/" + cflags.name + ".asm -o /tmp/" + cflags.name + ".o";
-    system(cmd.c_str());
-}
-
 #ifdef DEV_LINK_MODE
 
 #ifndef LINK_LOCATION
 #define LINK_LOCATION = "."
 #endif
 
-void link(CFlags cflags) {
+void link(CFlags cflags, std::string object) {
     std::string cmd = "ld ";
     cmd += std::string(LINK_LOCATION) + "/amd64_start.o ";
-    cmd += "/tmp/" + cflags.name + ".o -o " + cflags.name;
+    cmd += object + " -o " + cflags.name;
     cmd += " -L" + std::string(LINK_LOCATION) + "/corelib -lcorelib ";
     system(cmd.c_str());
     //printf("LINK: %s\n", cmd.c_str());
 }
 
+//
+// The start file talks to the kernel directly, so it can't be loaded into the
+// compiler. These stand in for it when running in-process.
+//
+extern "C" void jitOutput(char *input, int len) {
+    fwrite(input, 1, len, stdout);
+}
+
+extern "C" void *jitMapPages(unsigned long size) {
+    return mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+}
+
+extern "C" void jitUnmapPages(void *addr, unsigned long size) {
+    munmap(addr, size);
+}
+
+//
+// Runs the program in-process, without writing or linking anything
+//
+int runJit(std::shared_ptr<AstTree> tree, CFlags flags, std::string input) {
+    TimePhase irPhase("irgen", flags.name);
+    auto compiler = std::make_unique<Compiler>(tree, flags);
+    if (!compiler->compile()) return 1;
+    irPhase.stop();
+    
+    std::string error;
+    auto jit = Jit::create(error);
+    if (!jit) {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
+    }
+    
+    jit->addSymbol("output", (void *)&jitOutput);
+    jit->addSymbol("map_pages", (void *)&jitMapPages);
+    jit->addSymbol("unmap_pages", (void *)&jitUnmapPages);
+    jit->addArchive(std::string(LINK_LOCATION) + "/corelib/libcorelib.a");
+    
+    TimePhase jitPhase("jit", flags.name);
+    auto entry = (int (*)(char **, int))jit->compile(compiler.get(), "main");
+    if (!entry) {
+        std::cerr << "Error: " << jit->getError() << std::endl;
+        return 1;
+    }
+    
+    jitPhase.stop();
+    
+    TimePhase runPhase("run", flags.name);
+    char *argv[] = { (char *)input.c_str(), nullptr };
+    int code = entry(argv, 1);
+    fflush(stdout);
+    return code;
+}
+
 #else
 
-void link(CFlags cflags) {
+void link(CFlags cflags, std::string object) {
     /*std::string cmd = "ld ";
     cmd += "/usr/local/lib/tinylang/ti_start.o ";
-    cmd += "/tmp/" + cflags.name + ".o -o " + cflags.name;
+    cmd += object + " -o " + cflags.name;
     cmd += " -dynamic-linker /lib64/ld-linux-x86-64.so.2 ";
     cmd += "-ltinylang -lc";
     system(cmd.c_str());*/
 }
 
+int runJit(std::shared_ptr<AstTree> tree, CFlags flags, std::string input) {
+    std::cerr << "Error: --run needs the development runtime libraries." << std::endl;
+    return 1;
+}
+
 #endif
 
-int compileLLVM(std::shared_ptr<AstTree> tree, CFlags flags, bool printLLVM, bool emitLLVM) {
+int compileLLVM(std::shared_ptr<AstTree> tree, CFlags flags, bool printLLVM, bool emitLLVM, bool emitAsm, bool emitObject) {
+    TimePhase irPhase("irgen", flags.name);
     std::unique_ptr<Compiler> compiler = std::make_unique<Compiler>(tree, flags);
-    compiler->compile();
+    if (!compiler->compile()) return 1;
+    irPhase.stop();
         
     if (printLLVM) {
         compiler->debug();
@@ -107,10 +185,36 @@ int compileLLVM(std::shared_ptr<AstTree> tree, CFlags flags, bool printLLVM, boo
         compiler->emitLLVM(output);
         return 0;
     }
+    
+    if (emitAsm) {
+        std::string output = flags.name;
+        if (output == "a.out") {
+            output = "./out.s";
+        }
+        
+        if (!compiler->writeAssembly(output)) return 1;
+        return 0;
+    }
+    
+    if (emitObject) {
+        std::string output = flags.name;
+        if (output == "a.out") {
+            output = "./out.o";
+        }
         
-    compiler->writeAssembly();
-    assemble(flags);
-    link(flags);
+        if (!compiler->writeObject(output)) return 1;
+        return 0;
+    }
+    
+    // The object goes straight from the code generator to the linker
+    std::string object = compiler->writeTempObject();
+    if (object == "") return 1;
+    
+    TimePhase linkPhase("link", flags.name);
+    link(flags, object);
+    linkPhase.stop();
+    
+    remove(object.c_str());
     
     return 0;
 }
@@ -124,6 +228,7 @@ int main(int argc, char **argv) {
     // Compiler (codegen) flags
     CFlags flags;
     flags.name = "a.out";
+    flags.freestanding = true;
     
     // Other flags
     std::string input = "";
@@ -134,6 +239,11 @@ int main(int argc, char **argv) {
     bool emitDot = false;
     bool printLLVM = false;
     bool emitLLVM = false;
+    bool emitAsm = false;
+    bool emitObject = false;
+    bool runProgram = false;
+    bool timeReport = false;
+    std::string timeTrace = "";
     
     for (int i = 1; i<argc; i++) {
         std::string arg = argv[i];
@@ -152,9 +262,35 @@ int main(int argc, char **argv) {
             printLLVM = true;
         } else if (arg == "--emit-llvm") {
             emitLLVM = true;
+        } else if (arg == "-S") {
+            emitAsm = true;
+        } else if (arg == "-c") {
+            emitObject = true;
         } else if (arg == "-o") {
             flags.name = argv[i+1];
             i += 1;
+        } else if (arg == "-O0" || arg == "-O1" || arg == "-O2" || arg == "-O3") {
+            flags.opt_level = arg[2] - '0';
+        } else if (arg == "-O") {
+            flags.opt_level = 2;
+        } else if (arg == "--run") {
+            runProgram = true;
+        } else if (arg == "--time-report") {
+            timeReport = true;
+        } else if (arg == "--time-trace") {
+            if (i + 1 == argc) {
+                std::cerr << "Error: --time-trace needs a file." << std::endl;
+                return 1;
+            }
+            timeTrace = argv[i+1];
+            i += 1;
+        } else if (arg == "--codegen-threads") {
+            if (i + 1 == argc) {
+                std::cerr << "Error: --codegen-threads needs a thread count." << std::endl;
+                return 1;
+            }
+            flags.codegen_threads = atoi(argv[i+1]);
+            i += 1;
         } else if (arg[0] == '-') {
             std::cerr << "Invalid option: " << arg << std::endl;
             return 1;
@@ -163,13 +299,24 @@ int main(int argc, char **argv) {
         }
     }
     
+    TimeReport::enable(timeReport, timeTrace);
+    
     std::shared_ptr<AstTree> tree = getAstTree(input, testLex, printAst1, printAst, emitDot);
     if (tree == nullptr) {
         if (isError) return 1;
         return 0;
     }
-
-    // Compile
-    return compileLLVM(tree, flags, printLLVM, emitLLVM);
+    
+    int result = 0;
+    if (runProgram) {
+        // Compile and run in-process
+        result = runJit(tree, flags, input);
+    } else {
+        // Compile
+        result = compileLLVM(tree, flags, printLLVM, emitLLVM, emitAsm, emitObject);
+    }
+    
+    TimeReport::finish();
+    return result;
 }
 
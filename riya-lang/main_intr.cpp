@@ -12,6 +12,7 @@
 #include <parser/Parser.hpp>
 #include <ast/ast.hpp>
 #include <intr/interpreter.hpp>
+#include <intr/bytecode.hpp>
 
 int main(int argc, char **argv) {
     if (argc == 1) {
@@ -22,12 +23,28 @@ int main(int argc, char **argv) {
     // Parse the command line
     std::string input = "";
     bool print_ast = false;
+    bool print_bytecode = false;
+    bool use_tree = false;
+    int64_t jit_threshold = 1000;
     
     for (int i = 1; i<argc; i++) {
         std::string arg = argv[i];
         
         if (arg == "--ast") {
             print_ast = true;
+        } else if (arg == "--bytecode") {
+            print_bytecode = true;
+        } else if (arg == "--tree") {
+            use_tree = true;
+        } else if (arg == "--jit-threshold") {
+            if (i + 1 == argc) {
+                std::cerr << "Error: --jit-threshold needs a value." << std::endl;
+                return 1;
+            }
+            jit_threshold = atoll(argv[i+1]);
+            i += 1;
+        } else if (arg == "--no-jit") {
+            jit_threshold = -1;
         } else if (arg[0] == '-') {
             std::cerr << "Invalid option: " << arg << std::endl;
             return 1;
@@ -49,7 +66,28 @@ int main(int argc, char **argv) {
         return 0;
     }
     
+    // Compile to bytecode, unless the tree walker was asked for
+    // Programs the bytecode compiler can't handle yet still run on the tree walker.
+    if (!use_tree) {
+        auto compiler = std::make_unique<BcCompiler>(tree);
+        if (compiler->compile()) {
+            auto program = compiler->getProgram();
+            if (print_bytecode) {
+                program->print();
+                return 0;
+            }
+            
+            auto vm = std::make_unique<BcVM>(program);
+            vm->jit_threshold = jit_threshold;
+            return vm->run();
+        } else if (print_bytecode) {
+            std::cerr << "Error: " << compiler->getError() << std::endl;
+            return 1;
+        }
+    }
+    
     auto intr = std::make_unique<AstInterpreter>(tree);
+    intr->jit_threshold = jit_threshold;
     int code = intr->run();
 
     return code;
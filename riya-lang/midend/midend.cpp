@@ -7,13 +7,13 @@
 
 #include "midend.hpp"
 
-void Midend::process_function_call(std::shared_ptr<AstFuncCallStmt> call, std::shared_ptr<AstBlock> block) {
+void Midend::process_function_call(AstFuncCallStmt *call, AstBlock *block) {
     if (call->name != "print") {
         return;
     }
 
-    auto args = std::static_pointer_cast<AstExprList>(call->expression);
-    auto args2 = std::make_shared<AstExprList>();
+    auto args = static_cast<AstExprList *>(call->expression);
+    auto args2 = AstArena::make<AstExprList>();
     std::string fmt = "";
     bool skip_next = false;
     
@@ -28,7 +28,7 @@ void Midend::process_function_call(std::shared_ptr<AstFuncCallStmt> call, std::s
             case V_AstType::CharL: fmt += "c"; args2->add_expression(expr); break;
             case V_AstType::IntL: fmt += "d"; args2->add_expression(expr); break;
             case V_AstType::StringL: {
-                auto s = std::static_pointer_cast<AstString>(expr);
+                auto s = static_cast<AstString *>(expr);
                 if (s->value == "%x") {
                     fmt += "x";
                     skip_next = true;
@@ -43,14 +43,14 @@ void Midend::process_function_call(std::shared_ptr<AstFuncCallStmt> call, std::s
             case V_AstType::ID: {
                 args2->add_expression(expr);
                 
-                std::shared_ptr<AstDataType> dtype;
+                AstDataType *dtype = nullptr;
                 if (expr->type == V_AstType::ArrayAccess) {
-                    std::string name = std::static_pointer_cast<AstArrayAccess>(expr)->value;
+                    std::string name = static_cast<AstArrayAccess *>(expr)->value;
                     dtype = block->getDataType(name);
-                    dtype = std::static_pointer_cast<AstPointerType>(dtype)->base_type;
+                    dtype = static_cast<AstPointerType *>(dtype)->base_type;
                 } else if (expr->type == V_AstType::StructAccess) {
-                    auto sa = std::static_pointer_cast<AstStructAccess>(expr);
-                    auto sa_type = std::static_pointer_cast<AstStructType>(block->getDataType(sa->var));
+                    auto sa = static_cast<AstStructAccess *>(expr);
+                    auto sa_type = static_cast<AstStructType *>(block->getDataType(sa->var));
                     for (auto str : tree->structs) {
                         if (str->name == sa_type->name) {
                             for (auto v_item : str->items) {
@@ -61,13 +61,13 @@ void Midend::process_function_call(std::shared_ptr<AstFuncCallStmt> call, std::s
                         }
                     }
                     if (dtype->type == V_AstType::Ptr) {
-                        dtype = std::static_pointer_cast<AstPointerType>(dtype)->base_type;
+                        dtype = static_cast<AstPointerType *>(dtype)->base_type;
                     }
                 } else {
-                    std::string name = std::static_pointer_cast<AstID>(expr)->value;
+                    std::string name = static_cast<AstID *>(expr)->value;
                     dtype = block->getDataType(name);
                     if (dtype->type == V_AstType::Ptr) {
-                        dtype = std::static_pointer_cast<AstPointerType>(dtype)->base_type;
+                        dtype = static_cast<AstPointerType *>(dtype)->base_type;
                     }
                 }
                 
@@ -88,8 +88,8 @@ void Midend::process_function_call(std::shared_ptr<AstFuncCallStmt> call, std::s
     }
     
     // Add the format
-    //auto args2 = std::static_pointer_cast<AstExprList>(args);
-    std::shared_ptr<AstString> fmt_str = std::make_shared<AstString>(fmt);
+    //auto args2 = static_cast<AstExprList *>(args);
+    AstString *fmt_str = AstArena::make<AstString>(fmt);
     args2->list.insert(args2->list.begin(), fmt_str);
     call->expression = args2;
 }
@@ -97,7 +97,7 @@ void Midend::process_function_call(std::shared_ptr<AstFuncCallStmt> call, std::s
 //
 // Process binary operation for strings
 //
-std::shared_ptr<AstExpression> Midend::process_binary_op(std::shared_ptr<AstBinaryOp> expr, std::shared_ptr<AstBlock> block) {
+AstExpression *Midend::process_binary_op(AstBinaryOp *expr, AstBlock *block) {
     auto lval = expr->lval;
     auto rval = expr->rval;
     
@@ -110,11 +110,11 @@ std::shared_ptr<AstExpression> Midend::process_binary_op(std::shared_ptr<AstBina
     } else if (lval->type == V_AstType::StringL && rval->type == V_AstType::CharL) {
         string_op = true;
     } else if (lval->type == V_AstType::ID && rval->type == V_AstType::CharL) {
-        std::shared_ptr<AstID> lvalID = std::static_pointer_cast<AstID>(lval);
+        AstID *lvalID = static_cast<AstID *>(lval);
         if (block->getDataType(lvalID->value)->type == V_AstType::String) string_op = true;
     } else if (lval->type == V_AstType::ID && rval->type == V_AstType::ID) {
-        std::shared_ptr<AstID> lvalID = std::static_pointer_cast<AstID>(lval);
-        std::shared_ptr<AstID> rvalID = std::static_pointer_cast<AstID>(rval);
+        AstID *lvalID = static_cast<AstID *>(lval);
+        AstID *rvalID = static_cast<AstID *>(rval);
         
         if (block->getDataType(lvalID->value)->type == V_AstType::String) string_op = true;
         if (block->getDataType(rvalID->value)->type == V_AstType::String) {
@@ -131,26 +131,26 @@ std::shared_ptr<AstExpression> Midend::process_binary_op(std::shared_ptr<AstBina
         return nullptr;
     }
     
-    auto args = std::make_shared<AstExprList>();
+    auto args = AstArena::make<AstExprList>();
     args->add_expression(lval);
     args->add_expression(rval);
 
     if (expr->type == V_AstType::EQ || expr->type == V_AstType::NEQ) {
-        auto fc = std::make_shared<AstFuncCallExpr>("stringcmp");
+        auto fc = AstArena::make<AstFuncCallExpr>("stringcmp");
         fc->args = args;
         expr->lval = fc;
         
         if (expr->type == V_AstType::NEQ)
-            expr->rval = std::make_shared<AstInt>(0);
+            expr->rval = AstArena::make<AstInt>(0);
         else
-            expr->rval = std::make_shared<AstInt>(1);
+            expr->rval = AstArena::make<AstInt>(1);
     } else if (expr->type == V_AstType::Add) {
         if (rval_str) {
-            auto fc = std::make_shared<AstFuncCallExpr>("strcat_str");
+            auto fc = AstArena::make<AstFuncCallExpr>("strcat_str");
             fc->args = args;
             return fc;
         } else {
-            auto fc = std::make_shared<AstFuncCallExpr>("strcat_char");
+            auto fc = AstArena::make<AstFuncCallExpr>("strcat_char");
             fc->args = args;
             return fc;
         }
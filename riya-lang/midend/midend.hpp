@@ -16,7 +16,7 @@
 class Midend : public AstMidend {
 public:
     explicit Midend(std::shared_ptr<AstTree> tree) : AstMidend(tree) {}
-    void process_function_call(std::shared_ptr<AstFuncCallStmt> call, std::shared_ptr<AstBlock> block) override;
-    std::shared_ptr<AstExpression> process_binary_op(std::shared_ptr<AstBinaryOp> expr, std::shared_ptr<AstBlock> block) override;
+    void process_function_call(AstFuncCallStmt *call, AstBlock *block) override;
+    AstExpression *process_binary_op(AstBinaryOp *expr, AstBlock *block) override;
 };
 
@@ -12,22 +12,22 @@
 // Called if a conditional statement has only one operand. If it does,
 // we have to expand to have two operands before we get down to the
 // compiler layer
-std::shared_ptr<AstExpression> Parser::checkCondExpression(std::shared_ptr<AstBlock> block, std::shared_ptr<AstExpression> toCheck) {
-    std::shared_ptr<AstExpression> expr = toCheck;
+AstExpression *Parser::checkCondExpression(AstBlock *block, AstExpression *toCheck) {
+    AstExpression *expr = toCheck;
     
     switch (toCheck->type) {
         case V_AstType::ID: {
-            std::shared_ptr<AstID> id = std::static_pointer_cast<AstID>(toCheck);
-            std::shared_ptr<AstDataType> dataType = block->getDataType(id->value);            
-            std::shared_ptr<AstEQOp> eq = std::make_shared<AstEQOp>();
+            AstID *id = static_cast<AstID *>(toCheck);
+            AstDataType *dataType = block->getDataType(id->value);            
+            AstEQOp *eq = AstArena::make<AstEQOp>();
             eq->lval = id;
             
             switch (dataType->type) {
-                case V_AstType::Bool: eq->rval = std::make_shared<AstInt>(1); break;
-                case V_AstType::Int8: eq->rval = std::make_shared<AstInt>(1, 8); break;
-                case V_AstType::Int16: eq->rval = std::make_shared<AstInt>(1, 16); break;
-                case V_AstType::Int32: eq->rval = std::make_shared<AstInt>(1); break;
-                case V_AstType::Int64: eq->rval = std::make_shared<AstInt>(1, 64); break;
+                case V_AstType::Bool: eq->rval = AstArena::make<AstInt>(1); break;
+                case V_AstType::Int8: eq->rval = AstArena::make<AstInt>(1, 8); break;
+                case V_AstType::Int16: eq->rval = AstArena::make<AstInt>(1, 16); break;
+                case V_AstType::Int32: eq->rval = AstArena::make<AstInt>(1); break;
+                case V_AstType::Int64: eq->rval = AstArena::make<AstInt>(1, 64); break;
                 
                 default: {}
             }
@@ -36,9 +36,9 @@ std::shared_ptr<AstExpression> Parser::checkCondExpression(std::shared_ptr<AstBl
         } break;
         
         case V_AstType::IntL: {
-            std::shared_ptr<AstEQOp> eq = std::make_shared<AstEQOp>();
+            AstEQOp *eq = AstArena::make<AstEQOp>();
             eq->lval = expr;
-            eq->rval = std::make_shared<AstInt>(1);
+            eq->rval = AstArena::make<AstInt>(1);
             expr = eq;
         } break;
         
@@ -49,22 +49,22 @@ std::shared_ptr<AstExpression> Parser::checkCondExpression(std::shared_ptr<AstBl
 }
 
 // Builds a conditional statement
-bool Parser::buildConditional(std::shared_ptr<AstBlock> block) {
-    std::shared_ptr<AstIfStmt> cond = std::make_shared<AstIfStmt>();
-    std::shared_ptr<AstExpression> arg = buildExpression(block, nullptr, t_then);
+bool Parser::buildConditional(AstBlock *block) {
+    AstIfStmt *cond = AstArena::make<AstIfStmt>();
+    AstExpression *arg = buildExpression(block, nullptr, t_then);
     if (!arg) return false;
     cond->expression = arg;
     block->addStatement(cond);
     
-    std::shared_ptr<AstExpression> expr = checkCondExpression(block, cond->expression);
+    AstExpression *expr = checkCondExpression(block, cond->expression);
     cond->expression = expr;
     
-    std::shared_ptr<AstBlock> true_block = std::make_shared<AstBlock>();
-    true_block->mergeSymbols(block);
+    AstBlock *true_block = AstArena::make<AstBlock>();
+    true_block->setParent(block);
     cond->true_block = true_block;
     
-    std::shared_ptr<AstBlock> false_block = std::make_shared<AstBlock>();
-    false_block->mergeSymbols(block);
+    AstBlock *false_block = AstArena::make<AstBlock>();
+    false_block->setParent(block);
     cond->false_block = false_block;
     buildBlock(true_block, cond);
     
@@ -72,18 +72,18 @@ bool Parser::buildConditional(std::shared_ptr<AstBlock> block) {
 }
 
 // Builds a while statement
-bool Parser::buildWhile(std::shared_ptr<AstBlock> block) {
-    std::shared_ptr<AstWhileStmt> loop = std::make_shared<AstWhileStmt>();
-    std::shared_ptr<AstExpression> arg = buildExpression(block, nullptr, t_do);
+bool Parser::buildWhile(AstBlock *block) {
+    AstWhileStmt *loop = AstArena::make<AstWhileStmt>();
+    AstExpression *arg = buildExpression(block, nullptr, t_do);
     if (!arg) return false;
     loop->expression = arg;
     block->addStatement(loop);
     
-    std::shared_ptr<AstExpression> expr = checkCondExpression(block, loop->expression);
+    AstExpression *expr = checkCondExpression(block, loop->expression);
     loop->expression = expr;
     
-    std::shared_ptr<AstBlock> block2 = std::make_shared<AstBlock>();
-    block2->mergeSymbols(block);
+    AstBlock *block2 = AstArena::make<AstBlock>();
+    block2->setParent(block);
     buildBlock(block2);
     loop->block = block2;
     
@@ -91,9 +91,9 @@ bool Parser::buildWhile(std::shared_ptr<AstBlock> block) {
 }
 
 // Builds a loop keyword
-bool Parser::buildLoopCtrl(std::shared_ptr<AstBlock> block, bool isBreak) {
-    if (isBreak) block->addStatement(std::make_shared<AstBreak>());
-    else block->addStatement(std::make_shared<AstContinue>());
+bool Parser::buildLoopCtrl(AstBlock *block, bool isBreak) {
+    if (isBreak) block->addStatement(AstArena::make<AstBreak>());
+    else block->addStatement(AstArena::make<AstContinue>());
     consume_token(t_semicolon, "Expected \';\' after break or continue.");
     return true;
 }
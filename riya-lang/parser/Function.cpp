@@ -12,13 +12,13 @@
 #include <lex/lex.hpp>
 
 // Returns the function arguments
-bool Parser::getFunctionArgs(std::shared_ptr<AstBlock> block, std::vector<Var> &args) {
+bool Parser::getFunctionArgs(AstBlock *block, std::vector<Var> &args) {
     int tk = lex->get_next();
     if (tk == t_lparen) {
         tk = lex->get_next();
         while (tk != t_eof && tk != t_rparen) {
             int t1 = tk;
-            std::string name = lex->value;
+            std::string name(lex->value);
             int t2 = lex->get_next();
             Var v;
             
@@ -34,6 +34,7 @@ bool Parser::getFunctionArgs(std::shared_ptr<AstBlock> block, std::vector<Var> &
             
             v.type = buildDataType();
             v.name = name;
+            v.id = Symbol::intern(name);
             
             tk = lex->get_next();
             if (tk == t_comma) {
@@ -62,17 +63,17 @@ bool Parser::buildFunction(int startToken, std::string className) {
 
     // Make sure we have a function name
     consume_token(t_id, "Expected function name.");
-    std::string funcName = lex->value;
+    std::string funcName(lex->value);
     
     // Get arguments
     std::vector<Var> args;
-    std::shared_ptr<AstBlock> block = std::make_shared<AstBlock>();
+    AstBlock *block = AstArena::make<AstBlock>();
     if (!getFunctionArgs(block, args)) return false;
 
     // Check to see if there's any return type
     //std::string retName = "";       // TODO: Do we need this?
     tk = lex->get_next();
-    std::shared_ptr<AstDataType> dataType;
+    AstDataType *dataType = nullptr;
     if (tk == t_arrow) {
         dataType = buildDataType();
         tk = lex->get_next();
@@ -89,22 +90,22 @@ bool Parser::buildFunction(int startToken, std::string className) {
     }
 
     // Create the function object
-    tree->block->funcs.push_back(funcName);
+    tree->block->addFunc(funcName);
     
     if (isExtern) {
-        std::shared_ptr<AstExternFunction> ex = std::make_shared<AstExternFunction>(funcName);
+        AstExternFunction *ex = AstArena::make<AstExternFunction>(funcName);
         ex->args = args;
         ex->data_type = dataType;
         tree->addGlobalStatement(ex);
         return true;
     }
     
-    std::shared_ptr<AstFunction> func = std::make_shared<AstFunction>(funcName);
+    AstFunction *func = AstArena::make<AstFunction>(funcName);
     func->data_type = dataType;
     func->args = args;
     tree->addGlobalStatement(func);
-    func->block->mergeSymbols(tree->block);
-    func->block->mergeSymbols(block);
+    block->setParent(tree->block);
+    func->block->setParent(block);
     
     // For the Java backend
     func->routine = true;
@@ -117,7 +118,7 @@ bool Parser::buildFunction(int startToken, std::string className) {
     // Make sure we end with a return statement
     V_AstType lastType = func->block->getBlock().back()->type;
     if (lastType == V_AstType::Return) {
-        std::shared_ptr<AstStatement> ret = func->block->getBlock().back();
+        AstStatement *ret = func->block->getBlock().back();
         if (func->data_type->type == V_AstType::Void && ret->hasExpression()) {
             syntax->addError(0, "Cannot return from void function.");
             return false;
@@ -127,7 +128,7 @@ bool Parser::buildFunction(int startToken, std::string className) {
         }
     } else {
         if (func->data_type->type == V_AstType::Void) {
-            func->addStatement(std::make_shared<AstReturnStmt>());
+            func->addStatement(AstArena::make<AstReturnStmt>());
         } else {
             syntax->addError(0, "Expected return statement.");
             return false;
@@ -139,17 +140,17 @@ bool Parser::buildFunction(int startToken, std::string className) {
 
 // Builds a function call
 // TODO: Pass variable name in from block parser
-bool Parser::buildFunctionCallStmt(std::shared_ptr<AstBlock> block, std::string fc_name) {
+bool Parser::buildFunctionCallStmt(AstBlock *block, std::string fc_name) {
     // Make sure the function exists
     if (!ignore_invalid_funcs && !block->isFunc(fc_name)) {
         syntax->addError(0, "Unknown function.");
         return false;
     }
 
-    std::shared_ptr<AstFuncCallStmt> fc = std::make_shared<AstFuncCallStmt>(fc_name);
+    AstFuncCallStmt *fc = AstArena::make<AstFuncCallStmt>(fc_name);
     block->addStatement(fc);
     
-    std::shared_ptr<AstExpression> args = buildExpression(block, nullptr, t_semicolon, false, true);
+    AstExpression *args = buildExpression(block, nullptr, t_semicolon, false, true);
     if (!args) return false;
     fc->expression = args;
     
@@ -157,11 +158,11 @@ bool Parser::buildFunctionCallStmt(std::shared_ptr<AstBlock> block, std::string
 }
 
 // Builds a return statement
-bool Parser::buildReturn(std::shared_ptr<AstBlock> block) {
-    std::shared_ptr<AstReturnStmt> stmt = std::make_shared<AstReturnStmt>();
+bool Parser::buildReturn(AstBlock *block) {
+    AstReturnStmt *stmt = AstArena::make<AstReturnStmt>();
     block->addStatement(stmt);
     
-    std::shared_ptr<AstExpression> arg = buildExpression(block, nullptr, t_semicolon);
+    AstExpression *arg = buildExpression(block, nullptr, t_semicolon);
     if (!arg) return false;
     stmt->expression = arg;
     
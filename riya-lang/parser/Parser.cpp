@@ -18,46 +18,46 @@ Parser::Parser(std::string input, bool ignore_invalid_funcs) : BaseParser(input)
     
     // Add the built-in functions
     //string malloc(string)
-    tree->block->funcs.push_back("malloc");
-    std::shared_ptr<AstExternFunction> FT1 = std::make_shared<AstExternFunction>("malloc");
+    tree->block->addFunc("malloc");
+    AstExternFunction *FT1 = AstArena::make<AstExternFunction>("malloc");
     FT1->addArgument(Var(AstBuilder::buildInt32Type(), "size"));
     FT1->data_type = AstBuilder::buildStringType();
     tree->addGlobalStatement(FT1);
     
     //print(string)
-    tree->block->funcs.push_back("print");
-    std::shared_ptr<AstExternFunction> FT3 = std::make_shared<AstExternFunction>("print");
+    tree->block->addFunc("print");
+    AstExternFunction *FT3 = AstArena::make<AstExternFunction>("print");
     FT3->varargs = true;
     FT3->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT3->data_type = AstBuilder::buildVoidType();
     tree->addGlobalStatement(FT3);
     
     //i32 strlen(string)
-    tree->block->funcs.push_back("strlen");
-    std::shared_ptr<AstExternFunction> FT4 = std::make_shared<AstExternFunction>("strlen");
+    tree->block->addFunc("strlen");
+    AstExternFunction *FT4 = AstArena::make<AstExternFunction>("strlen");
     FT4->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT4->data_type = AstBuilder::buildInt32Type();
     tree->addGlobalStatement(FT4);
     
     //i32 stringcmp(string, string)
-    tree->block->funcs.push_back("stringcmp");
-    std::shared_ptr<AstExternFunction> FT5 = std::make_shared<AstExternFunction>("stringcmp");
+    tree->block->addFunc("stringcmp");
+    AstExternFunction *FT5 = AstArena::make<AstExternFunction>("stringcmp");
     FT5->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT5->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT5->data_type = AstBuilder::buildInt32Type();
     tree->addGlobalStatement(FT5);
     
     //string strcat_str(string, string)
-    tree->block->funcs.push_back("strcat_str");
-    std::shared_ptr<AstExternFunction> FT6 = std::make_shared<AstExternFunction>("strcat_str");
+    tree->block->addFunc("strcat_str");
+    AstExternFunction *FT6 = AstArena::make<AstExternFunction>("strcat_str");
     FT6->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT6->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT6->data_type = AstBuilder::buildStringType();
     tree->addGlobalStatement(FT6);
     
     //string strcat_char(string, char)
-    tree->block->funcs.push_back("strcat_char");
-    std::shared_ptr<AstExternFunction> FT7 = std::make_shared<AstExternFunction>("strcat_char");
+    tree->block->addFunc("strcat_char");
+    AstExternFunction *FT7 = AstArena::make<AstExternFunction>("strcat_char");
     FT7->addArgument(Var(AstBuilder::buildStringType(), "str"));
     FT7->addArgument(Var(AstBuilder::buildCharType(), "c"));
     FT7->data_type = AstBuilder::buildStringType();
@@ -105,7 +105,7 @@ bool Parser::parse() {
 }
 
 // Builds a statement block
-bool Parser::buildBlock(std::shared_ptr<AstBlock> block, std::shared_ptr<AstNode> parent) {
+bool Parser::buildBlock(AstBlock *block, AstNode *parent) {
     int tk = lex->get_next();
     while (tk != t_end && tk != t_eof) {
         bool code = true;
@@ -119,7 +119,7 @@ bool Parser::buildBlock(std::shared_ptr<AstBlock> block, std::shared_ptr<AstNode
             
             case t_id: {
                 int idtoken = tk;
-                std::string value = lex->value;
+                std::string value(lex->value);
                 tk = lex->get_next();
                 
                 if (tk == t_assign || tk == t_lbracket || tk == t_dot) {
@@ -139,12 +139,12 @@ bool Parser::buildBlock(std::shared_ptr<AstBlock> block, std::shared_ptr<AstNode
             // Handle conditionals
             case t_if: code = buildConditional(block); break;
             case t_elif: {
-                std::shared_ptr<AstIfStmt> condParent = std::static_pointer_cast<AstIfStmt>(parent);
+                AstIfStmt *condParent = static_cast<AstIfStmt *>(parent);
                 code = buildConditional(condParent->false_block);
                 end = true;
             } break;
             case t_else: {
-                std::shared_ptr<AstIfStmt> condParent = std::static_pointer_cast<AstIfStmt>(parent);
+                AstIfStmt *condParent = static_cast<AstIfStmt *>(parent);
                 buildBlock(condParent->false_block);
                 end = true;
             } break;
@@ -182,9 +182,9 @@ void Parser::debugScanner() {
 //
 // Builds a data type from the token stream
 //
-std::shared_ptr<AstDataType> Parser::buildDataType(bool checkBrackets) {
+AstDataType *Parser::buildDataType(bool checkBrackets) {
     int tk = lex->get_next();
-    std::shared_ptr<AstDataType> dataType = nullptr;
+    AstDataType *dataType = nullptr;
     
     switch (tk) {
         case t_bool: dataType = AstBuilder::buildBoolType(); break;
@@ -197,6 +197,8 @@ std::shared_ptr<AstDataType> Parser::buildDataType(bool checkBrackets) {
         case t_u32: dataType = AstBuilder::buildInt32Type(true); break;
         case t_i64: dataType = AstBuilder::buildInt64Type(); break;
         case t_u64: dataType = AstBuilder::buildInt64Type(true); break;
+        case t_f32: dataType = AstBuilder::buildFloat32Type(); break;
+        case t_f64: dataType = AstBuilder::buildFloat64Type(); break;
         case t_string: dataType = AstBuilder::buildStringType(); break;
         
         case t_id: {
@@ -209,7 +211,7 @@ std::shared_ptr<AstDataType> Parser::buildDataType(bool checkBrackets) {
             }
                 
             if (isStruct) {
-                dataType = AstBuilder::buildStructType(lex->value);
+                dataType = AstBuilder::buildStructType(std::string(lex->value));
             }
         } break;
         
@@ -30,26 +30,26 @@ public:
     void debugScanner();
 protected:
     // Function.cpp
-    bool getFunctionArgs(std::shared_ptr<AstBlock> block, std::vector<Var> &args);
+    bool getFunctionArgs(AstBlock *block, std::vector<Var> &args);
     bool buildFunction(int startToken, std::string className = "");
-    bool buildFunctionCallStmt(std::shared_ptr<AstBlock> block, std::string fc_name);
-    bool buildReturn(std::shared_ptr<AstBlock> block);
+    bool buildFunctionCallStmt(AstBlock *block, std::string fc_name);
+    bool buildReturn(AstBlock *block);
     
     // Variable.cpp
-    bool buildVariableDec(std::shared_ptr<AstBlock> block);
-    bool build_array_dec(std::shared_ptr<AstBlock> block);
-    bool buildVariableAssign(std::shared_ptr<AstBlock> block, std::string var_name);
-    bool buildConst(std::shared_ptr<AstBlock> block, bool isGlobal);
+    bool buildVariableDec(AstBlock *block);
+    bool build_array_dec(AstBlock *block);
+    bool buildVariableAssign(AstBlock *block, std::string var_name);
+    bool buildConst(AstBlock *block, bool isGlobal);
     
     // Flow.cpp
-    bool buildConditional(std::shared_ptr<AstBlock> block);
-    bool buildWhile(std::shared_ptr<AstBlock> block);
-    bool buildLoopCtrl(std::shared_ptr<AstBlock> block, bool isBreak);
+    bool buildConditional(AstBlock *block);
+    bool buildWhile(AstBlock *block);
+    bool buildLoopCtrl(AstBlock *block, bool isBreak);
     
     // Structure.cpp
     bool buildStruct();
-    bool buildStructMember(std::shared_ptr<AstStruct> str, int tk);
-    bool buildStructDec(std::shared_ptr<AstBlock> block);
+    bool buildStructMember(AstStruct *str, int tk);
+    bool buildStructDec(AstBlock *block);
     
     // Expression.cpp
     // Override
@@ -62,13 +62,13 @@ protected:
     int get_sub_expr_end() override;
     
     bool build_operator(int tk, std::shared_ptr<ExprContext> ctx) override;
-    std::shared_ptr<AstExpression> build_constant(int tk) override;
-    bool build_identifier(std::shared_ptr<AstBlock> block, int tk, std::shared_ptr<ExprContext> ctx) override;
+    AstExpression *build_constant(int tk) override;
+    bool build_identifier(AstBlock *block, int tk, std::shared_ptr<ExprContext> ctx) override;
     
     // Parser.cpp
-    bool buildBlock(std::shared_ptr<AstBlock> block, std::shared_ptr<AstNode> parent = nullptr);
-    std::shared_ptr<AstExpression> checkCondExpression(std::shared_ptr<AstBlock> block, std::shared_ptr<AstExpression> toCheck);
-    std::shared_ptr<AstDataType> buildDataType(bool checkBrackets = true);
+    bool buildBlock(AstBlock *block, AstNode *parent = nullptr);
+    AstExpression *checkCondExpression(AstBlock *block, AstExpression *toCheck);
+    AstDataType *buildDataType(bool checkBrackets = true);
     void consume_token(token expected, std::string msg);
 private:
     bool ignore_invalid_funcs;
@@ -16,13 +16,13 @@
 // Parses and builds a structure
 bool Parser::buildStruct() {
     consume_token(t_id, "Expected name for struct.");
-    std::string name = lex->value;
+    std::string name(lex->value);
     
     // Next token should be "is"
     consume_token(t_is, "Expected \"is\".");
     
     // Builds the struct items
-    std::shared_ptr<AstStruct> str = std::make_shared<AstStruct>(name);
+    AstStruct *str = AstArena::make<AstStruct>(name);
     int tk = lex->get_next();
     
     while (tk != t_end && tk != t_eof) {
@@ -35,8 +35,8 @@ bool Parser::buildStruct() {
     return true;
 }
 
-bool Parser::buildStructMember(std::shared_ptr<AstStruct> str, int tk) {
-    std::string valName = lex->value;
+bool Parser::buildStructMember(AstStruct *str, int tk) {
+    std::string valName(lex->value);
     
     if (tk != t_id) {
         syntax->addError(lex->line_number, "Expected id value.");
@@ -46,18 +46,16 @@ bool Parser::buildStructMember(std::shared_ptr<AstStruct> str, int tk) {
     // Get the data type
     consume_token(t_colon, "Expected \':\' in structure member.");
     
-    std::shared_ptr<AstDataType> dataType = buildDataType();
+    AstDataType *dataType = buildDataType();
         
     // If its an array, build that. Otherwise, build the default value
     tk = lex->get_next();
         
     if (tk == t_assign) {
-        std::shared_ptr<AstExpression> expr = buildExpression(nullptr, dataType, t_semicolon, true);
+        AstExpression *expr = buildExpression(nullptr, dataType, t_semicolon, true);
         if (!expr) return false;
                 
-        Var v;
-        v.name = valName;
-        v.type = dataType;
+        Var v(dataType, valName);
         str->addItem(v, expr);
     } else {
         syntax->addError(lex->line_number, "Expected default value.");
@@ -67,17 +65,17 @@ bool Parser::buildStructMember(std::shared_ptr<AstStruct> str, int tk) {
     return true;
 }
 
-bool Parser::buildStructDec(std::shared_ptr<AstBlock> block) {
+bool Parser::buildStructDec(AstBlock *block) {
     consume_token(t_id, "Expected structure name.");
-    std::string name = lex->value;
+    std::string name(lex->value);
     
     consume_token(t_colon, "Expected \':\'");
     
     consume_token(t_id, "Expected structure type.");
-    std::string structName = lex->value;
+    std::string structName(lex->value);
     
     // Make sure the given structure exists
-    std::shared_ptr<AstStruct> str = nullptr;
+    AstStruct *str = nullptr;
     
     for (auto s : tree->structs) {
         if (s->name == structName) {
@@ -93,7 +91,7 @@ bool Parser::buildStructDec(std::shared_ptr<AstBlock> block) {
     
     // Now build the declaration and push back
     block->addSymbol(name, AstBuilder::buildStructType(structName));
-    std::shared_ptr<AstStructDec> dec = std::make_shared<AstStructDec>(name, structName);
+    AstStructDec *dec = AstArena::make<AstStructDec>(name, structName);
     block->addStatement(dec);
     
     // Final syntax check
@@ -102,12 +100,12 @@ bool Parser::buildStructDec(std::shared_ptr<AstBlock> block) {
         return true;
     } else if (tk == t_assign) {
         dec->no_init = true;
-        std::shared_ptr<AstExprStatement> empty = std::make_shared<AstExprStatement>();
-        std::shared_ptr<AstExpression> arg = buildExpression(block, AstBuilder::buildStructType(structName), t_semicolon);
+        AstExprStatement *empty = AstArena::make<AstExprStatement>();
+        AstExpression *arg = buildExpression(block, AstBuilder::buildStructType(structName), t_semicolon);
         if (!arg) return false;
         
-        std::shared_ptr<AstID> id = std::make_shared<AstID>(name);
-        std::shared_ptr<AstAssignOp> assign = std::make_shared<AstAssignOp>(id, arg);
+        AstID *id = AstArena::make<AstID>(name);
+        AstAssignOp *assign = AstArena::make<AstAssignOp>(id, arg);
         
         empty->expression = assign;
         block->addStatement(empty);
@@ -3,10 +3,9 @@
 .text
 .global _start
 .global invoke_syscall
-.global malloc
-.global free
+.global map_pages
+.global unmap_pages
 .global output
-.global realloc
 .extern main
 
 _start:
@@ -29,7 +28,7 @@ invoke_syscall:
     syscall
     ret
 
-malloc:
+map_pages:
     mov rsi, rdi
     mov rax, 9
     mov rdi, 0
@@ -40,14 +39,7 @@ malloc:
     syscall
     ret
 
-realloc:
-    xor r10, r10
-    xor r8, r8
-    mov rax, 25
-    syscall
-    ret
-
-free:
+unmap_pages:
     mov rax, 11
     syscall
     ret
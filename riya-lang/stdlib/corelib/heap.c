@@ -0,0 +1,160 @@
+//
+// The heap
+// Memory is mapped from the kernel a chunk at a time. Small blocks come in
+// power-of-two size classes; when a class runs out, a batch of blocks is
+// carved out of the current chunk at once and put on the class's free list,
+// and freed blocks go back onto that list. Blocks too big for any class get
+// a mapping of their own, which goes back to the kernel when they're freed.
+//
+
+// These come from the start file
+extern void *map_pages(unsigned long size);
+extern void unmap_pages(void *addr, unsigned long size);
+
+#define HEAP_CHUNK_SIZE (1024 * 1024)
+#define HEAP_PAGE_SIZE 4096
+#define HEAP_MIN_SHIFT 5                // The smallest block is 32 bytes...
+#define HEAP_CLASSES 14                 // ...and the largest is 256 KB
+#define HEAP_BATCH_SIZE (16 * 1024)     // How much a refill carves at once
+
+// Every block starts with this, which keeps what follows 16-byte aligned
+struct heap_header {
+    unsigned long size;         // The size of the whole block
+    long size_class;            // -1 if the block has its own mapping
+};
+
+// Free blocks are linked through their first word
+struct heap_free {
+    struct heap_free *next;
+};
+
+static struct heap_free *free_lists[HEAP_CLASSES];
+static char *chunk_next = 0;
+static char *chunk_end = 0;
+
+static unsigned long heap_class_size(int size_class) {
+    return 1UL << (size_class + HEAP_MIN_SHIFT);
+}
+
+static void heap_push(int size_class, void *block) {
+    struct heap_free *item = block;
+    item->next = free_lists[size_class];
+    free_lists[size_class] = item;
+}
+
+static void *heap_map(unsigned long size) {
+    void *ptr = map_pages(size);
+    
+    // The kernel hands back errors as small negative numbers
+    if ((unsigned long)ptr > -4096UL) return 0;
+    return ptr;
+}
+
+//
+// Starts a new chunk
+// What's left of the old one is split up onto the free lists, largest
+// pieces first. Everything is carved in multiples of the smallest class,
+// so the pieces always fit one exactly.
+//
+static int heap_new_chunk() {
+    while (chunk_end - chunk_next >= heap_class_size(0)) {
+        int size_class = HEAP_CLASSES - 1;
+        while (heap_class_size(size_class) > chunk_end - chunk_next) --size_class;
+        
+        heap_push(size_class, chunk_next);
+        chunk_next += heap_class_size(size_class);
+    }
+    
+    char *chunk = heap_map(HEAP_CHUNK_SIZE);
+    if (!chunk) return 0;
+    
+    chunk_next = chunk;
+    chunk_end = chunk + HEAP_CHUNK_SIZE;
+    return 1;
+}
+
+//
+// Carves a batch of blocks for an empty class
+// They're pushed from the back, so they come off the list in address order.
+//
+static int heap_refill(int size_class) {
+    unsigned long size = heap_class_size(size_class);
+    if (chunk_end - chunk_next < size && !heap_new_chunk()) return 0;
+    
+    unsigned long count = HEAP_BATCH_SIZE / size;
+    if (count == 0) count = 1;
+    if (count > (chunk_end - chunk_next) / size) count = (chunk_end - chunk_next) / size;
+    
+    for (unsigned long i = count; i > 0; i--) {
+        heap_push(size_class, chunk_next + (i - 1) * size);
+    }
+    
+    chunk_next += count * size;
+    return 1;
+}
+
+void *malloc(int size) {
+    if (size < 0) return 0;
+    
+    unsigned long total = size + sizeof(struct heap_header);
+    struct heap_header *header;
+    
+    if (total > heap_class_size(HEAP_CLASSES - 1)) {
+        total = (total + HEAP_PAGE_SIZE - 1) & ~(unsigned long)(HEAP_PAGE_SIZE - 1);
+        header = heap_map(total);
+        if (!header) return 0;
+        
+        header->size_class = -1;
+    } else {
+        int size_class = 0;
+        while (heap_class_size(size_class) < total) ++size_class;
+        
+        if (!free_lists[size_class] && !heap_refill(size_class)) return 0;
+        
+        header = (struct heap_header *)free_lists[size_class];
+        free_lists[size_class] = free_lists[size_class]->next;
+        header->size_class = size_class;
+        total = heap_class_size(size_class);
+    }
+    
+    header->size = total;
+    return header + 1;
+}
+
+//
+// Memory from the kernel comes zeroed, and programs count on that, so a
+// block is cleared before it goes back on a free list.
+//
+void free(void *ptr) {
+    if (!ptr) return;
+    
+    struct heap_header *header = (struct heap_header *)ptr - 1;
+    if (header->size_class < 0) {
+        unmap_pages(header, header->size);
+        return;
+    }
+    
+    int size_class = header->size_class;
+    unsigned long count = header->size / sizeof(unsigned long);
+    unsigned long *words = (unsigned long *)header;
+    for (unsigned long i = 0; i < count; i++) words[i] = 0;
+    
+    heap_push(size_class, header);
+}
+
+void *realloc(void *ptr, int size) {
+    if (!ptr) return malloc(size);
+    
+    struct heap_header *header = (struct heap_header *)ptr - 1;
+    unsigned long capacity = header->size - sizeof(struct heap_header);
+    if (size >= 0 && size <= capacity) return ptr;
+    
+    char *new_ptr = malloc(size);
+    if (!new_ptr) return 0;
+    
+    char *old_ptr = ptr;
+    for (unsigned long i = 0; i < capacity; i++) new_ptr[i] = old_ptr[i];
+    
+    free(ptr);
+    return new_ptr;
+}
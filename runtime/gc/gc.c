@@ -1,64 +1,581 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
+#include <setjmp.h>
+#include <pthread.h>
+#include <stdatomic.h>
 
-static uint64_t **address_list;
-static size_t address_count;
+//
+// A conservative mark-sweep collector
+//
+// Every allocation is tracked. When enough has been allocated since the last
+// collection, the stack and the registers are scanned for anything that
+// looks like a pointer into the heap, everything reachable from there is
+// marked, and the rest is freed. Pointers into the middle of an object (or
+// just past its end) keep it alive, since the optimizer is free to keep only
+// those around.
+//
+// Orka has no global variables, so the stack is the only root.
+//
+// Small objects don't go through malloc. They are carved out of 64 KB
+// chunks, each holding slots of a single size class, with a bitmap for which
+// slots are in use and which got marked. Each thread allocates from a chunk
+// of its own for each class, so allocating is usually just finding the next
+// clear bit. The sweep clears the slots nobody marked, and the chunks that
+// have room again are handed back out to whichever thread needs one. Larger
+// objects come from malloc, and each thread keeps its own list of them until
+// the next collection.
+//
+// The chunks a thread owns hang off of a pthread key rather than a __thread
+// variable, because the JIT behind okcc --run can't place TLS sections.
+//
+// Allocating never takes a lock. A thread only touches shared state to get a
+// chunk, which is a compare-and-swap on a list, and to publish a new one,
+// which is a few more. Collections only happen outside of OpenMP parallel
+// regions. Since a parallel body can't share variables with the code around
+// it, anything it allocated is garbage once the region is over, and the
+// main thread's stack is still the only root. Inside a region, the heap is
+// left to grow until the region ends.
+//
+
+// Collections never happen before the heap gets this big
+#define GC_MIN_THRESHOLD (4 * 1024 * 1024)
+
+#define GC_CHUNK_SIZE (64 * 1024)
+#define GC_SMALL_MAX 256
+#define GC_CLASS_COUNT 8
+#define GC_CHUNK_WORDS (GC_CHUNK_SIZE / 16 / 64)
+
+// The chunk map has a bit for every 64 KB of the 48-bit address space
+#define GC_MAP_SIZE (1 << 16)
+#define GC_MAP_WORDS (GC_MAP_SIZE / 64)
+
+static const size_t class_sizes[GC_CLASS_COUNT] = { 16, 32, 48, 64, 96, 128, 192, 256 };
+
+// The size class for each multiple of 16, up to GC_SMALL_MAX
+static const int class_index[GC_SMALL_MAX / 16 + 1] = {
+    0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7
+};
+
+typedef struct {
+    uintptr_t start;
+    size_t size;
+    int marked;
+} gc_object;
+
+typedef struct gc_chunk {
+    int size_class;
+    size_t slot_size;
+    size_t slot_count;
+    size_t cursor;
+    size_t live;
+    int owned;
+    struct gc_chunk *next;
+    struct gc_chunk *next_partial;
+    uintptr_t data;
+    uint64_t used[GC_CHUNK_WORDS];
+    uint64_t marked[GC_CHUNK_WORDS];
+} gc_chunk;
+
+typedef struct gc_thread {
+    gc_chunk *current[GC_CLASS_COUNT];
+    gc_object *objects;
+    size_t object_count;
+    size_t object_max;
+    struct gc_thread *next;
+} gc_thread;
+
+// Large objects that survived the last collection, sorted by address
+static gc_object *objects;
+static size_t object_count;
+static size_t object_max;
+
+// Every chunk, the ones with room in them, and a map for finding them
+static _Atomic(gc_chunk *) all_chunks;
+static _Atomic(gc_chunk *) partial_chunks[GC_CLASS_COUNT];
+static _Atomic(_Atomic uint64_t *) chunk_map[GC_MAP_SIZE];
+
+static _Atomic(gc_thread *) threads;
+static pthread_key_t thread_key;
+
+static _Atomic size_t heap_size;
+static size_t threshold;
+
+static uintptr_t stack_bottom;
+
+// Entries on the mark stack are the start and end of something to scan
+static uintptr_t *mark_stack;
+static size_t mark_count;
+static size_t mark_max;
+
+// From libomp, which every Orka program is linked against
+extern int omp_in_parallel(void) __attribute__((weak));
+
+static void *gc_grow(void *list, size_t *max, size_t item_size) {
+    *max = *max ? *max * 2 : 1024;
+    list = realloc(list, *max * item_size);
+    if (!list) {
+        fprintf(stderr, "gc: out of memory\n");
+        exit(1);
+    }
+    return list;
+}
+
+//
+// Threads
+//
+static void gc_thread_exit(void *data) {
+    gc_thread *thread = data;
+    for (int i = 0; i<GC_CLASS_COUNT; i++) {
+        if (thread->current[i]) thread->current[i]->owned = 0;
+        thread->current[i] = NULL;
+    }
+
+    // The record stays on the list, since its objects are still in the heap
+}
+
+static gc_thread *gc_get_thread() {
+    gc_thread *thread = pthread_getspecific(thread_key);
+    if (thread) return thread;
+
+    thread = calloc(1, sizeof(gc_thread));
+    if (!thread) {
+        fprintf(stderr, "gc: out of memory\n");
+        exit(1);
+    }
+    pthread_setspecific(thread_key, thread);
+
+    thread->next = atomic_load(&threads);
+    while (!atomic_compare_exchange_weak(&threads, &thread->next, thread));
+    return thread;
+}
+
+static int gc_in_parallel() {
+    return omp_in_parallel && omp_in_parallel();
+}
 
 void gc_init() {
-    address_list = malloc(sizeof(uint64_t*)*20);
-    address_count = 0;
+    // The real main sets this, but anyone else calling us gets their own frame
+    if (!stack_bottom) stack_bottom = (uintptr_t)__builtin_frame_address(0);
+
+    // Until the key exists, looking it up would find someone else's
+    pthread_key_create(&thread_key, gc_thread_exit);
+
+    objects = NULL;
+    object_count = 0;
+    object_max = 0;
+    atomic_store(&heap_size, 0);
+    threshold = GC_MIN_THRESHOLD;
 }
 
-void *gc_alloc(int size) {
+//
+// Chunks
+//
+static _Atomic uint64_t *gc_map_words(uintptr_t address, int create) {
+    size_t top = (address >> 32) & (GC_MAP_SIZE - 1);
+    _Atomic uint64_t *words = atomic_load(&chunk_map[top]);
+    if (words || !create) return words;
+
+    _Atomic uint64_t *fresh = calloc(GC_MAP_WORDS, sizeof(uint64_t));
+    if (!fresh) return NULL;
+
+    if (atomic_compare_exchange_strong(&chunk_map[top], &words, fresh)) return fresh;
+    free(fresh);
+    return words;
+}
+
+static gc_chunk *gc_new_chunk(int size_class) {
+    gc_chunk *chunk = aligned_alloc(GC_CHUNK_SIZE, GC_CHUNK_SIZE);
+    if (!chunk) return NULL;
+
+    uintptr_t address = (uintptr_t)chunk;
+    _Atomic uint64_t *words = gc_map_words(address, 1);
+    if (!words) {
+        free(chunk);
+        return NULL;
+    }
+
+    memset(chunk, 0, sizeof(gc_chunk));
+    chunk->size_class = size_class;
+    chunk->slot_size = class_sizes[size_class];
+    chunk->data = (address + sizeof(gc_chunk) + 15) & ~(uintptr_t)15;
+    chunk->slot_count = (address + GC_CHUNK_SIZE - chunk->data) / chunk->slot_size;
+
+    size_t bit = (address >> 16) & (GC_MAP_SIZE - 1);
+    atomic_fetch_or(&words[bit / 64], (uint64_t)1 << (bit % 64));
+
+    chunk->next = atomic_load(&all_chunks);
+    while (!atomic_compare_exchange_weak(&all_chunks, &chunk->next, chunk));
+    return chunk;
+}
+
+static gc_chunk *gc_find_chunk(uintptr_t address) {
+    _Atomic uint64_t *words = gc_map_words(address, 0);
+    if (!words) return NULL;
+
+    size_t bit = (address >> 16) & (GC_MAP_SIZE - 1);
+    if (!(atomic_load_explicit(&words[bit / 64], memory_order_relaxed) & ((uint64_t)1 << (bit % 64)))) return NULL;
+    return (gc_chunk *)(address & ~(uintptr_t)(GC_CHUNK_SIZE - 1));
+}
+
+static void gc_unmap_chunk(gc_chunk *chunk) {
+    uintptr_t address = (uintptr_t)chunk;
+    _Atomic uint64_t *words = gc_map_words(address, 0);
+    size_t bit = (address >> 16) & (GC_MAP_SIZE - 1);
+    atomic_fetch_and(&words[bit / 64], ~((uint64_t)1 << (bit % 64)));
+}
+
+// Pops a chunk with room in it off of a class's list
+// Chunks only go onto the list during a sweep, so one can't come back while
+// another thread is halfway through taking it.
+static gc_chunk *gc_take_partial(int size_class) {
+    gc_chunk *chunk = atomic_load(&partial_chunks[size_class]);
+    while (chunk && !atomic_compare_exchange_weak(&partial_chunks[size_class], &chunk, chunk->next_partial));
+    return chunk;
+}
+
+// Takes the next free slot in a chunk, or returns null if it's full
+static void *gc_take_slot(gc_chunk *chunk) {
+    while (chunk->cursor < chunk->slot_count) {
+        size_t word = chunk->cursor / 64;
+        uint64_t free_bits = ~chunk->used[word] & (~(uint64_t)0 << (chunk->cursor % 64));
+
+        if (free_bits) {
+            size_t index = word * 64 + __builtin_ctzll(free_bits);
+            if (index >= chunk->slot_count) break;
+
+            chunk->used[word] |= (uint64_t)1 << (index % 64);
+            chunk->cursor = index + 1;
+            return (void *)(chunk->data + index * chunk->slot_size);
+        }
+
+        chunk->cursor = (word + 1) * 64;
+    }
+
+    chunk->cursor = chunk->slot_count;
+    return NULL;
+}
+
+//
+// Mark
+//
+static int gc_compare(const void *a, const void *b) {
+    uintptr_t x = ((const gc_object *)a)->start;
+    uintptr_t y = ((const gc_object *)b)->start;
+    return (x > y) - (x < y);
+}
+
+static void gc_push(uintptr_t start, uintptr_t end) {
+    if (mark_count + 2 > mark_max) mark_stack = gc_grow(mark_stack, &mark_max, sizeof(uintptr_t));
+    mark_stack[mark_count] = start;
+    mark_stack[mark_count + 1] = end;
+    mark_count += 2;
+}
+
+static void gc_mark_slot(gc_chunk *chunk, size_t index) {
+    uint64_t bit = (uint64_t)1 << (index % 64);
+    if (!(chunk->used[index / 64] & bit) || (chunk->marked[index / 64] & bit)) return;
+
+    chunk->marked[index / 64] |= bit;
+    uintptr_t start = chunk->data + index * chunk->slot_size;
+    gc_push(start, start + chunk->slot_size);
+}
+
+// Marks whatever an address points into, if it's anything of ours
+// The object table has to be sorted first.
+static void gc_mark_address(uintptr_t address) {
+    gc_chunk *chunk = gc_find_chunk(address);
+    if (chunk) {
+        if (address < chunk->data) return;
+
+        size_t offset = address - chunk->data;
+        size_t index = offset / chunk->slot_size;
+        if (index < chunk->slot_count) gc_mark_slot(chunk, index);
+
+        // It could just as well be the end of the slot before
+        if (offset % chunk->slot_size == 0 && index > 0) gc_mark_slot(chunk, index - 1);
+        return;
+    }
+
+    if (object_count == 0 || address < objects[0].start) return;
+
+    size_t low = 0;
+    size_t high = object_count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (objects[mid].start <= address) low = mid + 1;
+        else high = mid;
+    }
+
+    gc_object *obj = &objects[low - 1];
+    if (address > obj->start + obj->size || obj->marked) return;
+
+    obj->marked = 1;
+    gc_push(obj->start, obj->start + obj->size);
+}
+
+static void gc_scan(uintptr_t from, uintptr_t to) {
+    from = (from + sizeof(uintptr_t) - 1) & ~(sizeof(uintptr_t) - 1);
+
+    for (uintptr_t word = from; word + sizeof(uintptr_t) <= to; word += sizeof(uintptr_t)) {
+        gc_mark_address(*(uintptr_t *)word);
+    }
+}
+
+static void gc_mark() {
+    while (mark_count > 0) {
+        mark_count -= 2;
+        gc_scan(mark_stack[mark_count], mark_stack[mark_count + 1]);
+    }
+}
+
+// Kept out of line so its frame sits below everything gc_collect spilled
+static void __attribute__((noinline)) gc_mark_stack() {
+    volatile uintptr_t top = 0;
+    gc_scan((uintptr_t)&top, stack_bottom);
+    gc_mark();
+}
+
+// Moves the large objects each thread made since the last collection into the table
+static void gc_gather_objects() {
+    for (gc_thread *thread = atomic_load(&threads); thread; thread = thread->next) {
+        for (size_t i = 0; i<thread->object_count; i++) {
+            if (object_count == object_max) objects = gc_grow(objects, &object_max, sizeof(gc_object));
+            objects[object_count] = thread->objects[i];
+            ++object_count;
+        }
+        thread->object_count = 0;
+    }
+
+    qsort(objects, object_count, sizeof(gc_object), gc_compare);
+}
+
+//
+// Sweep
+//
+static size_t gc_count_bits(uint64_t bits) {
+    size_t count = 0;
+    for (; bits; bits &= bits - 1) ++count;
+    return count;
+}
+
+static size_t gc_sweep_chunks() {
+    size_t size = 0;
+    gc_chunk *kept = NULL;
+    for (int i = 0; i<GC_CLASS_COUNT; i++) atomic_store(&partial_chunks[i], NULL);
+
+    gc_chunk *next = NULL;
+    for (gc_chunk *chunk = atomic_load(&all_chunks); chunk; chunk = next) {
+        next = chunk->next;
+        chunk->live = 0;
+
+        for (size_t word = 0; word<GC_CHUNK_WORDS; word++) {
+            chunk->used[word] = chunk->marked[word];
+            chunk->marked[word] = 0;
+            chunk->live += gc_count_bits(chunk->used[word]);
+        }
+
+        chunk->cursor = 0;
+
+        // A chunk somebody is using counts as full, since it's theirs to fill
+        if (chunk->owned) {
+            size += GC_CHUNK_SIZE;
+        } else {
+            if (chunk->live == 0) {
+                gc_unmap_chunk(chunk);
+                free(chunk);
+                continue;
+            }
+
+            if (chunk->live < chunk->slot_count) {
+                chunk->next_partial = atomic_load(&partial_chunks[chunk->size_class]);
+                atomic_store(&partial_chunks[chunk->size_class], chunk);
+            }
+
+            size += chunk->live * chunk->slot_size;
+        }
+
+        chunk->next = kept;
+        kept = chunk;
+    }
+
+    atomic_store(&all_chunks, kept);
+    return size;
+}
+
+static void gc_sweep() {
+    size_t live = 0;
+    size_t size = 0;
+
+    for (size_t i = 0; i<object_count; i++) {
+        if (!objects[i].marked) {
+            free((void *)objects[i].start);
+            continue;
+        }
+
+        objects[i].marked = 0;
+        objects[live] = objects[i];
+        ++live;
+        size += objects[i].size;
+    }
+
+    object_count = live;
+    size += gc_sweep_chunks();
+    atomic_store(&heap_size, size);
+}
+
+void gc_collect() {
+    // Other threads could be using anything we'd free
+    if (gc_in_parallel()) return;
+
+    // Get every callee-saved register onto the stack where it can be scanned
+    jmp_buf registers;
+    __builtin_unwind_init();
+    setjmp(registers);
+
+    gc_gather_objects();
+    gc_mark_stack();
+    gc_sweep();
+
+    // Let the heap grow to twice what survived before trying again
+    threshold = atomic_load(&heap_size) * 2;
+    if (threshold < GC_MIN_THRESHOLD) threshold = GC_MIN_THRESHOLD;
+}
+
+static void gc_check_threshold() {
+    if (atomic_load_explicit(&heap_size, memory_order_relaxed) > threshold) gc_collect();
+}
+
+//
+// Allocation
+//
+static void *gc_alloc_small(size_t size) {
+    int size_class = class_index[(size + 15) / 16];
+    gc_thread *thread = gc_get_thread();
+    gc_chunk *chunk = thread->current[size_class];
+
+    if (chunk) {
+        void *ptr = gc_take_slot(chunk);
+        if (ptr) return ptr;
+        chunk->owned = 0;
+        thread->current[size_class] = NULL;
+    }
+
+    gc_check_threshold();
+
+    // Take a chunk with room in it if there is one, or make a new one
+    chunk = gc_take_partial(size_class);
+    if (!chunk) {
+        chunk = gc_new_chunk(size_class);
+        if (!chunk) return NULL;
+    }
+
+    chunk->owned = 1;
+    thread->current[size_class] = chunk;
+    atomic_fetch_add(&heap_size, (chunk->slot_count - chunk->live) * chunk->slot_size);
+    return gc_take_slot(chunk);
+}
+
+static void *gc_alloc_large(size_t size) {
+    gc_check_threshold();
+
     void *ptr = malloc(size);
-    address_list[address_count] = ptr;
-    ++address_count;
+    if (!ptr) return NULL;
+
+    gc_thread *thread = gc_get_thread();
+    if (thread->object_count == thread->object_max) {
+        thread->objects = gc_grow(thread->objects, &thread->object_max, sizeof(gc_object));
+    }
+
+    thread->objects[thread->object_count].start = (uintptr_t)ptr;
+    thread->objects[thread->object_count].size = size;
+    thread->objects[thread->object_count].marked = 0;
+    ++thread->object_count;
+
+    atomic_fetch_add(&heap_size, size);
     return ptr;
 }
 
-uint8_t *gc_alloc_i8(int size) {
-    void *ptr = malloc(sizeof(uint8_t)*size);
-    address_list[address_count] = ptr;
-    ++address_count;
+static void *gc_alloc_bytes(size_t size) {
+    void *ptr = size <= GC_SMALL_MAX ? gc_alloc_small(size) : gc_alloc_large(size);
+    if (!ptr) {
+        gc_collect();
+        ptr = size <= GC_SMALL_MAX ? gc_alloc_small(size) : gc_alloc_large(size);
+        if (!ptr) {
+            fprintf(stderr, "gc: out of memory\n");
+            exit(1);
+        }
+    }
+
     return ptr;
 }
 
+void *gc_alloc(int size) {
+    return gc_alloc_bytes(size);
+}
+
+uint8_t *gc_alloc_i8(int size) {
+    return gc_alloc_bytes(sizeof(uint8_t)*size);
+}
+
 uint16_t *gc_alloc_i6(int size) {
-    void *ptr = malloc(sizeof(uint16_t)*size);
-    address_list[address_count] = ptr;
-    ++address_count;
-    return ptr;
+    return gc_alloc_bytes(sizeof(uint16_t)*size);
 }
 
 uint32_t *gc_alloc_i32(int size) {
-    void *ptr = malloc(sizeof(uint32_t)*size);
-    address_list[address_count] = ptr;
-    ++address_count;
-    return ptr;
+    return gc_alloc_bytes(sizeof(uint32_t)*size);
 }
 
 uint64_t *gc_alloc_i64(int size) {
-    void *ptr = malloc(sizeof(uint64_t)*size);
-    address_list[address_count] = ptr;
-    ++address_count;
-    return ptr;
+    return gc_alloc_bytes(sizeof(uint64_t)*size);
 }
 
 void gc_destroy() {
-    for (int i = 0; i<address_count; i++) {
-        free(address_list[i]);
+    gc_gather_objects();
+    for (size_t i = 0; i<object_count; i++) {
+        free((void *)objects[i].start);
     }
-    free(address_list);
+    free(objects);
+    free(mark_stack);
+
+    objects = NULL;
+    object_count = 0;
+    object_max = 0;
+    mark_stack = NULL;
+    mark_count = 0;
+    mark_max = 0;
+
+    gc_chunk *next = NULL;
+    for (gc_chunk *chunk = atomic_load(&all_chunks); chunk; chunk = next) {
+        next = chunk->next;
+        gc_unmap_chunk(chunk);
+        free(chunk);
+    }
+
+    atomic_store(&all_chunks, NULL);
+    for (int i = 0; i<GC_CLASS_COUNT; i++) atomic_store(&partial_chunks[i], NULL);
+
+    // The OpenMP threads outlive us, and under okcc --run, so does the
+    // destructor's code, so the key goes before they can call it
+    pthread_key_delete(thread_key);
+
+    gc_thread *next_thread = NULL;
+    for (gc_thread *thread = atomic_load(&threads); thread; thread = next_thread) {
+        next_thread = thread->next;
+        free(thread->objects);
+        free(thread);
+    }
+    atomic_store(&threads, NULL);
 }
 
 extern int __main(char **argv, int argc);
 
 int main(int argc, char **argv) {
+    stack_bottom = (uintptr_t)__builtin_frame_address(0);
     gc_init();
     int ret = __main(argv, argc);
     gc_destroy();
     return ret;
 }
 
-
@@ -0,0 +1,246 @@
+#!/usr/bin/python3
+#
+# This software is licensed under BSD0 (public domain).
+# Therefore, this software belongs to humanity.
+# See COPYING for more info.
+#
+
+#
+# Parallel test runner
+# Runs the same tests as the test_* targets, but all at once across every
+# core. Each test gets a temporary directory of its own, so nothing is shared
+# between them. The list of tests comes from the *_TEST_SRC lists in each
+# suite's CMakeLists.txt, so commenting a test out there skips it here too.
+#
+# Usage: run_tests.py <build dir> [-j jobs] [--levels 0,1,2,3] [--suite name]
+#
+import argparse
+import concurrent.futures
+import difflib
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+
+# Suite name, directory under test/, and the kind of test it holds
+# MULTI_TEST_SRC lists are built together with <name>_lib.ok. AST_TEST_SRC
+# lists check the structure declarations that --ast prints against out/*.ast.
+SUITES = [
+    ("core", "riya/core", "riya_status"),
+    ("output", "riya/output", "riya"),
+    ("lex", "riya/lex", "riya_lex"),
+    ("orka_array", "orka/array", "orka"),
+    ("orka_basic", "orka/basic", "orka"),
+    ("orka_class", "orka/class", "orka"),
+    ("orka_cond", "orka/cond", "orka"),
+    ("orka_enum", "orka/enum", "orka"),
+    ("orka_float", "orka/float", "orka"),
+    ("orka_func", "orka/func", "orka"),
+    ("orka_loop", "orka/loop", "orka"),
+    ("orka_str", "orka/str", "orka"),
+    ("orka_struct", "orka/struct", "orka"),
+    ("orka_syntax", "orka/syntax", "orka"),
+    ("riyai", "riyai", "riyai"),
+]
+
+# Suites that are also built with code generation split across threads
+SPLIT_SUITES = ["orka_func"]
+
+class Test:
+    def __init__(self, suite, name, mode, source, expected):
+        self.suite = suite
+        self.name = name
+        self.mode = mode
+        self.source = source
+        self.expected = expected
+        self.compile = None
+        self.run = None
+        self.keep = None    # If set, only output lines matching this are compared
+
+        # Filled in once the test has run
+        self.passed = False
+        self.reason = ""
+        self.diff = []
+        self.compile_time = 0.0
+        self.run_time = 0.0
+
+    def label(self):
+        return "[%s] %s/%s" % (self.mode, self.suite, os.path.basename(self.source))
+
+#
+# Reads the test lists out of a suite's CMakeLists.txt
+#
+def read_lists(directory):
+    with open(os.path.join(directory, "CMakeLists.txt")) as f:
+        text = f.read()
+
+    lists = {}
+    for match in re.finditer(r"set\((\w+_TEST_SRC)(.*?)\)", text, re.S):
+        items = []
+        for line in match.group(2).splitlines():
+            items += line.split("#")[0].split()
+        lists[match.group(1)] = items
+    return lists
+
+#
+# Builds the list of tests for one suite
+#
+def discover(build, suite, path, kind, levels):
+    directory = os.path.join(ROOT, path)
+    lists = read_lists(directory)
+    tests = []
+
+    okcc = os.path.join(build, "orka-lang", "okcc")
+    riyac = os.path.join(build, "riya-lang", "riyac")
+    riyai = os.path.join(build, "riya-lang", "riyai")
+
+    ext = ".ok" if kind == "orka" else ".ry"
+    compiler = okcc if kind == "orka" else riyac
+
+    for list_name, items in lists.items():
+        for name in items:
+            source = os.path.join(directory, name + ext)
+            expected = os.path.join(directory, "out", name + ".out")
+            if kind == "riya_status":
+                expected = None
+
+            def add(mode, compile, run):
+                test = Test(suite, name, mode, source, expected)
+                test.compile = compile
+                test.run = run
+                tests.append(test)
+
+            if list_name == "AST_TEST_SRC":
+                expected = os.path.join(directory, "out", name + ".ast")
+                add("AST", None, [compiler, source, "--ast"])
+                tests[-1].keep = r"STRUCT .* : "
+            elif list_name == "MULTI_TEST_SRC":
+                library = os.path.join(directory, name + "_lib" + ext)
+                for level in levels:
+                    add("O" + level, [compiler, source, library, "-j", "2", "-O" + level, "-o", name + ".exe"], ["./" + name + ".exe"])
+            elif kind == "riyai":
+                add("RY_INTR", None, [riyai, source])
+                add("RY_BC_JIT", None, [riyai, source, "--jit-threshold", "0"])
+                if list_name == "CORE_TEST_SRC":
+                    add("RY_TREE", None, [riyai, source, "--tree"])
+                    add("RY_JIT", None, [riyai, source, "--tree", "--jit-threshold", "0"])
+            elif kind == "riya_lex":
+                add("LEX", None, [riyac, source, "--test-lex"])
+            else:
+                for level in levels:
+                    add("O" + level, [compiler, source, "-O" + level, "-o", name + ".exe"], ["./" + name + ".exe"])
+                    if suite in SPLIT_SUITES:
+                        add("O" + level + "][split", [compiler, source, "--codegen-threads", "2", "-O" + level, "-o", name + ".exe"], ["./" + name + ".exe"])
+                add("RUN", None, [compiler, source, "--run"])
+
+    return tests
+
+#
+# Runs a single test in a directory of its own
+#
+def run_test(test, timeout):
+    with tempfile.TemporaryDirectory(prefix=test.name + "_") as tmp:
+        try:
+            if test.compile:
+                start = time.time()
+                result = subprocess.run(test.compile, cwd=tmp, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, timeout=timeout)
+                test.compile_time = time.time() - start
+                if result.returncode != 0 or not os.path.exists(os.path.join(tmp, test.run[0])):
+                    test.reason = "compile failed"
+                    test.diff = result.stdout.decode(errors="replace").splitlines()
+                    return test
+
+            start = time.time()
+            result = subprocess.run(test.run, cwd=tmp, stdout=subprocess.PIPE, stderr=subprocess.PIPE, timeout=timeout)
+            test.run_time = time.time() - start
+        except subprocess.TimeoutExpired:
+            test.reason = "timed out"
+            return test
+        except OSError as error:
+            test.reason = str(error)
+            return test
+
+    if result.returncode != 0:
+        test.reason = "exited with %d" % result.returncode
+        test.diff = result.stderr.decode(errors="replace").splitlines()
+        return test
+
+    if test.expected:
+        with open(test.expected) as f:
+            expected = f.read().splitlines()
+        actual = result.stdout.decode(errors="replace").splitlines()
+        if test.keep:
+            actual = [line for line in actual if re.search(test.keep, line)]
+        if expected != actual:
+            test.reason = "output differs"
+            test.diff = list(difflib.unified_diff(expected, actual, "expected", "actual", lineterm=""))
+            return test
+
+    test.passed = True
+    return test
+
+def main():
+    parser = argparse.ArgumentParser(description="Runs the output tests in parallel.")
+    parser.add_argument("build", help="the CMake build directory")
+    parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count(), help="tests to run at once (default: all cores)")
+    parser.add_argument("--levels", default="0,1,2,3", help="optimization levels to compile at (default: 0,1,2,3)")
+    parser.add_argument("--suite", action="append", help="only run the named suite (can be given more than once)")
+    parser.add_argument("--timeout", type=int, default=60, help="seconds before a test is failed (default: 60)")
+    parser.add_argument("--slowest", type=int, default=10, help="how many of the slowest tests to list (default: 10)")
+    args = parser.parse_args()
+
+    build = os.path.abspath(args.build)
+    levels = [level for level in re.split(r"[,;]", args.levels) if level]
+
+    tests = []
+    for suite, path, kind in SUITES:
+        if args.suite and suite not in args.suite:
+            continue
+        tests += discover(build, suite, path, kind, levels)
+
+    if not tests:
+        print("No tests to run.")
+        return 1
+
+    start = time.time()
+    failed = []
+
+    with concurrent.futures.ThreadPoolExecutor(max_workers=max(1, args.jobs)) as pool:
+        futures = [pool.submit(run_test, test, args.timeout) for test in tests]
+        for future in concurrent.futures.as_completed(futures):
+            test = future.result()
+            if test.passed:
+                print("[PASS]%-40s compile %7.3fs  run %7.3fs" % (test.label(), test.compile_time, test.run_time))
+            else:
+                print("[FAIL]%s: %s" % (test.label(), test.reason))
+                for line in test.diff[:20]:
+                    print("    " + line)
+                failed.append(test)
+            sys.stdout.flush()
+
+    elapsed = time.time() - start
+    compile_total = sum(test.compile_time for test in tests)
+    run_total = sum(test.run_time for test in tests)
+
+    if args.slowest > 0:
+        print("")
+        print("Slowest tests:")
+        slowest = sorted(tests, key=lambda test: test.compile_time + test.run_time, reverse=True)
+        for test in slowest[:args.slowest]:
+            print("    %-40s compile %7.3fs  run %7.3fs" % (test.label(), test.compile_time, test.run_time))
+
+    print("")
+    print("%d passed, %d failed, in %.2fs on %d jobs (%.2fs compiling, %.2fs running)" % (
+        len(tests) - len(failed), len(failed), elapsed, args.jobs, compile_total, run_total))
+
+    for test in failed:
+        print("    failed: " + test.label())
+
+    return 1 if failed else 0
+
+if __name__ == "__main__":
+    sys.exit(main())